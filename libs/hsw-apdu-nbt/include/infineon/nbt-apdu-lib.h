@@ -116,7 +116,12 @@ typedef enum
     /**
      * \brief NBT personalization command set module ID.
      */
-    NBT_CMD_PERSO
+    NBT_CMD_PERSO,
+
+    /**
+     * \brief NBT multi-device session manager module ID.
+     */
+    NBT_SESSION_MANAGER
 } nbt_module_id;
 
 #ifdef __cplusplus
@@ -9,6 +9,10 @@
 #ifndef NBT_APDU_H
 #define NBT_APDU_H
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 #include "infineon/ifx-apdu-error.h"
 #include "infineon/ifx-apdu-protocol.h"
 #include "infineon/ifx-apdu.h"
@@ -24,6 +28,11 @@ extern "C" {
  */
 #define NBT_INIT             UINT8_C(0x01)
 
+/**
+ * \brief Identifier for command set transceive
+ */
+#define NBT_TRANSCEIVE       UINT8_C(0x02)
+
 /**
  * \brief String used as source information for logging.
  */
@@ -69,6 +78,97 @@ extern "C" {
  */
 #define NBT_LE_NONE          UINT8_C(0x00)
 
+/**
+ * \brief Number of files whose images can be held by the file cache of an NBT
+ * command set.
+ */
+#define NBT_FILE_CACHE_ENTRIES UINT8_C(4)
+
+/**
+ * \brief FileID used if the currently selected file is unknown (reserved by
+ * ISO/IEC 7816-4).
+ */
+#define NBT_FILE_ID_NONE       UINT16_C(0xFFFF)
+
+/**
+ * \brief Maximum number of bytes (P1, P2 and data) of a SELECT command whose
+ * selection is tracked by an NBT command set.
+ */
+#define NBT_SELECT_RECORD_SIZE UINT8_C(16)
+
+/**
+ * \brief Optional callback notified after every chunk of an NDEF message has
+ * been read or written.
+ *
+ * \param[in] done Number of NDEF message bytes transferred so far.
+ * \param[in] total Size of the NDEF message in bytes.
+ * \param[in] context Context given to nbt_set_ndef_progress().
+ */
+typedef void (*nbt_ndef_progress_t)(size_t done, size_t total, void *context);
+
+/**
+ * \brief Host-side image of a file held by the file cache.
+ */
+typedef struct
+{
+    /**
+     * \brief FileID of cached file, \ref NBT_FILE_ID_NONE if entry is unused.
+     */
+    uint16_t file_id;
+
+    /**
+     * \brief File image (NDEF message for NDEF files, file content otherwise).
+     */
+    uint8_t *data;
+
+    /**
+     * \brief Number of bytes in \ref data.
+     */
+    size_t length;
+
+    /**
+     * \brief Number of bytes allocated for \ref data (kept when the image is
+     * invalidated to be reused by the next image).
+     */
+    size_t size;
+
+    /**
+     * \brief P1, P2 and data (including passwords) of the SELECT command the
+     * image has been read or written with.
+     *
+     * \details The image is only used while the file is selected with exactly
+     * this SELECT command, so images are never shared between passwords.
+     */
+    uint8_t select[NBT_SELECT_RECORD_SIZE];
+
+    /**
+     * \brief Number of bytes in \ref select.
+     */
+    uint8_t select_length;
+} nbt_file_cache_entry_t;
+
+/**
+ * \brief Counters of the file cache of an NBT command set.
+ */
+typedef struct
+{
+    /**
+     * \brief Number of reads answered from the file cache.
+     */
+    uint32_t hits;
+
+    /**
+     * \brief Number of reads that had to be sent to the tag.
+     */
+    uint32_t misses;
+
+    /**
+     * \brief Number of file images dropped because the file might have
+     * changed.
+     */
+    uint32_t invalidations;
+} nbt_file_cache_statistics_t;
+
 /**
  * \brief Generic NBT command set structure for building and performing NBT
  * commands.
@@ -107,6 +207,91 @@ typedef struct
      * \brief Private member holds an APDU error message map length.
      */
     uint8_t apdu_error_map_list_length;
+
+    /**
+     * \brief Private member holds the maximum number of bytes read per READ
+     * BINARY command by the NDEF functions.
+     * \details Set by nbt_negotiate_chunk_size(), \ref NBT_MAX_LE by default.
+     */
+    uint16_t read_chunk_size;
+
+    /**
+     * \brief Private member holds the maximum number of bytes written per
+     * UPDATE BINARY command by the NDEF functions.
+     * \details Set by nbt_negotiate_chunk_size(), \ref NBT_MAX_LC by default.
+     */
+    uint16_t update_chunk_size;
+
+    /**
+     * \brief Private member holds the optional NDEF progress callback.
+     * \details Set by nbt_set_ndef_progress(), \c NULL by default.
+     */
+    nbt_ndef_progress_t ndef_progress;
+
+    /**
+     * \brief Private member holds the context passed to \ref ndef_progress.
+     */
+    void *ndef_progress_context;
+
+    /**
+     * \brief Private member holds the FileID of the file selected last.
+     * \details \ref NBT_FILE_ID_NONE if unknown.
+     */
+    uint16_t selected_file_id;
+
+    /**
+     * \brief Private member indicating whether file images are cached.
+     * \details Set by nbt_set_file_cache(), \c false by default.
+     */
+    bool file_cache_enabled;
+
+    /**
+     * \brief Private member holds the cached file images.
+     */
+    nbt_file_cache_entry_t file_cache[NBT_FILE_CACHE_ENTRIES];
+
+    /**
+     * \brief Private member holds the index of the entry replaced next if the
+     * file cache is full.
+     */
+    uint8_t file_cache_victim;
+
+    /**
+     * \brief Private member holds the file cache counters.
+     */
+    nbt_file_cache_statistics_t file_cache_statistics;
+
+    /**
+     * \brief Private member indicating whether SELECT commands of the current
+     * selection are skipped.
+     * \details Set by nbt_set_select_elision(), \c false by default.
+     */
+    bool select_elision_enabled;
+
+    /**
+     * \brief Private member holds P1, P2 and data of the SELECT command of the
+     * currently selected application.
+     */
+    uint8_t selected_application[NBT_SELECT_RECORD_SIZE];
+
+    /**
+     * \brief Private member holds the number of bytes in \ref
+     * selected_application.
+     * \details \c 0 if the selected application is unknown.
+     */
+    uint8_t selected_application_length;
+
+    /**
+     * \brief Private member holds P1, P2 and data (including passwords) of the
+     * SELECT command of the currently selected file.
+     */
+    uint8_t selected_file[NBT_SELECT_RECORD_SIZE];
+
+    /**
+     * \brief Private member holds the number of bytes in \ref selected_file.
+     * \details \c 0 if the selected file is unknown.
+     */
+    uint8_t selected_file_length;
 } nbt_cmd_t;
 
 /**
@@ -137,6 +322,22 @@ ifx_status_t nbt_initialize(nbt_cmd_t *self, ifx_protocol_t *protocol,
  */
 void nbt_destroy(nbt_cmd_t *self);
 
+/**
+ * \brief Exchanges the command-APDU of the NBT command set with the NBT tag and
+ * stores the response-APDU in the command set.
+ *
+ * \details The tracked selection state is dropped if the exchange fails or the
+ * tag responds with any status word other than \c 0x9000.
+ *
+ * \param[in,out] self NBT command set object holding command and response.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ */
+ifx_status_t nbt_transceive(nbt_cmd_t *self);
+
 /**
  * \brief Returns the error message for last command executed by NBT command
  * set.
@@ -114,11 +114,51 @@ extern "C" {
  */
 #define NBT_UPDATE_RECURSIVE_BINARY        UINT8_C(0x13)
 
+/**
+ * \brief Identifier for command negotiate chunk size
+ */
+#define NBT_NEGOTIATE_CHUNK_SIZE           UINT8_C(0x14)
+
+/**
+ * \brief Identifier for command read NDEF message
+ */
+#define NBT_READ_NDEF                      UINT8_C(0x15)
+
+/**
+ * \brief Identifier for command set NDEF progress callback
+ */
+#define NBT_SET_NDEF_PROGRESS              UINT8_C(0x16)
+
+/**
+ * \brief Identifier for command differential NDEF update
+ */
+#define NBT_UPDATE_NDEF_DELTA              UINT8_C(0x17)
+
+/**
+ * \brief Identifier for command set file cache
+ */
+#define NBT_SET_FILE_CACHE                 UINT8_C(0x18)
+
+/**
+ * \brief Identifier for command get file cache statistics
+ */
+#define NBT_GET_FILE_CACHE_STATISTICS      UINT8_C(0x19)
+
+/**
+ * \brief Identifier for command set select elision
+ */
+#define NBT_SET_SELECT_ELISION             UINT8_C(0x1A)
+
 /**
  * \brief FileID of FAP file
  */
 #define NBT_FAP_FILE_ID                    UINT16_C(0xE1AF)
 
+/**
+ * \brief FileID of capability container (CC) file
+ */
+#define NBT_CC_FILE_ID                     UINT16_C(0xE103)
+
 /**
  * \brief FileID of NDEF file
  */
@@ -150,6 +190,22 @@ extern "C" {
  */
 #define NBT_MAX_LC                         UINT16_C(0x00FF)
 
+/**
+ * \brief Number of CC file bytes read by nbt_negotiate_chunk_size() (CCLEN,
+ * mapping version, MLe and MLc).
+ */
+#define NBT_CC_CHUNK_SIZE_LENGTH           UINT8_C(0x07)
+
+/**
+ * \brief Offset of MLe (maximum R-APDU data size) in CC file.
+ */
+#define NBT_CC_MLE_OFFSET                  UINT8_C(0x03)
+
+/**
+ * \brief Offset of MLc (maximum C-APDU data size) in CC file.
+ */
+#define NBT_CC_MLC_OFFSET                  UINT8_C(0x05)
+
 /**
  * \brief Masking for access condition byte with password protected
  */
@@ -178,6 +234,12 @@ extern "C" {
  */
 #define NBT_RECURSIVE_READ_INIT_MSG_LEN    UINT8_C(0xFF)
 
+/**
+ * \brief Maximum number of unchanged bytes between two changed byte ranges
+ * that are still written by the same UPDATE BINARY in nbt_ndef_update_delta().
+ */
+#define NBT_NDEF_DELTA_MAX_GAP             UINT8_C(0x20)
+
 /**
  * \brief Store the file access condition for both NFC and I2C (read/write
  * operation) interface with FileID.
@@ -317,6 +379,10 @@ ifx_status_t nbt_select_file_with_password(nbt_cmd_t *self, uint16_t file_id,
 /**
  * \brief Reads the binary data from the currently selected elementary file.
  *
+ * \details Lengths above 256 bytes are requested with an extended length Le
+ * field, which is only supported if nbt_negotiate_chunk_size() reported a
+ * larger \ref nbt_cmd_t::read_chunk_size.
+ *
  * \param[in,out] self Command set with communication protocol and response.
  * \param[in] offset Offset to read data from file
  * \param[in] binary_data_length Data length to be read from file.
@@ -327,11 +393,15 @@ ifx_status_t nbt_select_file_with_password(nbt_cmd_t *self, uint16_t file_id,
  * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
  */
 ifx_status_t nbt_read_binary(nbt_cmd_t *self, uint16_t offset,
-                             uint8_t binary_data_length);
+                             uint16_t binary_data_length);
 
 /**
  * \brief Updates the binary data into the currently selected elementary file.
  *
+ * \details More than 255 bytes are sent with an extended length Lc field,
+ * which is only supported if nbt_negotiate_chunk_size() reported a larger \ref
+ * nbt_cmd_t::update_chunk_size.
+ *
  * \param[in,out] self Command set with communication protocol and response.
  * \param[in] offset Offset from where data to be updated in file.
  * \param[in] data_length Length of the data to be updated in the file.
@@ -345,6 +415,27 @@ ifx_status_t nbt_read_binary(nbt_cmd_t *self, uint16_t offset,
 ifx_status_t nbt_update_binary(nbt_cmd_t *self, uint16_t offset,
                                uint32_t data_length, const uint8_t *data);
 
+/**
+ * \brief Negotiates the maximum number of bytes read or updated per APDU by
+ * the NDEF functions.
+ *
+ * \details Reads MLe and MLc from the capability container (CC) file and
+ * stores them as \ref nbt_cmd_t::read_chunk_size and \ref
+ * nbt_cmd_t::update_chunk_size. Values above 255 bytes enable extended length
+ * APDUs. If the CC file cannot be read the short length defaults are kept.
+ *
+ * Note: Application must be selected already with selectApplication() API
+ * before use this API. The CC file stays selected afterwards.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ */
+ifx_status_t nbt_negotiate_chunk_size(nbt_cmd_t *self);
+
 /**
  * \brief Changes an existing password with a new password. If the FAP file
  * update operation is password protected, the master password is required to
@@ -783,6 +874,52 @@ ifx_status_t nbt_pass_through_put_response(
     nbt_cmd_t *self, const ifx_apdu_response_t *pass_through_response_data,
     ifx_apdu_response_t *response);
 
+/**
+ * \brief Sets callback notified after every chunk of an NDEF message has been
+ * read or written.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] progress Progress callback (might be \c NULL to disable).
+ * \param[in] context Context passed to \p progress.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ */
+ifx_status_t nbt_set_ndef_progress(nbt_cmd_t *self,
+                                   nbt_ndef_progress_t progress,
+                                   void *context);
+
+/**
+ * \brief Reads NDEF message into a caller provided buffer.
+ *
+ * \details Performs the select file with password if available, reads the 2
+ * byte NLEN field and then reads the NDEF message chunk by chunk straight to
+ * its final offset in \p buffer. No memory is allocated for the message.
+ *
+ * Note: Application must be selected already with selectApplication() API
+ * before use this API.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] file_id FileID to select an NDEF file.
+ * \param[in] read_password  4-byte password for read operation (Optional-
+ * Null if not required).
+ * \param[out] buffer Buffer to store NDEF message in.
+ * \param[in] buffer_size Size of \p buffer in bytes.
+ * \param[out] ndef_len Buffer to store size of NDEF message in (also set if
+ * \p buffer is too small).
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful. Note that the status
+ * word in the response of the command set has to be checked as well.
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function or \p buffer is too small for the NDEF message
+ * \retval IFX_TOO_LITTLE_DATA : If file ends before the NDEF message
+ */
+ifx_status_t nbt_ndef_read_into(nbt_cmd_t *self, uint16_t file_id,
+                                const ifx_blob_t *read_password,
+                                uint8_t *buffer, size_t buffer_size,
+                                size_t *ndef_len);
+
 /**
  * \brief Reads NDEF file with password and return the NDEF message byte data.
  * Method performs the select file with password if available and then
@@ -866,6 +1003,11 @@ ifx_status_t nbt_ndef_read(nbt_cmd_t *self);
  * performs the select file with file_id and then update binary until data is
  * available.
  *
+ * \details NLEN is set to zero before and to the message length after the
+ * message has been written (NFC Forum Type 4 Tag update procedure), so readers
+ * never see a partially written message. The message is sent straight from
+ * \p ndef_bytes, which is not modified.
+ *
  * Note: Application must be selected already with selectApplication() API
  * before use this API
  *
@@ -882,7 +1024,7 @@ ifx_status_t nbt_ndef_read(nbt_cmd_t *self);
  */
 ifx_status_t nbt_ndef_update_with_id_password(nbt_cmd_t *self, uint16_t file_id,
                                               const ifx_blob_t *write_password,
-                                              ifx_blob_t *ndef_bytes);
+                                              const ifx_blob_t *ndef_bytes);
 
 /**
  * \brief  Updates the NDEF file with FileID. Method performs the select file
@@ -901,7 +1043,7 @@ ifx_status_t nbt_ndef_update_with_id_password(nbt_cmd_t *self, uint16_t file_id,
  * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
  */
 ifx_status_t nbt_ndef_update_with_id(nbt_cmd_t *self, uint16_t file_id,
-                                     ifx_blob_t *ndef_bytes);
+                                     const ifx_blob_t *ndef_bytes);
 
 /**
  * \brief Updates NDEF file with 4-byte password (Optional) and default NDEF
@@ -923,7 +1065,7 @@ ifx_status_t nbt_ndef_update_with_id(nbt_cmd_t *self, uint16_t file_id,
  */
 ifx_status_t nbt_ndef_update_with_password(nbt_cmd_t *self,
                                            const ifx_blob_t *write_password,
-                                           ifx_blob_t *ndef_bytes);
+                                           const ifx_blob_t *ndef_bytes);
 
 /**
  * \brief Updates NDEF file default ndef FileID (E104), Method performs the
@@ -940,7 +1082,148 @@ ifx_status_t nbt_ndef_update_with_password(nbt_cmd_t *self,
  * function
  * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
  */
-ifx_status_t nbt_ndef_update(nbt_cmd_t *self, ifx_blob_t *ndef_bytes);
+ifx_status_t nbt_ndef_update(nbt_cmd_t *self, const ifx_blob_t *ndef_bytes);
+
+/**
+ * \brief Updates NDEF file by writing only the bytes that differ from the
+ * previous NDEF message.
+ *
+ * \details Performs the select file with password if available and compares
+ * \p ndef_bytes with the message currently stored in the file. Changed byte
+ * ranges separated by at most \ref NBT_NDEF_DELTA_MAX_GAP unchanged bytes are
+ * coalesced into one UPDATE BINARY of at most the negotiated chunk size.
+ * Updates that need more than a single command are guarded by setting NLEN to
+ * zero first and writing the real NLEN last, just like
+ * nbt_ndef_update_with_id_password(). If the changes are scattered over more
+ * ranges than the whole message has chunks, the whole message is written.
+ *
+ * If \p previous is \c NULL the current message is read back from the file
+ * first. If it cannot be read (e.g. because of a read password) the whole
+ * message is written.
+ *
+ * Note: Application must be selected already with selectApplication() API
+ * before use this API.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] file_id FileID to select an NDEF file.
+ * \param[in] write_password 4-byte password for write operation (Optional-
+ * Null if not required).
+ * \param[in] previous NDEF message currently stored in the file (Optional-
+ * Null to read it back from the file).
+ * \param[in] ndef_bytes NDEF message to be written.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful. Note that the status
+ * word in the response of the command set has to be checked as well.
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ */
+ifx_status_t nbt_ndef_update_delta(nbt_cmd_t *self, uint16_t file_id,
+                                   const ifx_blob_t *write_password,
+                                   const ifx_blob_t *previous,
+                                   const ifx_blob_t *ndef_bytes);
+
+/**
+ * \brief Enables or disables the host-side cache of file images.
+ *
+ * \details If enabled, the images of up to \ref NBT_FILE_CACHE_ENTRIES files
+ * read by nbt_read_fap*() and nbt_ndef_read*() are kept, so that following
+ * reads of these files are answered without reading the file again. Images
+ * are dropped by UPDATE BINARY commands to the file and by nbt_ndef_update*().
+ * All images are dropped by FAP updates, password changes, pass-through
+ * commands and nbt_invalidate_file_cache().
+ *
+ * Note: Reads answered from the cache still select the file, so the tag checks
+ * the passwords sent with the SELECT command and the file stays selected
+ * afterwards. The read access conditions of the file are not checked again,
+ * so an image is only used if the file is selected with exactly the SELECT
+ * command (including passwords) it has been read with. Together with
+ * nbt_set_select_elision() repeated reads do not exchange any command.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] enabled \c true to cache file images, \c false to disable the
+ * cache and free all images.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ */
+ifx_status_t nbt_set_file_cache(nbt_cmd_t *self, bool enabled);
+
+/**
+ * \brief Drops all cached file images.
+ *
+ * \details To be called whenever files might have been changed by others,
+ * e.g. on NFC field detection or after resetting the tag. Must not be called
+ * concurrently with other functions using the same command set.
+ *
+ * \param[in,out] self Command set holding the file cache.
+ */
+void nbt_invalidate_file_cache(nbt_cmd_t *self);
+
+/**
+ * \brief Returns hit, miss and invalidation counters of the file cache.
+ *
+ * \param[in] self Command set holding the file cache.
+ * \param[out] statistics Buffer to store counters in.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ */
+ifx_status_t
+nbt_get_file_cache_statistics(const nbt_cmd_t *self,
+                              nbt_file_cache_statistics_t *statistics);
+
+/**
+ * \brief Enables or disables skipping SELECT commands of the current selection.
+ *
+ * \details The command set tracks the application and file (including the
+ * passwords used) selected last. If enabled, nbt_select_application(),
+ * nbt_select_file(), nbt_select_file_with_password() and all functions using
+ * them skip the SELECT command if it would select the same application or
+ * file with the same passwords again. Skipped SELECT commands are answered
+ * with an empty response and status word \c 0x9000.
+ *
+ * The tracked selection is dropped by failing commands and by selecting the
+ * configurator application. Resets of the tag (e.g. ifx_protocol_activate(),
+ * ifx_t1prime_s_swr() or ifx_t1prime_s_por()) happen below the command set.
+ * They drop the tracked selection if nbt_tag_reset_listener() is registered
+ * with the protocol stack (see ifx_t1prime_set_reset_listener()), otherwise
+ * nbt_invalidate_selection() has to be called after them.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] enabled \c true to skip SELECT commands of the application or
+ * file (with the same passwords) that is already selected.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ */
+ifx_status_t nbt_set_select_elision(nbt_cmd_t *self, bool enabled);
+
+/**
+ * \brief Forgets the tracked selection state of the tag.
+ *
+ * \details To be called after the tag has been reset, so that the next SELECT
+ * commands are sent to the tag again.
+ *
+ * \param[in,out] self Command set tracking the selection state.
+ */
+void nbt_invalidate_selection(nbt_cmd_t *self);
+
+/**
+ * \brief Reset listener forgetting the tracked selection state of the tag.
+ *
+ * \details Matches \c ifx_t1prime_reset_listener_t, so that resets of the
+ * tag drop the tracked selection by registering it with
+ * \c ifx_t1prime_set_reset_listener(&protocol, nbt_tag_reset_listener,
+ * &command_set).
+ *
+ * \param[in] command_set Command set (\c nbt_cmd_t) tracking the selection
+ * state.
+ */
+void nbt_tag_reset_listener(void *command_set);
 
 #ifdef __cplusplus
 }
@@ -123,6 +123,11 @@ extern "C" {
  */
 #define NBT_FAP_PARSE_ERROR                  UINT8_C(0x03)
 
+/**
+ * \brief Job queue of session manager device is full.
+ */
+#define NBT_SESSION_QUEUE_FULL               UINT8_C(0x04)
+
 /**
  * \brief APDU error message list
  */
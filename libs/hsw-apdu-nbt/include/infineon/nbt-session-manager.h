@@ -0,0 +1,254 @@
+// SPDX-FileCopyrightText: 2024 Infineon Technologies AG
+//
+// SPDX-License-Identifier: MIT
+
+/**
+ * \file infineon/nbt-session-manager.h
+ * \brief Session manager operating several NBT tags in parallel.
+ *
+ * \details Every registered tag (device) has its own command set, job queue and
+ * worker thread. Devices are assigned to buses and jobs of devices sharing a
+ * bus never run at the same time.
+ */
+#ifndef NBT_SESSION_MANAGER_H
+#define NBT_SESSION_MANAGER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "infineon/ifx-error.h"
+#include "infineon/nbt-apdu-lib.h"
+#include "infineon/nbt-apdu.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Function identifiers */
+
+/**
+ * \brief Identifier for session manager initialization
+ */
+#define NBT_SESSION_MANAGER_INITIALIZE     UINT8_C(0x01)
+
+/**
+ * \brief Identifier for adding device to session manager
+ */
+#define NBT_SESSION_MANAGER_ADD_DEVICE     UINT8_C(0x02)
+
+/**
+ * \brief Identifier for submitting job to session manager
+ */
+#define NBT_SESSION_MANAGER_SUBMIT         UINT8_C(0x03)
+
+/**
+ * \brief Identifier for waiting for jobs of session manager
+ */
+#define NBT_SESSION_MANAGER_WAIT           UINT8_C(0x04)
+
+/**
+ * \brief Identifier for reading statistics of session manager
+ */
+#define NBT_SESSION_MANAGER_GET_STATISTICS UINT8_C(0x05)
+
+/**
+ * \brief Device index selecting all devices in nbt_session_manager_wait().
+ */
+#define NBT_SESSION_ALL_DEVICES            SIZE_MAX
+
+/**
+ * \brief Job executed on the worker thread of a device.
+ *
+ * \param[in,out] cmd Command set of the device the job has been submitted for.
+ * \param[in] context Context given to nbt_session_manager_submit().
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other value counts
+ * the job as failed.
+ */
+typedef ifx_status_t (*nbt_session_job_t)(nbt_cmd_t *cmd, void *context);
+
+/**
+ * \brief Optional callback notified on the worker thread once a job has been
+ * executed.
+ *
+ * \details The bus is released before the callback is called, so it may submit
+ * follow-up jobs (e.g. verify after program). The device still counts as
+ * running while the callback is executed, so it must not wait for its own
+ * device or for \ref NBT_SESSION_ALL_DEVICES (nbt_session_manager_wait()
+ * rejects this with \c IFX_ILLEGAL_ARGUMENT instead of blocking forever).
+ *
+ * \param[in] device Index of the device the job has been executed on.
+ * \param[in] status Status returned by the job.
+ * \param[in] context Context given to nbt_session_manager_submit().
+ */
+typedef void (*nbt_session_done_t)(size_t device, ifx_status_t status,
+                                   void *context);
+
+/**
+ * \brief Queue depth and throughput of a device.
+ */
+typedef struct
+{
+    /**
+     * \brief Number of jobs currently waiting in the queue (not including a
+     * running job).
+     */
+    size_t queue_depth;
+
+    /**
+     * \brief Largest queue depth observed.
+     */
+    size_t max_queue_depth;
+
+    /**
+     * \brief Number of jobs that returned \c IFX_SUCCESS.
+     */
+    uint32_t jobs_completed;
+
+    /**
+     * \brief Number of jobs that returned an error.
+     */
+    uint32_t jobs_failed;
+
+    /**
+     * \brief Time in [us] spent executing jobs.
+     */
+    uint64_t busy_us;
+
+    /**
+     * \brief Time in [us] spent waiting for the bus to become free.
+     */
+    uint64_t bus_wait_us;
+
+    /**
+     * \brief Time in [us] since the device has been added or the statistics
+     * have been reset.
+     *
+     * \details Throughput in jobs per second is (jobs_completed + jobs_failed)
+     * * 1000000 / elapsed_us.
+     */
+    uint64_t elapsed_us;
+} nbt_session_statistics_t;
+
+/**
+ * \brief Session manager owning the worker threads of several NBT tags.
+ */
+typedef struct
+{
+    /**
+     * \brief Private member holding buses, devices and worker threads.
+     * \details Set by nbt_session_manager_initialize(). Do **NOT** set
+     * manually!.
+     */
+    void *_properties;
+} nbt_session_manager_t;
+
+/**
+ * \brief Initializes session manager.
+ *
+ * \param[out] self Session manager to be initialized.
+ * \param[in] bus_count Number of buses devices can be assigned to.
+ * \param[in] queue_capacity Maximum number of jobs queued per device.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ */
+ifx_status_t nbt_session_manager_initialize(nbt_session_manager_t *self,
+                                            size_t bus_count,
+                                            size_t queue_capacity);
+
+/**
+ * \brief Adds device and starts its worker thread.
+ *
+ * \details The command set (and its protocol stack) is used exclusively by the
+ * worker thread until nbt_session_manager_destroy() and must stay valid until
+ * then. Devices on separate buses run in parallel. Devices on the same bus
+ * (e.g. tags with different I2C addresses) take turns job by job, so jobs of
+ * such devices should be kept short.
+ *
+ * \param[in] self Session manager.
+ * \param[in] cmd Initialized command set of the device.
+ * \param[in] bus Index of the bus the device is connected to.
+ * \param[out] device Buffer to store index of the device in.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ * \retval IFX_UNSPECIFIED_ERROR : If worker thread cannot be started
+ */
+ifx_status_t nbt_session_manager_add_device(nbt_session_manager_t *self,
+                                            nbt_cmd_t *cmd, size_t bus,
+                                            size_t *device);
+
+/**
+ * \brief Queues job for a device.
+ *
+ * \details Jobs of a device are executed in order. This function does not
+ * block and may be called from any thread including job callbacks.
+ *
+ * \param[in] self Session manager.
+ * \param[in] device Index of the device to execute job on.
+ * \param[in] job Job to be executed.
+ * \param[in] context Context passed to \p job and \p done.
+ * \param[in] done Optional callback notified once the job has been executed
+ * (might be \c NULL).
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ * \retval NBT_SESSION_QUEUE_FULL : If queue of device is full
+ */
+ifx_status_t nbt_session_manager_submit(nbt_session_manager_t *self,
+                                        size_t device, nbt_session_job_t job,
+                                        void *context, nbt_session_done_t done);
+
+/**
+ * \brief Waits until all queued jobs of a device have been executed.
+ *
+ * \param[in] self Session manager.
+ * \param[in] device Index of the device to wait for or \ref
+ * NBT_SESSION_ALL_DEVICES.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function or if called from a job or done callback of \p device (or of any
+ * device for \ref NBT_SESSION_ALL_DEVICES)
+ */
+ifx_status_t nbt_session_manager_wait(nbt_session_manager_t *self,
+                                      size_t device);
+
+/**
+ * \brief Returns queue depth and throughput of a device.
+ *
+ * \param[in] self Session manager.
+ * \param[in] device Index of the device.
+ * \param[out] statistics Buffer to store statistics in.
+ * \param[in] reset Whether to reset counters afterwards.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ */
+ifx_status_t
+nbt_session_manager_get_statistics(nbt_session_manager_t *self, size_t device,
+                                   nbt_session_statistics_t *statistics,
+                                   bool reset);
+
+/**
+ * \brief Executes all queued jobs, stops the worker threads and releases the
+ * memory associated with session manager (but not object itself).
+ *
+ * \details The command sets of the devices are not destroyed.
+ *
+ * \param[in] self Session manager whose data shall be released.
+ */
+void nbt_session_manager_destroy(nbt_session_manager_t *self);
+
+#ifdef __cplusplus
+}
+
+#endif /* __cplusplus */
+#endif /* NBT_SESSION_MANAGER_H */
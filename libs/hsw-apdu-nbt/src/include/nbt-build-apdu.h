@@ -284,7 +284,7 @@ ifx_status_t build_select_file_with_password(uint16_t file_id,
  * function
  * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
  */
-ifx_status_t build_read_binary(uint16_t offset, uint8_t read_data_length,
+ifx_status_t build_read_binary(uint16_t offset, uint16_t read_data_length,
                                ifx_apdu_t *apdu);
 
 /**
@@ -302,7 +302,7 @@ ifx_status_t build_read_binary(uint16_t offset, uint8_t read_data_length,
  * function
  * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
  */
-ifx_status_t build_update_binary(uint16_t offset, uint8_t data_length,
+ifx_status_t build_update_binary(uint16_t offset, uint16_t data_length,
                                  const uint8_t *data, ifx_apdu_t *apdu);
 
 /**
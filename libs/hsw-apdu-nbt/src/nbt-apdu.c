@@ -9,6 +9,7 @@
 #include "infineon/nbt-apdu.h"
 
 #include "infineon/ifx-utils.h"
+#include "infineon/nbt-cmd.h"
 #include "infineon/nbt-errors.h"
 
 /**
@@ -56,9 +57,31 @@ ifx_status_t nbt_initialize(nbt_cmd_t *self, ifx_protocol_t *protocol,
         self->apdu = NULL;
         return IFX_ERROR(NBT_APDU, NBT_INIT, IFX_OUT_OF_MEMORY);
     }
+    IFX_MEMSET(self->apdu, 0, sizeof(ifx_apdu_t));
+    IFX_MEMSET(self->response, 0, sizeof(ifx_apdu_response_t));
 
     self->apdu_error_map_list = nbt_apdu_errors;
     self->apdu_error_map_list_length = NBT_MESSAGE_ERROR_COUNTS;
+    self->read_chunk_size = NBT_MAX_LE;
+    self->update_chunk_size = NBT_MAX_LC;
+    self->ndef_progress = NULL;
+    self->ndef_progress_context = NULL;
+    self->selected_file_id = NBT_FILE_ID_NONE;
+    self->file_cache_enabled = false;
+    for (uint8_t entry = 0U; entry < NBT_FILE_CACHE_ENTRIES; entry++)
+    {
+        self->file_cache[entry].file_id = NBT_FILE_ID_NONE;
+        self->file_cache[entry].data = NULL;
+        self->file_cache[entry].length = 0U;
+        self->file_cache[entry].size = 0U;
+        self->file_cache[entry].select_length = 0U;
+    }
+    self->file_cache_victim = 0U;
+    IFX_MEMSET(&self->file_cache_statistics, 0,
+               sizeof(self->file_cache_statistics));
+    self->select_elision_enabled = false;
+    self->selected_application_length = 0U;
+    self->selected_file_length = 0U;
 
     return IFX_SUCCESS;
 }
@@ -73,6 +96,7 @@ void nbt_destroy(nbt_cmd_t *self)
 {
     if (!IFX_VALIDATE_NULL_PTR_MEMORY(self))
     {
+        nbt_set_file_cache(self, false);
         IFX_FREE(self->apdu->data);
         IFX_FREE(self->apdu);
         IFX_FREE(self->response->data);
@@ -89,6 +113,34 @@ void nbt_destroy(nbt_cmd_t *self)
     }
 }
 
+/**
+ * \brief Exchanges the command-APDU of the NBT command set with the NBT tag and
+ * stores the response-APDU in the command set.
+ *
+ * \param[in,out] self NBT command set object holding command and response.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ */
+ifx_status_t nbt_transceive(nbt_cmd_t *self)
+{
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(self))
+    {
+        return IFX_ERROR(NBT_APDU, NBT_TRANSCEIVE, IFX_ILLEGAL_ARGUMENT);
+    }
+    ifx_status_t status = ifx_apdu_protocol_transceive(
+        self->protocol, self->apdu, self->response);
+
+    // Selection state of tag is unknown after failed commands
+    if (ifx_error_check(status) || !IFX_CHECK_SW_OK(self->response->sw))
+    {
+        nbt_invalidate_selection(self);
+    }
+    return status;
+}
+
 /**
  * \brief Returns the error message for last command executed by NBT command
  * set.
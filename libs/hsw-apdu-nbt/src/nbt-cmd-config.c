@@ -9,6 +9,7 @@
 #include "infineon/nbt-cmd-config.h"
 
 #include "infineon/nbt-apdu-lib.h"
+#include "infineon/nbt-cmd.h"
 #include "nbt-build-apdu-config.h"
 
 /**
@@ -30,6 +31,7 @@ ifx_status_t nbt_select_configurator_application(nbt_cmd_t *self)
                          IFX_ILLEGAL_ARGUMENT);
     }
 #endif
+    nbt_invalidate_selection(self);
     ifx_status_t status = build_select_configurator_application(self->apdu);
     if (ifx_error_check(status))
     {
@@ -39,8 +41,7 @@ ifx_status_t nbt_select_configurator_application(nbt_cmd_t *self)
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -89,8 +90,7 @@ ifx_status_t nbt_set_configuration_bytes(nbt_cmd_t *self, uint16_t config_tag,
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -141,8 +141,7 @@ ifx_status_t nbt_set_configuration(nbt_cmd_t *self, uint16_t config_tag,
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -185,8 +184,7 @@ ifx_status_t nbt_get_configuration(nbt_cmd_t *self, uint16_t config_tag)
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
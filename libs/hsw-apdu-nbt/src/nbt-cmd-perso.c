@@ -10,6 +10,7 @@
 
 #include "infineon/ifx-utils.h"
 #include "infineon/nbt-apdu-lib.h"
+#include "infineon/nbt-cmd.h"
 #include "nbt-build-apdu-perso.h"
 
 /**
@@ -36,6 +37,9 @@ ifx_status_t nbt_finalize_personalization(nbt_cmd_t *self)
     }
 #endif
 
+    // Applet state changes when personalization is finalized
+    nbt_invalidate_selection(self);
+
     ifx_status_t status = build_finalize_personalization(self->apdu);
     if (ifx_error_check(status))
     {
@@ -44,8 +48,7 @@ ifx_status_t nbt_finalize_personalization(nbt_cmd_t *self)
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -82,6 +85,9 @@ ifx_status_t nbt_personalize_data(nbt_cmd_t *self, uint16_t dgi,
     }
 #endif
 
+    // Personalization data might replace file contents
+    nbt_invalidate_file_cache(self);
+
     ifx_status_t status = build_personalize_data(dgi, dgi_data, self->apdu);
     if (ifx_error_check(status))
     {
@@ -90,8 +96,7 @@ ifx_status_t nbt_personalize_data(nbt_cmd_t *self, uint16_t dgi,
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -157,8 +162,7 @@ ifx_status_t nbt_backend_test(nbt_cmd_t *self, uint8_t test_request)
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -200,8 +204,7 @@ ifx_status_t nbt_backend_test_disable(nbt_cmd_t *self)
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
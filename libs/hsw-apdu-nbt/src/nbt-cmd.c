@@ -38,6 +38,22 @@
  */
 #define NBT_INS_BYTE_OFFSET UINT8_C(1)
 
+/**
+ * \brief Length of NLEN field at the beginning of an NDEF file.
+ */
+#define NBT_NLEN_LENGTH     UINT8_C(2)
+
+/**
+ * \brief Status word of responses answered without exchanging a command.
+ */
+#define NBT_SW_SUCCESS      UINT16_C(0x9000)
+
+/**
+ * \brief Number of bytes (P1 and P2) preceding the data of a tracked SELECT
+ * command.
+ */
+#define NBT_SELECT_HEADER   UINT8_C(2)
+
 /**
  * \brief Sends APDU of pass-through put response to secure element reads back
  * its APDU response.
@@ -88,22 +104,24 @@ static ifx_status_t pass_through_apdu_tranceive(ifx_protocol_t *self,
         // Log transmitted data
         NBT_APDU_LOG_BYTES(self->_logger, NBT_CMD_LOG_TAG, IFX_LOG_INFO, ">> ",
                            apdu_bytes->buffer, apdu_bytes->length, " ");
-        // Decode APDU response
-        status =
-            ifx_apdu_response_decode(response, response_buffer, response_len);
+        // Log before decoding as response buffer is handed over to response
+        if (response_len >= 2U)
+        {
+            NBT_APDU_LOG_BYTES(self->_logger, NBT_CMD_LOG_TAG, IFX_LOG_INFO,
+                               "<< ", response_buffer, response_len, " ");
+        }
+
+        // Decode APDU response without copying response data
+        status = ifx_apdu_response_decode_take(response, response_buffer,
+                                               response_len);
         if (status != IFX_SUCCESS)
         {
             NBT_APDU_LOG_BYTES(self->_logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
                                "received invalid APDU response: ",
                                response_buffer, response_len, " ");
+            IFX_FREE(response_buffer);
+            response_buffer = NULL;
         }
-        else
-        {
-            NBT_APDU_LOG_BYTES(self->_logger, NBT_CMD_LOG_TAG, IFX_LOG_INFO,
-                               "<< ", response_buffer, response_len, " ");
-        }
-        IFX_FREE(response_buffer);
-        response_buffer = NULL;
     }
 
     return status;
@@ -155,6 +173,233 @@ static ifx_status_t fap_encode(const nbt_file_access_policy_t *fap_policy,
     return IFX_SUCCESS;
 }
 
+/**
+ * \brief Looks up image of the selected file in file cache and updates
+ * hit/miss counters.
+ *
+ * \details Images are only returned if \p file_id has been selected with
+ * exactly the SELECT command (including passwords) the image has been read
+ * with. The tag only checks the passwords of the SELECT command but not the
+ * access conditions of the skipped READ BINARY commands, so images must only
+ * be stored after successful reads.
+ *
+ * \param[in,out] self Command set holding the file cache.
+ * \param[in] file_id FileID of file to look up.
+ * \return const nbt_file_cache_entry_t* Cached file image or \c NULL if the
+ * file is not cached for its current selection (or the file cache is
+ * disabled).
+ */
+static const nbt_file_cache_entry_t *file_cache_lookup(nbt_cmd_t *self,
+                                                       uint16_t file_id)
+{
+    if (!self->file_cache_enabled)
+    {
+        return NULL;
+    }
+    if ((self->selected_file_id == file_id) &&
+        (self->selected_file_length > 0U))
+    {
+        for (uint8_t index = 0U; index < NBT_FILE_CACHE_ENTRIES; index++)
+        {
+            const nbt_file_cache_entry_t *entry = &self->file_cache[index];
+            if ((entry->file_id == file_id) &&
+                (entry->select_length == self->selected_file_length) &&
+                (IFX_MEMCMP(entry->select, self->selected_file,
+                            entry->select_length) == 0))
+            {
+                self->file_cache_statistics.hits++;
+                return entry;
+            }
+        }
+    }
+    self->file_cache_statistics.misses++;
+    return NULL;
+}
+
+/**
+ * \brief Drops cached image of file because it might have changed.
+ *
+ * \details The buffer of the entry is kept to be reused by the next image.
+ *
+ * \param[in,out] self Command set holding the file cache.
+ * \param[in] file_id FileID of file to drop (\ref NBT_FILE_ID_NONE drops all
+ * files).
+ */
+static void file_cache_invalidate(nbt_cmd_t *self, uint16_t file_id)
+{
+    for (uint8_t index = 0U; index < NBT_FILE_CACHE_ENTRIES; index++)
+    {
+        nbt_file_cache_entry_t *entry = &self->file_cache[index];
+        if ((entry->file_id != NBT_FILE_ID_NONE) &&
+            ((file_id == NBT_FILE_ID_NONE) || (entry->file_id == file_id)))
+        {
+            entry->file_id = NBT_FILE_ID_NONE;
+            self->file_cache_statistics.invalidations++;
+        }
+    }
+}
+
+/**
+ * \brief Stores image of file in file cache (if enabled).
+ *
+ * \details The image is stored together with the SELECT command \p file_id
+ * is currently selected with and must have been read with READ BINARY
+ * commands under this selection. Replaces the image of the same file, an unused
+ * entry or the oldest entry in this order. If no memory is available or the
+ * selection is not tracked the file is just not cached.
+ *
+ * \param[in,out] self Command set holding the file cache.
+ * \param[in] file_id FileID of file.
+ * \param[in] data File image to be stored.
+ * \param[in] length Number of bytes in \p data.
+ */
+static void file_cache_store(nbt_cmd_t *self, uint16_t file_id,
+                             const uint8_t *data, size_t length)
+{
+    if (!self->file_cache_enabled || (self->selected_file_id != file_id) ||
+        (self->selected_file_length == 0U))
+    {
+        return;
+    }
+    nbt_file_cache_entry_t *entry = NULL;
+    for (uint8_t index = 0U;
+         (index < NBT_FILE_CACHE_ENTRIES) && (entry == NULL); index++)
+    {
+        if (self->file_cache[index].file_id == file_id)
+        {
+            entry = &self->file_cache[index];
+        }
+    }
+    for (uint8_t index = 0U;
+         (index < NBT_FILE_CACHE_ENTRIES) && (entry == NULL); index++)
+    {
+        if (self->file_cache[index].file_id == NBT_FILE_ID_NONE)
+        {
+            entry = &self->file_cache[index];
+        }
+    }
+    if (entry == NULL)
+    {
+        entry = &self->file_cache[self->file_cache_victim];
+        self->file_cache_victim =
+            (uint8_t) ((self->file_cache_victim + 1U) % NBT_FILE_CACHE_ENTRIES);
+    }
+    entry->file_id = NBT_FILE_ID_NONE;
+    if (entry->size < length)
+    {
+        uint8_t *grown = (uint8_t *) realloc(entry->data, length);
+        if (grown == NULL)
+        {
+            return;
+        }
+        entry->data = grown;
+        entry->size = length;
+    }
+    if (length > 0U)
+    {
+        IFX_MEMCPY(entry->data, data, length);
+    }
+    entry->length = length;
+    IFX_MEMCPY(entry->select, self->selected_file, self->selected_file_length);
+    entry->select_length = self->selected_file_length;
+    entry->file_id = file_id;
+}
+
+/**
+ * \brief Answers read from cached file image by copying it into the response
+ * of the command set.
+ *
+ * \param[in,out] self Command set with response.
+ * \param[in] entry Cached file image.
+ * \param[in] function_id Function identifier used for error reporting.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ */
+static ifx_status_t file_cache_respond(nbt_cmd_t *self,
+                                       const nbt_file_cache_entry_t *entry,
+                                       uint8_t function_id)
+{
+    ifx_apdu_response_destroy(self->response);
+    if (entry->length > 0U)
+    {
+        self->response->data = (uint8_t *) malloc(entry->length);
+        if (IFX_VALIDATE_NULL_PTR_MEMORY(self->response->data))
+        {
+            return IFX_ERROR(NBT_CMD, function_id, IFX_OUT_OF_MEMORY);
+        }
+        IFX_MEMCPY(self->response->data, entry->data, entry->length);
+    }
+    self->response->len = entry->length;
+    self->response->sw = NBT_SW_SUCCESS;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Sends SELECT command of command set unless it matches the tracked
+ * selection of the tag.
+ *
+ * \details The selection is tracked by P1, P2 and data of the SELECT command,
+ * so that file selections with different passwords are not considered equal.
+ * Skipped SELECT commands are answered with an empty response and status word
+ * \c 0x9000.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ */
+static ifx_status_t select_transceive(nbt_cmd_t *self)
+{
+    bool application = (self->apdu->p1 == NBT_P1_SELECT_BY_DF);
+    uint8_t *record = self->selected_file;
+    uint8_t *record_length = &self->selected_file_length;
+    if (application)
+    {
+        record = self->selected_application;
+        record_length = &self->selected_application_length;
+    }
+    size_t length = NBT_SELECT_HEADER + self->apdu->lc;
+    if (self->select_elision_enabled && (*record_length == length) &&
+        (record[0] == self->apdu->p1) && (record[1] == self->apdu->p2) &&
+        ((self->apdu->lc == 0U) ||
+         (IFX_MEMCMP(record + NBT_SELECT_HEADER, self->apdu->data,
+                     self->apdu->lc) == 0)))
+    {
+        ifx_apdu_response_destroy(self->response);
+        self->response->sw = NBT_SW_SUCCESS;
+        return IFX_SUCCESS;
+    }
+
+    ifx_status_t status = nbt_transceive(self);
+    if (ifx_error_check(status) || !IFX_CHECK_SW_OK(self->response->sw))
+    {
+        return status;
+    }
+
+    // Selecting an application deselects the current file
+    if (application)
+    {
+        self->selected_file_length = 0U;
+        self->selected_file_id = NBT_FILE_ID_NONE;
+    }
+    *record_length = 0U;
+    if (length <= NBT_SELECT_RECORD_SIZE)
+    {
+        record[0] = self->apdu->p1;
+        record[1] = self->apdu->p2;
+        if (self->apdu->lc > 0U)
+        {
+            IFX_MEMCPY(record + NBT_SELECT_HEADER, self->apdu->data,
+                       self->apdu->lc);
+        }
+        *record_length = (uint8_t) length;
+    }
+    return status;
+}
+
 /**
  * \brief Selects the NBT application.
  *
@@ -182,8 +427,7 @@ ifx_status_t nbt_select_application(nbt_cmd_t *self)
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = select_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -214,6 +458,7 @@ ifx_status_t nbt_select_file(nbt_cmd_t *self, uint16_t file_id)
     }
 #endif
 
+    self->selected_file_id = NBT_FILE_ID_NONE;
     ifx_status_t status = build_select_file(file_id, self->apdu);
     if (ifx_error_check(status))
     {
@@ -222,13 +467,16 @@ ifx_status_t nbt_select_file(nbt_cmd_t *self, uint16_t file_id)
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = select_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
                          "apdu transceive error");
         }
+        else if (IFX_CHECK_SW_OK(self->response->sw))
+        {
+            self->selected_file_id = file_id;
+        }
     }
 
     return status;
@@ -260,6 +508,7 @@ ifx_status_t nbt_select_file_with_password(nbt_cmd_t *self, uint16_t file_id,
     }
 #endif
 
+    self->selected_file_id = NBT_FILE_ID_NONE;
     ifx_status_t status = build_select_file_with_password(
         file_id, read_password, write_password, self->apdu);
     if (ifx_error_check(status))
@@ -269,13 +518,16 @@ ifx_status_t nbt_select_file_with_password(nbt_cmd_t *self, uint16_t file_id,
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = select_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
                          "apdu transceive error");
         }
+        else if (IFX_CHECK_SW_OK(self->response->sw))
+        {
+            self->selected_file_id = file_id;
+        }
     }
 
     return status;
@@ -294,7 +546,7 @@ ifx_status_t nbt_select_file_with_password(nbt_cmd_t *self, uint16_t file_id,
  * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
  */
 ifx_status_t nbt_read_binary(nbt_cmd_t *self, uint16_t offset,
-                             uint8_t binary_data_length)
+                             uint16_t binary_data_length)
 {
 #if (IFX_VALIDATE_NULL_PTR)
     if (IFX_VALIDATE_NULL_PTR_MEMORY(self))
@@ -312,8 +564,7 @@ ifx_status_t nbt_read_binary(nbt_cmd_t *self, uint16_t offset,
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -347,8 +598,17 @@ ifx_status_t nbt_update_binary(nbt_cmd_t *self, uint16_t offset,
     }
 #endif
 
+    // Extended length Lc field holds at most 2 bytes
+    if (data_length > UINT16_MAX)
+    {
+        return IFX_ERROR(NBT_CMD, NBT_UPDATE_BINARY, IFX_ILLEGAL_ARGUMENT);
+    }
+
+    // Cached image of selected file (or of any file if unknown) gets stale
+    file_cache_invalidate(self, self->selected_file_id);
+
     ifx_status_t status =
-        build_update_binary(offset, data_length, data, self->apdu);
+        build_update_binary(offset, (uint16_t) data_length, data, self->apdu);
     if (ifx_error_check(status))
     {
         NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -356,8 +616,7 @@ ifx_status_t nbt_update_binary(nbt_cmd_t *self, uint16_t offset,
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -368,6 +627,60 @@ ifx_status_t nbt_update_binary(nbt_cmd_t *self, uint16_t offset,
     return status;
 }
 
+/**
+ * \brief Negotiates the maximum number of bytes read or updated per APDU by
+ * the NDEF functions.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ */
+ifx_status_t nbt_negotiate_chunk_size(nbt_cmd_t *self)
+{
+#if (IFX_VALIDATE_NULL_PTR)
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(self))
+    {
+        return IFX_ERROR(NBT_CMD, NBT_NEGOTIATE_CHUNK_SIZE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+#endif
+
+    // Read CCLEN, mapping version, MLe and MLc from CC file
+    ifx_status_t status = nbt_select_file(self, NBT_CC_FILE_ID);
+    if (ifx_error_check(status) || !IFX_CHECK_SW_OK(self->response->sw))
+    {
+        return status;
+    }
+    status = nbt_read_binary(self, 0x0000, NBT_CC_CHUNK_SIZE_LENGTH);
+    if (ifx_error_check(status) || !IFX_CHECK_SW_OK(self->response->sw) ||
+        (self->response->len < NBT_CC_CHUNK_SIZE_LENGTH))
+    {
+        NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
+                     "CC file unreadable, keeping short length APDUs");
+        return status;
+    }
+
+    const uint8_t *mle = self->response->data + NBT_CC_MLE_OFFSET;
+    const uint8_t *mlc = self->response->data + NBT_CC_MLC_OFFSET;
+    uint16_t max_le;
+    uint16_t max_lc;
+    IFX_READ_U16(mle, max_le);
+    IFX_READ_U16(mlc, max_lc);
+    if ((max_le > 0U) && (max_lc > 0U))
+    {
+        self->read_chunk_size = max_le;
+        self->update_chunk_size = max_lc;
+    }
+    NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_INFO,
+                 "chunk size read: %u update: %u",
+                 (unsigned) self->read_chunk_size,
+                 (unsigned) self->update_chunk_size);
+    return status;
+}
+
 /**
  * \brief Changes an existing password with a new password. If the FAP file
  * update operation is password protected, the master password is required to
@@ -404,8 +717,9 @@ ifx_status_t nbt_change_password(nbt_cmd_t *self, uint8_t pwd_id,
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        // Cached images might have been read with a changed password
+        file_cache_invalidate(self, NBT_FILE_ID_NONE);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -449,8 +763,7 @@ ifx_status_t nbt_unblock_password(nbt_cmd_t *self, uint8_t pwd_id,
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -490,8 +803,7 @@ ifx_status_t nbt_authenticate_tag(nbt_cmd_t *self, const ifx_blob_t *challenge)
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = nbt_transceive(self);
 
         if (ifx_error_check(status))
         {
@@ -546,8 +858,9 @@ ifx_status_t nbt_create_password(nbt_cmd_t *self,
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        // Cached images might have been read with a changed password
+        file_cache_invalidate(self, NBT_FILE_ID_NONE);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -594,8 +907,9 @@ ifx_status_t nbt_delete_password(nbt_cmd_t *self,
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        // Cached images might have been read with a changed password
+        file_cache_invalidate(self, NBT_FILE_ID_NONE);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -637,8 +951,7 @@ ifx_status_t nbt_get_data(nbt_cmd_t *self, uint16_t get_data_rcp)
     }
     else
     {
-        status = ifx_apdu_protocol_transceive(self->protocol, self->apdu,
-                                              self->response);
+        status = nbt_transceive(self);
         if (ifx_error_check(status))
         {
             NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
@@ -850,6 +1163,9 @@ ifx_status_t nbt_update_fap_bytes_with_password(
     }
 #endif
 
+    // Access conditions of any cached file might change
+    file_cache_invalidate(self, NBT_FILE_ID_NONE);
+
     ifx_status_t status = IFX_SUCCESS;
 
     if (master_password != NULL)
@@ -1096,6 +1412,13 @@ ifx_status_t nbt_read_fap_bytes_with_password(nbt_cmd_t *self,
 
     if (!ifx_error_check(status) && IFX_CHECK_SW_OK(self->response->sw))
     {
+        const nbt_file_cache_entry_t *cached =
+            file_cache_lookup(self, NBT_FAP_FILE_ID);
+        if (cached != NULL)
+        {
+            return file_cache_respond(self, cached, NBT_READ_FAP_WITH_PASSWORD);
+        }
+
         /* If the current selected file is FAP file, then the offset other than
          * ‘0000’ will be ignored by applet. */
         IFX_FREE(self->apdu->data);
@@ -1103,6 +1426,11 @@ ifx_status_t nbt_read_fap_bytes_with_password(nbt_cmd_t *self,
         self->apdu->data = NULL;
         self->response->data = NULL;
         status = nbt_read_binary(self, 0x0000, NBT_SIZE_OF_FAP_FILE);
+        if (!ifx_error_check(status) && IFX_CHECK_SW_OK(self->response->sw))
+        {
+            file_cache_store(self, NBT_FAP_FILE_ID, self->response->data,
+                             self->response->len);
+        }
     }
 
     return status;
@@ -1139,6 +1467,9 @@ ifx_status_t nbt_pass_through_fetch_data(nbt_cmd_t *self,
     }
 #endif
 
+    // NFC side is active and might change files
+    file_cache_invalidate(self, NBT_FILE_ID_NONE);
+
     ifx_status_t status = build_pass_through_fetch_data(self->apdu);
     if (ifx_error_check(status))
     {
@@ -1376,216 +1707,500 @@ ifx_status_t nbt_pass_through_put_response(
 }
 
 /**
- * \brief  Append new response to existing response. This method is useful if
- * the response dat has to be concatenated from the content of multiple APDU
- * responses (GET RESPONSE). The status word of the existing response will be
- * replaced by the status word of the new response.
+ * \brief Reads NDEF message from the currently selected file chunk by chunk.
  *
- * \param[in,out] self Reference to existing response on which response should
- * append.
- * \param[in] response New response to be appended to existing response.
+ * \details The first READ BINARY returns the 2 byte NLEN field followed by the
+ * start of the NDEF message. The message buffer is then allocated once (if not
+ * provided by the caller) and every following READ BINARY response is copied
+ * straight to its final offset.
+ *
+ * \param[in,out] self NBT command set object. Its response holds the last
+ * READ BINARY response afterwards.
+ * \param[in,out] buffer Buffer to store NDEF message in. If \c NULL a buffer of
+ * NLEN bytes is allocated which has to be freed by the caller (stays \c NULL
+ * for empty messages).
+ * \param[in] buffer_size Size of caller provided \p buffer in bytes.
+ * \param[out] ndef_len Buffer to store size of NDEF message in.
  * \return ifx_status_t
- * \retval IFX_SUCCESS : If API operation is successful
- * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
- * function
+ * \retval IFX_SUCCESS : If API operation is successful (status word of
+ * response has to be checked as well)
+ * \retval IFX_ILLEGAL_ARGUMENT : If caller provided buffer is too small
+ * \retval IFX_TOO_LITTLE_DATA : If file ends before the NDEF message
  * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
  */
-static ifx_status_t append_apdu_response(ifx_apdu_response_t *self,
-                                         const ifx_apdu_response_t *response)
+static ifx_status_t ndef_read_chunks(nbt_cmd_t *self, uint8_t **buffer,
+                                     size_t buffer_size, size_t *ndef_len)
 {
-    // Validate parameters
-#if (IFX_VALIDATE_NULL_PTR)
-    if ((self == NULL) || (response == NULL))
+    *ndef_len = 0U;
+
+    // First chunk starts with NLEN
+    uint16_t chunk_size = NBT_RECURSIVE_READ_INIT_MSG_LEN;
+    if (self->read_chunk_size < chunk_size)
     {
-        return IFX_ERROR(LIB_APDU, IFX_APDU_DECODE, IFX_ILLEGAL_ARGUMENT);
+        chunk_size = self->read_chunk_size;
     }
-#endif
-    if (response->len < 2)
+    ifx_status_t status =
+        nbt_read_binary(self, NBT_RECURSIVE_READ_INIT_OFFSET, chunk_size);
+    if (ifx_error_check(status) || !IFX_CHECK_SW_OK(self->response->sw))
+    {
+        return status;
+    }
+    if (self->response->len < NBT_NLEN_LENGTH)
     {
-        return IFX_ERROR(LIB_APDU, IFX_APDU_DECODE, IFX_ILLEGAL_ARGUMENT);
+        return IFX_ERROR(NBT_CMD, NBT_READ_NDEF, IFX_TOO_LITTLE_DATA);
     }
+    uint16_t nlen;
+    IFX_READ_U16(self->response->data, nlen);
 
-    // Append response data and overwrite status word of existing response.
-    uint8_t *buffer_temp = (uint8_t *) malloc(self->len);
-    if (buffer_temp == NULL)
+    // Message buffer is allocated once with the final size
+    bool allocated = false;
+    if (*buffer == NULL)
     {
-        return IFX_ERROR(LIB_APDU, IFX_APDU_RESPONSE_ENCODE, IFX_OUT_OF_MEMORY);
+        if (nlen > 0U)
+        {
+            *buffer = (uint8_t *) malloc(nlen);
+            if (*buffer == NULL)
+            {
+                return IFX_ERROR(NBT_CMD, NBT_READ_NDEF, IFX_OUT_OF_MEMORY);
+            }
+            allocated = true;
+        }
     }
-    IFX_MEMCPY(buffer_temp, self->data, self->len);
-    self->data = (uint8_t *) malloc(self->len + response->len);
-    if (self->data == NULL)
+    else if (buffer_size < nlen)
     {
-        IFX_FREE(buffer_temp);
-        buffer_temp = NULL;
-        return IFX_ERROR(LIB_APDU, IFX_APDU_RESPONSE_ENCODE, IFX_OUT_OF_MEMORY);
+        *ndef_len = nlen;
+        return IFX_ERROR(NBT_CMD, NBT_READ_NDEF, IFX_ILLEGAL_ARGUMENT);
     }
-    IFX_MEMCPY(self->data, buffer_temp, self->len);
-    IFX_MEMCPY(self->data + self->len, response->data, response->len);
-    self->len = self->len + response->len;
-    self->sw = response->sw;
-    IFX_FREE(buffer_temp);
-    buffer_temp = NULL;
-    return IFX_SUCCESS;
+
+    size_t received = self->response->len - NBT_NLEN_LENGTH;
+    if (received > nlen)
+    {
+        received = nlen;
+    }
+    if (received > 0U)
+    {
+        IFX_MEMCPY(*buffer, self->response->data + NBT_NLEN_LENGTH, received);
+    }
+    while (true)
+    {
+        if (self->ndef_progress != NULL)
+        {
+            self->ndef_progress(received, nlen, self->ndef_progress_context);
+        }
+        if (received >= nlen)
+        {
+            break;
+        }
+
+        // Read next chunk straight behind already received data
+        size_t remaining = nlen - received;
+        chunk_size = (remaining > self->read_chunk_size)
+                         ? self->read_chunk_size
+                         : (uint16_t) remaining;
+        ifx_apdu_response_destroy(self->response);
+        status = nbt_read_binary(
+            self, (uint16_t) (NBT_NLEN_LENGTH + received), chunk_size);
+        if (!ifx_error_check(status) && IFX_CHECK_SW_OK(self->response->sw) &&
+            (self->response->len == 0U))
+        {
+            status = IFX_ERROR(NBT_CMD, NBT_READ_NDEF, IFX_TOO_LITTLE_DATA);
+        }
+        if (ifx_error_check(status) || !IFX_CHECK_SW_OK(self->response->sw))
+        {
+            if (allocated)
+            {
+                IFX_FREE(*buffer);
+                *buffer = NULL;
+            }
+            return status;
+        }
+        size_t copied =
+            (self->response->len > remaining) ? remaining : self->response->len;
+        IFX_MEMCPY(*buffer + received, self->response->data, copied);
+        received += copied;
+    }
+    *ndef_len = nlen;
+    return status;
 }
 
 /**
- * \brief Method to perform readv binary command in recursive pattern. In first
- * time call to method user has to pass offset from where file has to read.
- *
+ * \brief Selects NDEF file with optional read password.
  *
- * \param[in,out] self NBT command set object, which will contains NDEF
- *                     message bytes including status word after successfully
- *                     read message.
- * \param[in] offset  Offset value from where start reading the binary file, we
- *                    can use micros NBT_RECURSIVE_READ_INIT_OFFSET.
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] file_id FileID to select an NDEF file.
+ * \param[in] read_password  4-byte password for read operation (Optional-
+ * Null if not required).
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ */
+static ifx_status_t ndef_select_for_read(nbt_cmd_t *self, uint16_t file_id,
+                                         const ifx_blob_t *read_password)
+{
+    /* check read password, if read password is NULL then select file with id
+    without read password, otherwise select file with read password */
+    if (read_password != NULL)
+    {
+        /* select ndef file for read operation with read password. passing NULL
+         * as write password */
+        return nbt_select_file_with_password(self, file_id, read_password,
+                                             NULL);
+    }
+    return nbt_select_file(self, file_id);
+}
+
+/**
+ * \brief Sends UPDATE BINARY command with data borrowed from the caller.
  *
- * \param[in] total_bytes_to_read Size of data to be read from file including
- *                                the total bytes field, we can use micros
- *                                NBT_RECURSIVE_READ_INIT_MSG_LEN.
+ * \details Unlike nbt_update_binary() the data is not copied into the command
+ * set's APDU but encoded straight from \p data. The APDU header stays set
+ * afterwards so that nbt_error_message_get() still works.
  *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] offset Offset from where data to be updated in file.
+ * \param[in] data Data to be updated in the file.
+ * \param[in] data_length Number of bytes in \p data.
  * \return ifx_status_t
  * \retval IFX_SUCCESS : If API operation is successful
  * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
  * function
  * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
  */
-static ifx_status_t recursive_ndef_read(nbt_cmd_t *self, uint16_t offset,
-                                        uint16_t total_bytes_to_read)
+static ifx_status_t ndef_update_chunk(nbt_cmd_t *self, uint16_t offset,
+                                      const uint8_t *data, uint16_t data_length)
 {
-    uint16_t total_bytes_remains_to_read = total_bytes_to_read - offset;
-    ifx_status_t status =
-        nbt_read_binary(self, offset,
-                        (total_bytes_remains_to_read > NBT_MAX_LE)
-                            ? NBT_MAX_LE
-                            : total_bytes_remains_to_read);
-    ifx_apdu_response_t response = *(self->response);
-
-    if (ifx_error_check(status) || !IFX_CHECK_SW_OK(self->response->sw))
+    ifx_apdu_destroy(self->apdu);
+    self->apdu->cla = NBT_CLA;
+    self->apdu->ins = NBT_INS_UPDATE_BINARY;
+    IFX_GET_UPPER_BYTE(self->apdu->p1, offset);
+    IFX_GET_LOWER_BYTE(self->apdu->p2, offset);
+    self->apdu->lc = data_length;
+    self->apdu->data = (uint8_t *) data;
+    self->apdu->le = NBT_LE_ABSENT;
+    ifx_status_t status = nbt_transceive(self);
+
+    // Never leave borrowed data in APDU of command set
+    self->apdu->data = NULL;
+    self->apdu->lc = 0U;
+    if (ifx_error_check(status))
     {
-        return status;
+        NBT_APDU_LOG(self->logger, NBT_CMD_LOG_TAG, IFX_LOG_ERROR,
+                     "apdu transceive error");
     }
+    return status;
+}
 
-    // Calculate total bytes to be read from first two bytes of NDEF file.
-    if (offset == 0x00)
+/**
+ * \brief Writes NDEF message to the currently selected file chunk by chunk.
+ *
+ * \details Follows the NFC Forum Type 4 Tag update procedure: NLEN is set to
+ * zero first, then the message is written behind it and the real NLEN is
+ * written last, so readers never see a partially written message. Chunks are
+ * sent straight from \p message. Messages fitting into a single UPDATE BINARY
+ * command together with NLEN are written at once.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] message NDEF message to be written (without NLEN).
+ * \param[in] message_len Number of bytes in \p message.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful (status word of
+ * response has to be checked as well)
+ * \retval IFX_ILLEGAL_ARGUMENT : If message does not fit into a file
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ */
+static ifx_status_t ndef_write_chunks(nbt_cmd_t *self, const uint8_t *message,
+                                      size_t message_len)
+{
+    if (message_len > (UINT16_MAX - NBT_NLEN_LENGTH))
     {
-        // Update the total_bytes_to_read with first 2 bytes from file.
-        IFX_READ_U16(self->response->data, total_bytes_to_read);
+        return IFX_ERROR(NBT_CMD, NBT_UPDATE_RECURSIVE_BINARY,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    uint8_t nlen[NBT_NLEN_LENGTH];
+    uint16_t total = (uint16_t) message_len;
+    size_t file_len = message_len + NBT_NLEN_LENGTH;
 
-        uint16_t data_length = (uint16_t) (response.len - 2);
-        // If NDEF message size is less than the response length.
-        if (total_bytes_to_read < (response.len))
+    // Short messages are written with NLEN in a single command
+    if ((file_len <= NBT_MAX_LC) && (file_len <= self->update_chunk_size))
+    {
+        uint8_t file[NBT_MAX_LC];
+        IFX_UPDATE_U16(file, total);
+        if (message_len > 0U)
         {
-            data_length = (total_bytes_to_read);
+            IFX_MEMCPY(file + NBT_NLEN_LENGTH, message, message_len);
         }
-
-        // Shift all data by 2-byte left in response data.
-        IFX_MEMCPY(response.data, response.data + 2U, data_length);
-
-        // Calculate next iteration expected length and offset.
-        offset = offset + (uint16_t) (data_length + 2U);
-        response.len = data_length;
-        // +2 for adding 2 bytes of length
-        total_bytes_to_read += 0x02;
+        ifx_status_t status =
+            ndef_update_chunk(self, NBT_RECURSIVE_UPDATE_INIT_OFFSET, file,
+                              (uint16_t) file_len);
+        if (!ifx_error_check(status) && IFX_CHECK_SW_OK(self->response->sw) &&
+            (self->ndef_progress != NULL))
+        {
+            self->ndef_progress(message_len, message_len,
+                                self->ndef_progress_context);
+        }
+        return status;
     }
-    else
+
+    // Invalidate message while it is being written
+    IFX_UPDATE_U16(nlen, 0U);
+    ifx_status_t status = ndef_update_chunk(
+        self, NBT_RECURSIVE_UPDATE_INIT_OFFSET, nlen, NBT_NLEN_LENGTH);
+    size_t written = 0U;
+    while (!ifx_error_check(status) && IFX_CHECK_SW_OK(self->response->sw))
     {
-        // Calculate next iteration expected length and offset.
-        offset = offset + (uint16_t) (self->response->len);
+        if (self->ndef_progress != NULL)
+        {
+            self->ndef_progress(written, message_len,
+                                self->ndef_progress_context);
+        }
+        if (written >= message_len)
+        {
+            break;
+        }
+        size_t remaining = message_len - written;
+        uint16_t chunk_size = (remaining > self->update_chunk_size)
+                                  ? self->update_chunk_size
+                                  : (uint16_t) remaining;
+        ifx_apdu_response_destroy(self->response);
+        status = ndef_update_chunk(self, (uint16_t) (NBT_NLEN_LENGTH + written),
+                                   message + written, chunk_size);
+        written += chunk_size;
     }
-    if (total_bytes_to_read > offset)
+    if (ifx_error_check(status) || !IFX_CHECK_SW_OK(self->response->sw))
     {
-        recursive_ndef_read(self, offset, total_bytes_to_read);
-        append_apdu_response(&response, self->response);
+        return status;
     }
-    *(self->response) = response;
 
-    return status;
+    // Publish message by writing real NLEN last
+    IFX_UPDATE_U16(nlen, total);
+    ifx_apdu_response_destroy(self->response);
+    return ndef_update_chunk(self, NBT_RECURSIVE_UPDATE_INIT_OFFSET, nlen,
+                             NBT_NLEN_LENGTH);
 }
 
 /**
- * \brief Method to perform update binary command in recursive pattern. In first
- * time call to method user has to pass offset from where file has to start
- * write data.
- *
- *
- * \param[in,out] self NBT command set object, which will status word after
- *                     success.
- * \param[in] offset  Offset value from where start writing the binary file, we
- *                    can use micros RECURSIVE_WRITE_INIT_OFFSET.
- * \param[in] ndef_bytes NDEF data bytes to be write. ndef_bytes should without
- *                       NDEF length method will inside calculate ndef length
- *                       and add to file internally.
+ * \brief Selects NDEF file with optional write password.
  *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] file_id FileID to select an NDEF file.
+ * \param[in] write_password  4-byte password for write operation (Optional-
+ * Null if not required).
  * \return ifx_status_t
  * \retval IFX_SUCCESS : If API operation is successful
  * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
  * function
  * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
  */
-static ifx_status_t recursive_ndef_update(nbt_cmd_t *self, uint16_t offset,
-                                          ifx_blob_t *ndef_bytes)
+static ifx_status_t ndef_select_for_write(nbt_cmd_t *self, uint16_t file_id,
+                                          const ifx_blob_t *write_password)
 {
-    ifx_status_t status;
-    // Validate data is null.
-#if (IFX_VALIDATE_NULL_PTR)
-    if (IFX_VALIDATE_NULL_PTR_BLOB(ndef_bytes))
+    /* Check write password, if write password is NULL then select file with
+    id without write password, otherwise select file with write password. */
+    if (write_password != NULL)
     {
-        return IFX_ERROR(NBT_CMD, NBT_UPDATE_RECURSIVE_BINARY,
-                         IFX_ILLEGAL_ARGUMENT);
+        /* Select NDEF file for write operation with write password. Passing
+         * NULL as read password. */
+        return nbt_select_file_with_password(self, file_id, NULL,
+                                             write_password);
     }
-#endif
+    return nbt_select_file(self, file_id);
+}
 
-    // Adding file size at the beginning of file data.
-    if (offset == 0)
+/**
+ * \brief Finds next range of NDEF message bytes that differ from the previous
+ * message.
+ *
+ * \details Changed bytes separated by at most \ref NBT_NDEF_DELTA_MAX_GAP
+ * unchanged bytes are coalesced into one range as long as the range fits into
+ * a single UPDATE BINARY. Bytes behind the end of the previous message always
+ * count as changed.
+ *
+ * \param[in] self Command set holding the negotiated chunk size.
+ * \param[in] previous Previous NDEF message.
+ * \param[in] previous_len Number of bytes in \p previous.
+ * \param[in] message New NDEF message.
+ * \param[in] message_len Number of bytes in \p message.
+ * \param[in] from Offset in \p message to start searching at.
+ * \param[out] start Buffer to store offset of range in \p message in.
+ * \param[out] length Buffer to store number of bytes in range in.
+ * \return bool \c true if a changed range has been found.
+ */
+static bool ndef_next_delta_range(const nbt_cmd_t *self,
+                                  const uint8_t *previous, size_t previous_len,
+                                  const uint8_t *message, size_t message_len,
+                                  size_t from, size_t *start, size_t *length)
+{
+    // Skip unchanged bytes
+    size_t offset = from;
+    while ((offset < message_len) && (offset < previous_len) &&
+           (previous[offset] == message[offset]))
+    {
+        offset++;
+    }
+    if (offset >= message_len)
     {
-        // fap_content.length, fap_content.buffer
+        return false;
+    }
 
-        uint8_t *buffer_data = (uint8_t *) malloc(ndef_bytes->length + 2);
-        if (buffer_data == NULL)
+    // Extend range over further changes until gap or chunk size is exceeded
+    size_t end = offset + 1U;
+    for (size_t next = end; (next < message_len) &&
+                            ((next - offset) < self->update_chunk_size);
+         next++)
+    {
+        if ((next >= previous_len) || (previous[next] != message[next]))
         {
-            return IFX_ERROR(NBT_CMD, NBT_UPDATE_RECURSIVE_BINARY,
-                             IFX_OUT_OF_MEMORY);
+            end = next + 1U;
         }
-        // Adding 2 bytes NLEN in buffer.
-        IFX_UPDATE_U16(buffer_data, (ndef_bytes->length));
-        IFX_MEMCPY(buffer_data + 2U, ndef_bytes->buffer, ndef_bytes->length);
+        else if ((next - end) >= NBT_NDEF_DELTA_MAX_GAP)
+        {
+            break;
+        }
+    }
+    *start = offset;
+    *length = end - offset;
+    return true;
+}
 
-        // Update buffer size including 2 bytes NLEN field
-        ndef_bytes->length = ndef_bytes->length + 2;
+/**
+ * \brief Writes only the bytes of an NDEF message that differ from the previous
+ * message stored in the currently selected file.
+ *
+ * \details Updates consisting of a single UPDATE BINARY command are written
+ * directly. All other updates set NLEN to zero first and write the real NLEN
+ * last, so readers never see a partially updated message. If the changes are
+ * scattered over more ranges than the whole message has chunks, the whole
+ * message is written instead.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] previous NDEF message currently stored in the file.
+ * \param[in] previous_len Number of bytes in \p previous.
+ * \param[in] message NDEF message to be written (without NLEN).
+ * \param[in] message_len Number of bytes in \p message.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful (status word of
+ * response has to be checked as well)
+ * \retval IFX_ILLEGAL_ARGUMENT : If message does not fit into a file
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ */
+static ifx_status_t ndef_write_delta(nbt_cmd_t *self, const uint8_t *previous,
+                                     size_t previous_len,
+                                     const uint8_t *message,
+                                     size_t message_len)
+{
+    if (message_len > (UINT16_MAX - NBT_NLEN_LENGTH))
+    {
+        return IFX_ERROR(NBT_CMD, NBT_UPDATE_NDEF_DELTA, IFX_ILLEGAL_ARGUMENT);
+    }
 
-        // Copy updated data to ndef_bytes
-        ndef_bytes->buffer = (uint8_t *) malloc(ndef_bytes->length);
-        if (ndef_bytes->buffer == NULL)
+    // Count commands needed before writing anything
+    size_t ranges = 0U;
+    size_t first_start = 0U;
+    size_t first_end = 0U;
+    size_t start;
+    size_t length;
+    size_t offset = 0U;
+    while (ndef_next_delta_range(self, previous, previous_len, message,
+                                 message_len, offset, &start, &length))
+    {
+        if (ranges == 0U)
         {
-            return IFX_ERROR(NBT_CMD, NBT_UPDATE_RECURSIVE_BINARY,
-                             IFX_OUT_OF_MEMORY);
+            first_start = start;
+            first_end = start + length;
         }
-        IFX_MEMCPY(ndef_bytes->buffer, buffer_data, ndef_bytes->length);
-        IFX_FREE(buffer_data);
-        buffer_data = NULL;
+        offset = start + length;
+        ranges++;
     }
 
-    // Extracting block of NDEF message to be updated.
-    uint32_t total_remaining_data_size = ndef_bytes->length - offset;
-    uint32_t block_size = (total_remaining_data_size > NBT_MAX_LC)
-                              ? NBT_MAX_LC
-                              : total_remaining_data_size;
+    // Scattered changes are cheaper to write as a whole
+    size_t full_chunks = (message_len + self->update_chunk_size - 1U) /
+                         self->update_chunk_size;
+    if (ranges > full_chunks)
+    {
+        return ndef_write_chunks(self, message, message_len);
+    }
+    bool nlen_changed = (previous_len != message_len);
+    uint8_t nlen[NBT_NLEN_LENGTH];
+    IFX_UPDATE_U16(nlen, (uint16_t) message_len);
 
-    // Update the sub set of data.
-    status = nbt_update_binary(self, offset, block_size,
-                               ndef_bytes->buffer + offset);
-    if (ifx_error_check(status) || !(IFX_CHECK_SW_OK(self->response->sw)))
+    // Single command updates cannot be torn
+    ifx_status_t status = IFX_SUCCESS;
+    bool single = true;
+    if ((ranges == 0U) && nlen_changed)
     {
+        ifx_apdu_response_destroy(self->response);
+        status = ndef_update_chunk(self, NBT_RECURSIVE_UPDATE_INIT_OFFSET, nlen,
+                                   NBT_NLEN_LENGTH);
+    }
+    else if ((ranges == 1U) && !nlen_changed)
+    {
+        ifx_apdu_response_destroy(self->response);
+        status = ndef_update_chunk(
+            self, (uint16_t) (NBT_NLEN_LENGTH + first_start),
+            message + first_start, (uint16_t) (first_end - first_start));
+    }
+    else if ((ranges == 1U) && (first_start <= NBT_NDEF_DELTA_MAX_GAP) &&
+             ((first_end + NBT_NLEN_LENGTH) <= NBT_MAX_LC) &&
+             ((first_end + NBT_NLEN_LENGTH) <= self->update_chunk_size))
+    {
+        // Changes close to start of message are written together with NLEN
+        uint8_t file[NBT_MAX_LC];
+        IFX_MEMCPY(file, nlen, NBT_NLEN_LENGTH);
+        IFX_MEMCPY(file + NBT_NLEN_LENGTH, message, first_end);
+        ifx_apdu_response_destroy(self->response);
+        status = ndef_update_chunk(self, NBT_RECURSIVE_UPDATE_INIT_OFFSET, file,
+                                   (uint16_t) (first_end + NBT_NLEN_LENGTH));
+    }
+    else if (ranges > 0U)
+    {
+        single = false;
+    }
+    if (single)
+    {
+        if (!ifx_error_check(status) && IFX_CHECK_SW_OK(self->response->sw) &&
+            (self->ndef_progress != NULL))
+        {
+            self->ndef_progress(message_len, message_len,
+                                self->ndef_progress_context);
+        }
         return status;
     }
-    // Calculate next iteration expected offset and total remaining data size.
-    offset = (short) (offset + block_size);
-    total_remaining_data_size = ndef_bytes->length - offset;
-    if (total_remaining_data_size > 0)
+
+    // Invalidate message while it is being updated (unless already empty)
+    if (previous_len > 0U)
     {
-        status = recursive_ndef_update(self, offset, ndef_bytes);
+        uint8_t empty[NBT_NLEN_LENGTH] = {0U, 0U};
+        ifx_apdu_response_destroy(self->response);
+        status = ndef_update_chunk(self, NBT_RECURSIVE_UPDATE_INIT_OFFSET,
+                                   empty, NBT_NLEN_LENGTH);
     }
-    return status;
+    offset = 0U;
+    while (!ifx_error_check(status) && IFX_CHECK_SW_OK(self->response->sw) &&
+           ndef_next_delta_range(self, previous, previous_len, message,
+                                 message_len, offset, &start, &length))
+    {
+        ifx_apdu_response_destroy(self->response);
+        status = ndef_update_chunk(self, (uint16_t) (NBT_NLEN_LENGTH + start),
+                                   message + start, (uint16_t) length);
+        offset = start + length;
+        if (!ifx_error_check(status) && IFX_CHECK_SW_OK(self->response->sw) &&
+            (self->ndef_progress != NULL))
+        {
+            self->ndef_progress(offset, message_len,
+                                self->ndef_progress_context);
+        }
+    }
+    if (ifx_error_check(status) || !IFX_CHECK_SW_OK(self->response->sw))
+    {
+        return status;
+    }
+
+    // Publish message by writing real NLEN last
+    ifx_apdu_response_destroy(self->response);
+    return ndef_update_chunk(self, NBT_RECURSIVE_UPDATE_INIT_OFFSET, nlen,
+                             NBT_NLEN_LENGTH);
 }
 
 /**
@@ -1609,27 +2224,20 @@ static ifx_status_t recursive_ndef_update(nbt_cmd_t *self, uint16_t offset,
  */
 ifx_status_t nbt_ndef_update_with_id_password(nbt_cmd_t *self, uint16_t file_id,
                                               const ifx_blob_t *write_password,
-                                              ifx_blob_t *ndef_bytes)
+                                              const ifx_blob_t *ndef_bytes)
 {
-    ifx_status_t status;
-
-    /* Check read password, if read password is NULL then select file with id
-    without read password, otherwise select file with read password. */
-    if (write_password != NULL)
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(ndef_bytes) ||
+        ((ndef_bytes->buffer == NULL) && (ndef_bytes->length > 0U)))
     {
-        /* Select NDEF file for read operation with read password. Passing NULL
-         * as write password. */
-        status =
-            nbt_select_file_with_password(self, file_id, NULL, write_password);
-    }
-    else
-    {
-        status = nbt_select_file(self, file_id);
+        return IFX_ERROR(NBT_CMD, NBT_UPDATE_RECURSIVE_BINARY,
+                         IFX_ILLEGAL_ARGUMENT);
     }
+    file_cache_invalidate(self, file_id);
+    ifx_status_t status = ndef_select_for_write(self, file_id, write_password);
     if (!ifx_error_check(status) && IFX_CHECK_SW_OK(self->response->sw))
     {
-        status = recursive_ndef_update(self, NBT_RECURSIVE_UPDATE_INIT_OFFSET,
-                                       ndef_bytes);
+        status = ndef_write_chunks(self, ndef_bytes->buffer,
+                                   ndef_bytes->length);
     }
     return status;
 }
@@ -1651,7 +2259,7 @@ ifx_status_t nbt_ndef_update_with_id_password(nbt_cmd_t *self, uint16_t file_id,
  * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
  */
 ifx_status_t nbt_ndef_update_with_id(nbt_cmd_t *self, uint16_t file_id,
-                                     ifx_blob_t *ndef_bytes)
+                                     const ifx_blob_t *ndef_bytes)
 {
     return nbt_ndef_update_with_id_password(self, file_id, NULL, ndef_bytes);
 }
@@ -1676,7 +2284,7 @@ ifx_status_t nbt_ndef_update_with_id(nbt_cmd_t *self, uint16_t file_id,
  */
 ifx_status_t nbt_ndef_update_with_password(nbt_cmd_t *self,
                                            const ifx_blob_t *write_password,
-                                           ifx_blob_t *ndef_bytes)
+                                           const ifx_blob_t *ndef_bytes)
 {
     return nbt_ndef_update_with_id_password(self, NBT_NDEF_FILE_ID,
                                             write_password, ndef_bytes);
@@ -1697,12 +2305,314 @@ ifx_status_t nbt_ndef_update_with_password(nbt_cmd_t *self,
  * function
  * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
  */
-ifx_status_t nbt_ndef_update(nbt_cmd_t *self, ifx_blob_t *ndef_bytes)
+ifx_status_t nbt_ndef_update(nbt_cmd_t *self, const ifx_blob_t *ndef_bytes)
 {
     return nbt_ndef_update_with_id_password(self, NBT_NDEF_FILE_ID, NULL,
                                             ndef_bytes);
 }
 
+/**
+ * \brief Updates NDEF file by writing only the bytes that differ from the
+ * previous NDEF message.
+ *
+ * Note: Application must be selected already with selectApplication() API
+ * before use this API.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] file_id FileID to select an NDEF file.
+ * \param[in] write_password 4-byte password for write operation (Optional-
+ * Null if not required).
+ * \param[in] previous NDEF message currently stored in the file (Optional-
+ * Null to read it back from the file).
+ * \param[in] ndef_bytes NDEF message to be written.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful. Note that the status
+ * word in the response of the command set has to be checked as well.
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ */
+ifx_status_t nbt_ndef_update_delta(nbt_cmd_t *self, uint16_t file_id,
+                                   const ifx_blob_t *write_password,
+                                   const ifx_blob_t *previous,
+                                   const ifx_blob_t *ndef_bytes)
+{
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(self) ||
+        IFX_VALIDATE_NULL_PTR_MEMORY(ndef_bytes) ||
+        ((ndef_bytes->buffer == NULL) && (ndef_bytes->length > 0U)) ||
+        ((previous != NULL) && (previous->buffer == NULL) &&
+         (previous->length > 0U)))
+    {
+        return IFX_ERROR(NBT_CMD, NBT_UPDATE_NDEF_DELTA, IFX_ILLEGAL_ARGUMENT);
+    }
+    ifx_status_t status = ndef_select_for_write(self, file_id, write_password);
+    if (ifx_error_check(status) || !IFX_CHECK_SW_OK(self->response->sw))
+    {
+        return status;
+    }
+
+    // Previous message is known by caller, cached or read back from the file
+    const uint8_t *known = NULL;
+    size_t known_len = 0U;
+    bool readable = true;
+    uint8_t *current = NULL;
+    const nbt_file_cache_entry_t *cached = NULL;
+    if (previous == NULL)
+    {
+        cached = file_cache_lookup(self, file_id);
+    }
+    if (previous != NULL)
+    {
+        known = previous->buffer;
+        known_len = previous->length;
+    }
+    else if (cached != NULL)
+    {
+        known = cached->data;
+        known_len = cached->length;
+    }
+    else
+    {
+        // Read back current message without reporting progress for it
+        nbt_ndef_progress_t progress = self->ndef_progress;
+        self->ndef_progress = NULL;
+        status = ndef_read_chunks(self, &current, 0U, &known_len);
+        self->ndef_progress = progress;
+        if ((status != IFX_ERROR(NBT_CMD, NBT_READ_NDEF,
+                                 IFX_TOO_LITTLE_DATA)) &&
+            ifx_error_check(status))
+        {
+            return status;
+        }
+        readable =
+            !ifx_error_check(status) && IFX_CHECK_SW_OK(self->response->sw);
+        known = current;
+        ifx_apdu_response_destroy(self->response);
+    }
+
+    // Unreadable message is written completely
+    if (readable)
+    {
+        status = ndef_write_delta(self, known, known_len, ndef_bytes->buffer,
+                                  ndef_bytes->length);
+    }
+    else
+    {
+        status = ndef_write_chunks(self, ndef_bytes->buffer,
+                                   ndef_bytes->length);
+    }
+    IFX_FREE(current);
+    current = NULL;
+
+    // Written images might not be readable with the selection used for writing
+    file_cache_invalidate(self, file_id);
+    return status;
+}
+
+/**
+ * \brief Enables or disables the host-side cache of file images.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] enabled \c true to cache file images, \c false to disable the
+ * cache and free all images.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ */
+ifx_status_t nbt_set_file_cache(nbt_cmd_t *self, bool enabled)
+{
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(self))
+    {
+        return IFX_ERROR(NBT_CMD, NBT_SET_FILE_CACHE, IFX_ILLEGAL_ARGUMENT);
+    }
+    if (!enabled)
+    {
+        for (uint8_t index = 0U; index < NBT_FILE_CACHE_ENTRIES; index++)
+        {
+            nbt_file_cache_entry_t *entry = &self->file_cache[index];
+            IFX_FREE(entry->data);
+            entry->data = NULL;
+            entry->file_id = NBT_FILE_ID_NONE;
+            entry->length = 0U;
+            entry->size = 0U;
+            entry->select_length = 0U;
+        }
+    }
+    self->file_cache_enabled = enabled;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Drops all cached file images.
+ *
+ * \param[in,out] self Command set holding the file cache.
+ */
+void nbt_invalidate_file_cache(nbt_cmd_t *self)
+{
+    if (!IFX_VALIDATE_NULL_PTR_MEMORY(self))
+    {
+        file_cache_invalidate(self, NBT_FILE_ID_NONE);
+    }
+}
+
+/**
+ * \brief Returns hit, miss and invalidation counters of the file cache.
+ *
+ * \param[in] self Command set holding the file cache.
+ * \param[out] statistics Buffer to store counters in.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ */
+ifx_status_t
+nbt_get_file_cache_statistics(const nbt_cmd_t *self,
+                              nbt_file_cache_statistics_t *statistics)
+{
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(self) ||
+        IFX_VALIDATE_NULL_PTR_MEMORY(statistics))
+    {
+        return IFX_ERROR(NBT_CMD, NBT_GET_FILE_CACHE_STATISTICS,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    *statistics = self->file_cache_statistics;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Enables or disables skipping SELECT commands of the current selection.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] enabled \c true to skip SELECT commands of the application or
+ * file (with the same passwords) that is already selected.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ */
+ifx_status_t nbt_set_select_elision(nbt_cmd_t *self, bool enabled)
+{
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(self))
+    {
+        return IFX_ERROR(NBT_CMD, NBT_SET_SELECT_ELISION, IFX_ILLEGAL_ARGUMENT);
+    }
+    self->select_elision_enabled = enabled;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Forgets the tracked selection state of the tag.
+ *
+ * \param[in,out] self Command set tracking the selection state.
+ */
+void nbt_invalidate_selection(nbt_cmd_t *self)
+{
+    if (!IFX_VALIDATE_NULL_PTR_MEMORY(self))
+    {
+        self->selected_application_length = 0U;
+        self->selected_file_length = 0U;
+        self->selected_file_id = NBT_FILE_ID_NONE;
+    }
+}
+
+/**
+ * \brief Reset listener forgetting the tracked selection state of the tag.
+ *
+ * \param[in] command_set Command set (\c nbt_cmd_t) tracking the selection
+ * state.
+ */
+void nbt_tag_reset_listener(void *command_set)
+{
+    nbt_invalidate_selection((nbt_cmd_t *) command_set);
+}
+
+/**
+ * \brief Sets callback notified after every chunk of an NDEF message has been
+ * read or written.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] progress Progress callback (might be \c NULL to disable).
+ * \param[in] context Context passed to \p progress.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ */
+ifx_status_t nbt_set_ndef_progress(nbt_cmd_t *self,
+                                   nbt_ndef_progress_t progress,
+                                   void *context)
+{
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(self))
+    {
+        return IFX_ERROR(NBT_CMD, NBT_SET_NDEF_PROGRESS, IFX_ILLEGAL_ARGUMENT);
+    }
+    self->ndef_progress = progress;
+    self->ndef_progress_context = context;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Reads NDEF message into a caller provided buffer.
+ *
+ * \param[in,out] self Command set with communication protocol and response.
+ * \param[in] file_id FileID to select an NDEF file.
+ * \param[in] read_password  4-byte password for read operation (Optional-
+ * Null if not required).
+ * \param[out] buffer Buffer to store NDEF message in.
+ * \param[in] buffer_size Size of \p buffer in bytes.
+ * \param[out] ndef_len Buffer to store size of NDEF message in (also set if
+ * \p buffer is too small).
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful. Note that the status
+ * word in the response of the command set has to be checked as well.
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function or \p buffer is too small for the NDEF message
+ * \retval IFX_TOO_LITTLE_DATA : If file ends before the NDEF message
+ */
+ifx_status_t nbt_ndef_read_into(nbt_cmd_t *self, uint16_t file_id,
+                                const ifx_blob_t *read_password,
+                                uint8_t *buffer, size_t buffer_size,
+                                size_t *ndef_len)
+{
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(self) ||
+        IFX_VALIDATE_NULL_PTR_MEMORY(buffer) ||
+        IFX_VALIDATE_NULL_PTR_MEMORY(ndef_len))
+    {
+        return IFX_ERROR(NBT_CMD, NBT_READ_NDEF, IFX_ILLEGAL_ARGUMENT);
+    }
+    *ndef_len = 0U;
+
+    ifx_status_t status = ndef_select_for_read(self, file_id, read_password);
+    if (ifx_error_check(status) || !IFX_CHECK_SW_OK(self->response->sw))
+    {
+        return status;
+    }
+
+    const nbt_file_cache_entry_t *cached = file_cache_lookup(self, file_id);
+    if (cached != NULL)
+    {
+        *ndef_len = cached->length;
+        if (buffer_size < cached->length)
+        {
+            return IFX_ERROR(NBT_CMD, NBT_READ_NDEF, IFX_ILLEGAL_ARGUMENT);
+        }
+        if (cached->length > 0U)
+        {
+            IFX_MEMCPY(buffer, cached->data, cached->length);
+        }
+        ifx_apdu_response_destroy(self->response);
+        self->response->sw = NBT_SW_SUCCESS;
+        return IFX_SUCCESS;
+    }
+    status = ndef_read_chunks(self, &buffer, buffer_size, ndef_len);
+    if (!ifx_error_check(status) && IFX_CHECK_SW_OK(self->response->sw))
+    {
+        file_cache_store(self, file_id, buffer, *ndef_len);
+    }
+    return status;
+}
+
 /**
  * \brief Reads NDEF file with password and return the NDEF message byte data.
  * Method performs the select file with password if available and then
@@ -1724,31 +2634,34 @@ ifx_status_t nbt_ndef_update(nbt_cmd_t *self, ifx_blob_t *ndef_bytes)
 ifx_status_t nbt_ndef_read_with_id_password(nbt_cmd_t *self, uint16_t file_id,
                                             const ifx_blob_t *read_password)
 {
-    ifx_status_t status;
-
-    /* check read password, if read password is NULL then select file with id
-    without read password, otherwise select file with read password */
-    if (read_password != NULL)
+    ifx_status_t status = ndef_select_for_read(self, file_id, read_password);
+    if (ifx_error_check(status) || !IFX_CHECK_SW_OK(self->response->sw))
     {
-        /* select ndef file for read operation with read password. passing NULL
-         * as write password */
-        status =
-            nbt_select_file_with_password(self, file_id, read_password, NULL);
+        return status;
     }
-    else
+
+    const nbt_file_cache_entry_t *cached = file_cache_lookup(self, file_id);
+    if (cached != NULL)
     {
-        status = nbt_select_file(self, file_id);
+        return file_cache_respond(self, cached, NBT_READ_NDEF);
     }
 
+    uint8_t *message = NULL;
+    size_t message_len = 0U;
+    status = ndef_read_chunks(self, &message, 0U, &message_len);
     if (!ifx_error_check(status) && IFX_CHECK_SW_OK(self->response->sw))
     {
-        status = recursive_ndef_read(self, NBT_RECURSIVE_READ_INIT_OFFSET,
-                                     NBT_MAX_LE);
+        // Hand over message buffer to response of command set
+        uint16_t sw = self->response->sw;
+        ifx_apdu_response_destroy(self->response);
+        self->response->data = message;
+        self->response->len = message_len;
+        self->response->sw = sw;
+        file_cache_store(self, file_id, message, message_len);
     }
 
     return status;
 }
-
 /**
  * \brief Reads NDEF file and return the NDEF message byte data.
  * Method performs the select file and then read binary until data is available
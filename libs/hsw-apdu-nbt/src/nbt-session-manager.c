@@ -0,0 +1,702 @@
+// SPDX-FileCopyrightText: 2024 Infineon Technologies AG
+//
+// SPDX-License-Identifier: MIT
+
+/**
+ * \file nbt-session-manager.c
+ * \brief Session manager operating several NBT tags in parallel.
+ */
+#define _POSIX_C_SOURCE 200112L
+
+#include "infineon/nbt-session-manager.h"
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#include "infineon/ifx-utils.h"
+#include "infineon/nbt-errors.h"
+
+/**
+ * \brief Queued job of a device.
+ */
+typedef struct
+{
+    /**
+     * \brief Job to be executed.
+     */
+    nbt_session_job_t job;
+
+    /**
+     * \brief Context passed to job and done.
+     */
+    void *context;
+
+    /**
+     * \brief Optional callback notified once the job has been executed.
+     */
+    nbt_session_done_t done;
+} nbt_session_entry_t;
+
+/**
+ * \brief Forward declaration of session manager state.
+ */
+typedef struct nbt_session_state nbt_session_state_t;
+
+/**
+ * \brief Device with its command set, job queue and worker thread.
+ */
+typedef struct
+{
+    /**
+     * \brief Index of the device in the session manager.
+     */
+    size_t index;
+
+    /**
+     * \brief Command set exclusively used by the worker thread.
+     */
+    nbt_cmd_t *cmd;
+
+    /**
+     * \brief Lock serialising jobs of all devices on the same bus.
+     */
+    pthread_mutex_t *bus;
+
+    /**
+     * \brief Session manager counting pending jobs of all devices.
+     */
+    nbt_session_state_t *manager;
+
+    /**
+     * \brief Worker thread executing the jobs.
+     */
+    pthread_t thread;
+
+    /**
+     * \brief Lock protecting all members below.
+     */
+    pthread_mutex_t lock;
+
+    /**
+     * \brief Signalled whenever a job has been queued or executed and when
+     * the worker shall stop.
+     */
+    pthread_cond_t changed;
+
+    /**
+     * \brief Ring buffer of queued jobs.
+     */
+    nbt_session_entry_t *queue;
+
+    /**
+     * \brief Number of entries in queue.
+     */
+    size_t capacity;
+
+    /**
+     * \brief Index of the next job to be executed.
+     */
+    size_t head;
+
+    /**
+     * \brief Number of queued jobs.
+     */
+    size_t count;
+
+    /**
+     * \brief Whether a job is currently being executed.
+     */
+    bool running;
+
+    /**
+     * \brief Whether the worker shall stop once the queue is empty.
+     */
+    bool stop;
+
+    /**
+     * \brief Time of monotonic clock in [us] statistics have been reset at.
+     */
+    uint64_t statistics_start_us;
+
+    /**
+     * \brief Statistics collected so far.
+     */
+    nbt_session_statistics_t statistics;
+} nbt_session_device_t;
+
+/**
+ * \brief Buses and devices of a session manager.
+ */
+struct nbt_session_state
+{
+    /**
+     * \brief Lock protecting the device list and pending jobs.
+     */
+    pthread_mutex_t lock;
+
+    /**
+     * \brief Signalled whenever no jobs are pending.
+     */
+    pthread_cond_t idle;
+
+    /**
+     * \brief Number of queued and running jobs of all devices.
+     *
+     * \details Decremented only after the done callback returned, so jobs it
+     * submits are always counted first.
+     */
+    size_t pending;
+
+    /**
+     * \brief One lock per bus.
+     */
+    pthread_mutex_t *buses;
+
+    /**
+     * \brief Number of buses.
+     */
+    size_t bus_count;
+
+    /**
+     * \brief Devices in order of registration.
+     */
+    nbt_session_device_t **devices;
+
+    /**
+     * \brief Number of devices.
+     */
+    size_t device_count;
+
+    /**
+     * \brief Number of entries allocated for devices.
+     */
+    size_t device_capacity;
+
+    /**
+     * \brief Maximum number of jobs queued per device.
+     */
+    size_t queue_capacity;
+};
+
+/**
+ * \brief Returns current time of monotonic clock.
+ *
+ * \return uint64_t Current time in [us] (\c 0 if clock cannot be read).
+ */
+static uint64_t nbt_session_now_us(void)
+{
+    struct timespec now;
+    if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+    {
+        return 0U;
+    }
+    return ((uint64_t) now.tv_sec * UINT64_C(1000000)) +
+           ((uint64_t) now.tv_nsec / UINT64_C(1000));
+}
+
+/**
+ * \brief Looks up device by index.
+ *
+ * \param[in] self Session manager.
+ * \param[in] index Index of the device.
+ * \return nbt_session_device_t* Device or \c NULL if it does not exist.
+ */
+static nbt_session_device_t *
+nbt_session_get_device(const nbt_session_manager_t *self, size_t index)
+{
+#if (IFX_VALIDATE_NULL_PTR)
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(self) ||
+        IFX_VALIDATE_NULL_PTR_MEMORY(self->_properties))
+    {
+        return NULL;
+    }
+#endif
+    nbt_session_state_t *state = (nbt_session_state_t *) self->_properties;
+    nbt_session_device_t *device = NULL;
+    pthread_mutex_lock(&state->lock);
+    if (index < state->device_count)
+    {
+        device = state->devices[index];
+    }
+    pthread_mutex_unlock(&state->lock);
+    return device;
+}
+
+/**
+ * \brief Checks if the calling thread is the worker thread of a device.
+ *
+ * \param[in] state Session manager state.
+ * \param[in] index Index of the device or \ref NBT_SESSION_ALL_DEVICES to
+ * check the worker threads of all devices.
+ * \return bool \c true if called from a worker thread waiting would block.
+ */
+static bool nbt_session_is_worker(nbt_session_state_t *state, size_t index)
+{
+    bool is_worker = false;
+    pthread_t caller = pthread_self();
+    pthread_mutex_lock(&state->lock);
+    for (size_t i = 0U; i < state->device_count; i++)
+    {
+        if (((NBT_SESSION_ALL_DEVICES == index) || (i == index)) &&
+            pthread_equal(caller, state->devices[i]->thread))
+        {
+            is_worker = true;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&state->lock);
+    return is_worker;
+}
+
+/**
+ * \brief Worker thread executing the queued jobs of a device.
+ *
+ * \param[in] argument Device to execute jobs for.
+ * \return void* Always \c NULL.
+ */
+static void *nbt_session_worker(void *argument)
+{
+    nbt_session_device_t *device = (nbt_session_device_t *) argument;
+    pthread_mutex_lock(&device->lock);
+    while (true)
+    {
+        while ((device->count == 0U) && !device->stop)
+        {
+            pthread_cond_wait(&device->changed, &device->lock);
+        }
+        if (device->count == 0U)
+        {
+            break;
+        }
+        nbt_session_entry_t entry = device->queue[device->head];
+        device->head = (device->head + 1U) % device->capacity;
+        device->count--;
+        device->running = true;
+        pthread_mutex_unlock(&device->lock);
+
+        // Only one device per bus may communicate at a time
+        uint64_t queued_us = nbt_session_now_us();
+        pthread_mutex_lock(device->bus);
+        uint64_t start_us = nbt_session_now_us();
+        ifx_status_t status = entry.job(device->cmd, entry.context);
+        uint64_t end_us = nbt_session_now_us();
+        pthread_mutex_unlock(device->bus);
+
+        pthread_mutex_lock(&device->lock);
+        device->statistics.bus_wait_us += start_us - queued_us;
+        device->statistics.busy_us += end_us - start_us;
+        if (ifx_error_check(status))
+        {
+            device->statistics.jobs_failed++;
+        }
+        else
+        {
+            device->statistics.jobs_completed++;
+        }
+        pthread_mutex_unlock(&device->lock);
+
+        // Callback may submit follow-up jobs for this device
+        if (entry.done != NULL)
+        {
+            entry.done(device->index, status, entry.context);
+        }
+
+        pthread_mutex_lock(&device->manager->lock);
+        device->manager->pending--;
+        if (device->manager->pending == 0U)
+        {
+            pthread_cond_broadcast(&device->manager->idle);
+        }
+        pthread_mutex_unlock(&device->manager->lock);
+
+        pthread_mutex_lock(&device->lock);
+        device->running = false;
+        pthread_cond_broadcast(&device->changed);
+    }
+    pthread_mutex_unlock(&device->lock);
+    return NULL;
+}
+
+/**
+ * \brief Waits until no jobs are pending in the session manager.
+ *
+ * \param[in] state Session manager state.
+ */
+static void nbt_session_wait_all_idle(nbt_session_state_t *state)
+{
+    pthread_mutex_lock(&state->lock);
+    while (state->pending > 0U)
+    {
+        pthread_cond_wait(&state->idle, &state->lock);
+    }
+    pthread_mutex_unlock(&state->lock);
+}
+
+/**
+ * \brief Stops worker thread of idle device and releases its memory.
+ *
+ * \param[in] device Device to be stopped.
+ */
+static void nbt_session_stop_device(nbt_session_device_t *device)
+{
+    pthread_mutex_lock(&device->lock);
+    device->stop = true;
+    pthread_cond_broadcast(&device->changed);
+    pthread_mutex_unlock(&device->lock);
+    pthread_join(device->thread, NULL);
+    pthread_cond_destroy(&device->changed);
+    pthread_mutex_destroy(&device->lock);
+    IFX_FREE(device->queue);
+    IFX_FREE(device);
+}
+
+/**
+ * \brief Initializes session manager.
+ *
+ * \param[out] self Session manager to be initialized.
+ * \param[in] bus_count Number of buses devices can be assigned to.
+ * \param[in] queue_capacity Maximum number of jobs queued per device.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ */
+ifx_status_t nbt_session_manager_initialize(nbt_session_manager_t *self,
+                                            size_t bus_count,
+                                            size_t queue_capacity)
+{
+#if (IFX_VALIDATE_NULL_PTR)
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(self))
+    {
+        return IFX_ERROR(NBT_SESSION_MANAGER, NBT_SESSION_MANAGER_INITIALIZE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+#endif
+    if ((bus_count == 0U) || (queue_capacity == 0U))
+    {
+        return IFX_ERROR(NBT_SESSION_MANAGER, NBT_SESSION_MANAGER_INITIALIZE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    nbt_session_state_t *state =
+        (nbt_session_state_t *) malloc(sizeof(nbt_session_state_t));
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(state))
+    {
+        return IFX_ERROR(NBT_SESSION_MANAGER, NBT_SESSION_MANAGER_INITIALIZE,
+                         IFX_OUT_OF_MEMORY);
+    }
+    state->buses =
+        (pthread_mutex_t *) malloc(bus_count * sizeof(pthread_mutex_t));
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(state->buses))
+    {
+        IFX_FREE(state);
+        return IFX_ERROR(NBT_SESSION_MANAGER, NBT_SESSION_MANAGER_INITIALIZE,
+                         IFX_OUT_OF_MEMORY);
+    }
+    for (size_t bus = 0U; bus < bus_count; bus++)
+    {
+        pthread_mutex_init(&state->buses[bus], NULL);
+    }
+    pthread_mutex_init(&state->lock, NULL);
+    pthread_cond_init(&state->idle, NULL);
+    state->pending = 0U;
+    state->bus_count = bus_count;
+    state->devices = NULL;
+    state->device_count = 0U;
+    state->device_capacity = 0U;
+    state->queue_capacity = queue_capacity;
+    self->_properties = state;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Adds device and starts its worker thread.
+ *
+ * \param[in] self Session manager.
+ * \param[in] cmd Initialized command set of the device.
+ * \param[in] bus Index of the bus the device is connected to.
+ * \param[out] device Buffer to store index of the device in.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ * \retval IFX_OUT_OF_MEMORY : If memory allocation fails
+ * \retval IFX_UNSPECIFIED_ERROR : If worker thread cannot be started
+ */
+ifx_status_t nbt_session_manager_add_device(nbt_session_manager_t *self,
+                                            nbt_cmd_t *cmd, size_t bus,
+                                            size_t *device)
+{
+#if (IFX_VALIDATE_NULL_PTR)
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(self) ||
+        IFX_VALIDATE_NULL_PTR_MEMORY(self->_properties) ||
+        IFX_VALIDATE_NULL_PTR_MEMORY(cmd) ||
+        IFX_VALIDATE_NULL_PTR_MEMORY(device))
+    {
+        return IFX_ERROR(NBT_SESSION_MANAGER, NBT_SESSION_MANAGER_ADD_DEVICE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+#endif
+    nbt_session_state_t *state = (nbt_session_state_t *) self->_properties;
+    if (bus >= state->bus_count)
+    {
+        return IFX_ERROR(NBT_SESSION_MANAGER, NBT_SESSION_MANAGER_ADD_DEVICE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    nbt_session_device_t *added =
+        (nbt_session_device_t *) malloc(sizeof(nbt_session_device_t));
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(added))
+    {
+        return IFX_ERROR(NBT_SESSION_MANAGER, NBT_SESSION_MANAGER_ADD_DEVICE,
+                         IFX_OUT_OF_MEMORY);
+    }
+    added->queue = (nbt_session_entry_t *) malloc(state->queue_capacity *
+                                                  sizeof(nbt_session_entry_t));
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(added->queue))
+    {
+        IFX_FREE(added);
+        return IFX_ERROR(NBT_SESSION_MANAGER, NBT_SESSION_MANAGER_ADD_DEVICE,
+                         IFX_OUT_OF_MEMORY);
+    }
+    added->cmd = cmd;
+    added->bus = &state->buses[bus];
+    added->manager = state;
+    added->capacity = state->queue_capacity;
+    added->head = 0U;
+    added->count = 0U;
+    added->running = false;
+    added->stop = false;
+    added->statistics_start_us = nbt_session_now_us();
+    memset(&added->statistics, 0, sizeof(added->statistics));
+    pthread_mutex_init(&added->lock, NULL);
+    pthread_cond_init(&added->changed, NULL);
+
+    pthread_mutex_lock(&state->lock);
+    if (state->device_count == state->device_capacity)
+    {
+        size_t capacity =
+            (state->device_capacity == 0U) ? 8U : (2U * state->device_capacity);
+        nbt_session_device_t **devices = (nbt_session_device_t **) realloc(
+            state->devices, capacity * sizeof(nbt_session_device_t *));
+        if (IFX_VALIDATE_NULL_PTR_MEMORY(devices))
+        {
+            pthread_mutex_unlock(&state->lock);
+            pthread_cond_destroy(&added->changed);
+            pthread_mutex_destroy(&added->lock);
+            IFX_FREE(added->queue);
+            IFX_FREE(added);
+            return IFX_ERROR(NBT_SESSION_MANAGER,
+                             NBT_SESSION_MANAGER_ADD_DEVICE, IFX_OUT_OF_MEMORY);
+        }
+        state->devices = devices;
+        state->device_capacity = capacity;
+    }
+    added->index = state->device_count;
+    if (pthread_create(&added->thread, NULL, nbt_session_worker, added) != 0)
+    {
+        pthread_mutex_unlock(&state->lock);
+        pthread_cond_destroy(&added->changed);
+        pthread_mutex_destroy(&added->lock);
+        IFX_FREE(added->queue);
+        IFX_FREE(added);
+        return IFX_ERROR(NBT_SESSION_MANAGER, NBT_SESSION_MANAGER_ADD_DEVICE,
+                         IFX_UNSPECIFIED_ERROR);
+    }
+    state->devices[state->device_count] = added;
+    state->device_count++;
+    pthread_mutex_unlock(&state->lock);
+
+    *device = added->index;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Queues job for a device.
+ *
+ * \param[in] self Session manager.
+ * \param[in] device Index of the device to execute job on.
+ * \param[in] job Job to be executed.
+ * \param[in] context Context passed to \p job and \p done.
+ * \param[in] done Optional callback notified once the job has been executed
+ * (might be \c NULL).
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ * \retval NBT_SESSION_QUEUE_FULL : If queue of device is full
+ */
+ifx_status_t nbt_session_manager_submit(nbt_session_manager_t *self,
+                                        size_t device, nbt_session_job_t job,
+                                        void *context, nbt_session_done_t done)
+{
+    nbt_session_device_t *target = nbt_session_get_device(self, device);
+    if ((target == NULL) || (job == NULL))
+    {
+        return IFX_ERROR(NBT_SESSION_MANAGER, NBT_SESSION_MANAGER_SUBMIT,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    pthread_mutex_lock(&target->lock);
+    if (target->count == target->capacity)
+    {
+        pthread_mutex_unlock(&target->lock);
+        return IFX_ERROR(NBT_SESSION_MANAGER, NBT_SESSION_MANAGER_SUBMIT,
+                         NBT_SESSION_QUEUE_FULL);
+    }
+    nbt_session_entry_t *entry =
+        &target->queue[(target->head + target->count) % target->capacity];
+    entry->job = job;
+    entry->context = context;
+    entry->done = done;
+    target->count++;
+
+    // Counted before worker can execute (and uncount) the job
+    pthread_mutex_lock(&target->manager->lock);
+    target->manager->pending++;
+    pthread_mutex_unlock(&target->manager->lock);
+    if (target->count > target->statistics.max_queue_depth)
+    {
+        target->statistics.max_queue_depth = target->count;
+    }
+    pthread_cond_broadcast(&target->changed);
+    pthread_mutex_unlock(&target->lock);
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Waits until all queued jobs of a device have been executed.
+ *
+ * \param[in] self Session manager.
+ * \param[in] device Index of the device to wait for or \ref
+ * NBT_SESSION_ALL_DEVICES.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function or if called from a job or done callback of \p device (or of any
+ * device for \ref NBT_SESSION_ALL_DEVICES)
+ */
+ifx_status_t nbt_session_manager_wait(nbt_session_manager_t *self,
+                                      size_t device)
+{
+    if (NBT_SESSION_ALL_DEVICES == device)
+    {
+#if (IFX_VALIDATE_NULL_PTR)
+        if (IFX_VALIDATE_NULL_PTR_MEMORY(self) ||
+            IFX_VALIDATE_NULL_PTR_MEMORY(self->_properties))
+        {
+            return IFX_ERROR(NBT_SESSION_MANAGER, NBT_SESSION_MANAGER_WAIT,
+                             IFX_ILLEGAL_ARGUMENT);
+        }
+#endif
+        nbt_session_state_t *state = (nbt_session_state_t *) self->_properties;
+
+        // Job of calling worker thread is pending until it returns
+        if (nbt_session_is_worker(state, device))
+        {
+            return IFX_ERROR(NBT_SESSION_MANAGER, NBT_SESSION_MANAGER_WAIT,
+                             IFX_ILLEGAL_ARGUMENT);
+        }
+        nbt_session_wait_all_idle(state);
+        return IFX_SUCCESS;
+    }
+
+    nbt_session_device_t *target = nbt_session_get_device(self, device);
+    if ((target == NULL) ||
+        nbt_session_is_worker((nbt_session_state_t *) self->_properties,
+                              device))
+    {
+        return IFX_ERROR(NBT_SESSION_MANAGER, NBT_SESSION_MANAGER_WAIT,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    pthread_mutex_lock(&target->lock);
+    while ((target->count > 0U) || target->running)
+    {
+        pthread_cond_wait(&target->changed, &target->lock);
+    }
+    pthread_mutex_unlock(&target->lock);
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Returns queue depth and throughput of a device.
+ *
+ * \param[in] self Session manager.
+ * \param[in] device Index of the device.
+ * \param[out] statistics Buffer to store statistics in.
+ * \param[in] reset Whether to reset counters afterwards.
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If API operation is successful
+ * \retval IFX_ILLEGAL_ARGUMENT : If invalid/NULL parameter is passed to
+ * function
+ */
+ifx_status_t
+nbt_session_manager_get_statistics(nbt_session_manager_t *self, size_t device,
+                                   nbt_session_statistics_t *statistics,
+                                   bool reset)
+{
+#if (IFX_VALIDATE_NULL_PTR)
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(statistics))
+    {
+        return IFX_ERROR(NBT_SESSION_MANAGER,
+                         NBT_SESSION_MANAGER_GET_STATISTICS,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+#endif
+    nbt_session_device_t *target = nbt_session_get_device(self, device);
+    if (target == NULL)
+    {
+        return IFX_ERROR(NBT_SESSION_MANAGER,
+                         NBT_SESSION_MANAGER_GET_STATISTICS,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    uint64_t now_us = nbt_session_now_us();
+    pthread_mutex_lock(&target->lock);
+    *statistics = target->statistics;
+    statistics->queue_depth = target->count;
+    statistics->elapsed_us = now_us - target->statistics_start_us;
+    if (reset)
+    {
+        memset(&target->statistics, 0, sizeof(target->statistics));
+        target->statistics.max_queue_depth = target->count;
+        target->statistics_start_us = now_us;
+    }
+    pthread_mutex_unlock(&target->lock);
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Executes all queued jobs, stops the worker threads and releases the
+ * memory associated with session manager (but not object itself).
+ *
+ * \param[in] self Session manager whose data shall be released.
+ */
+void nbt_session_manager_destroy(nbt_session_manager_t *self)
+{
+    if (IFX_VALIDATE_NULL_PTR_MEMORY(self) ||
+        IFX_VALIDATE_NULL_PTR_MEMORY(self->_properties))
+    {
+        return;
+    }
+    nbt_session_state_t *state = (nbt_session_state_t *) self->_properties;
+
+    // No callback can submit further jobs once nothing is pending
+    nbt_session_wait_all_idle(state);
+    for (size_t index = 0U; index < state->device_count; index++)
+    {
+        nbt_session_stop_device(state->devices[index]);
+    }
+    for (size_t bus = 0U; bus < state->bus_count; bus++)
+    {
+        pthread_mutex_destroy(&state->buses[bus]);
+    }
+    pthread_cond_destroy(&state->idle);
+    pthread_mutex_destroy(&state->lock);
+    IFX_FREE(state->devices);
+    IFX_FREE(state->buses);
+    IFX_FREE(state);
+    self->_properties = NULL;
+}
@@ -0,0 +1,243 @@
+// SPDX-FileCopyrightText: 2024 Infineon Technologies AG
+//
+// SPDX-License-Identifier: MIT
+
+/**
+ * \file infineon/ifx-apdu-batch.h
+ * \brief Execution of fixed sequences of APDUs over one protocol stack.
+ */
+#ifndef IFX_APDU_BATCH_H
+#define IFX_APDU_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "infineon/ifx-apdu-protocol.h"
+#include "infineon/ifx-apdu.h"
+#include "infineon/ifx-error.h"
+#include "infineon/ifx-protocol.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_apdu_batch_initialize().
+ */
+#define IFX_APDU_BATCH_INITIALIZE         UINT8_C(0x20)
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_apdu_batch_set_stop_condition().
+ */
+#define IFX_APDU_BATCH_SET_STOP_CONDITION UINT8_C(0x21)
+
+/**
+ * \brief IFX error encoding function identifier for ifx_apdu_batch_set_clock().
+ */
+#define IFX_APDU_BATCH_SET_CLOCK          UINT8_C(0x22)
+
+/**
+ * \brief IFX error encoding function identifier for ifx_apdu_batch_run().
+ */
+#define IFX_APDU_BATCH_RUN                UINT8_C(0x23)
+
+/**
+ * \brief Status word mask used by ifx_apdu_batch_initialize().
+ */
+#define IFX_APDU_BATCH_DEFAULT_SW_MASK    UINT16_C(0xFFFF)
+
+/**
+ * \brief Expected status word used by ifx_apdu_batch_initialize().
+ */
+#define IFX_APDU_BATCH_DEFAULT_SW         UINT16_C(0x9000)
+
+/**
+ * \brief Clock used to measure the duration of each step.
+ *
+ * \param[in] context Context given to ifx_apdu_batch_set_clock().
+ * \return uint64_t Current time in [us] of any monotonic clock.
+ */
+typedef uint64_t (*ifx_apdu_batch_clock_t)(void *context);
+
+/** \struct ifx_apdu_batch_result_t
+ * \brief Result of a single APDU executed by ifx_apdu_batch_run().
+ */
+typedef struct
+{
+    /**
+     * \brief Status of exchanging the APDU with the secure element.
+     */
+    ifx_status_t status;
+
+    /**
+     * \brief Status word of the response (\c 0 if no response was received).
+     */
+    uint16_t sw;
+
+    /**
+     * \brief Response data (without status word).
+     *
+     * \details Points into the response arena of the batch and stays valid
+     * until the next call to ifx_apdu_batch_run() or ifx_apdu_batch_destroy().
+     * \c NULL if the response does not contain any data.
+     */
+    const uint8_t *data;
+
+    /**
+     * \brief Number of bytes in \ref data.
+     */
+    size_t len;
+
+    /**
+     * \brief Time in [us] from encoding the APDU until the response has been
+     * received (\c 0 if no clock is set).
+     */
+    uint64_t duration_us;
+} ifx_apdu_batch_result_t;
+
+/** \struct ifx_apdu_batch_t
+ * \brief Buffers and settings reused by consecutive calls to
+ * ifx_apdu_batch_run().
+ *
+ * \details Members are only to be accessed using the functions in this file.
+ */
+typedef struct
+{
+    /**
+     * \brief Mask applied to the status word before comparing it with \ref
+     * _sw_expected.
+     */
+    uint16_t _sw_mask;
+
+    /**
+     * \brief Status word (after masking) required to continue with the next
+     * APDU.
+     */
+    uint16_t _sw_expected;
+
+    /**
+     * \brief Optional clock measuring the duration of each step.
+     */
+    ifx_apdu_batch_clock_t _clock;
+
+    /**
+     * \brief Context passed to \ref _clock.
+     */
+    void *_clock_context;
+
+    /**
+     * \brief Encode buffer used if the protocol stack does not offer a request
+     * buffer.
+     */
+    uint8_t *_encoded;
+
+    /**
+     * \brief Size of \ref _encoded in bytes.
+     */
+    size_t _encoded_size;
+
+    /**
+     * \brief Response arena holding the response data of all steps.
+     */
+    uint8_t *_arena;
+
+    /**
+     * \brief Size of \ref _arena in bytes.
+     */
+    size_t _arena_size;
+} ifx_apdu_batch_t;
+
+/**
+ * \brief Initializes APDU batch stopping on any status word other than
+ * \c 0x9000 and without clock.
+ *
+ * \param[out] self APDU batch to be initialized.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_apdu_batch_initialize(ifx_apdu_batch_t *self);
+
+/**
+ * \brief Sets status words that allow ifx_apdu_batch_run() to continue with
+ * the next APDU.
+ *
+ * \details Execution continues as long as <tt>(sw & sw_mask) ==
+ * sw_expected</tt>. For example a mask of \c 0xFF00 and an expected status
+ * word of \c 0x9000 accept any \c 90XX status word, while a mask of \c 0x0000
+ * and an expected status word of \c 0x0000 never stop on a status word.
+ *
+ * \param[in] self APDU batch to set stop condition for.
+ * \param[in] sw_mask Mask applied to the status word.
+ * \param[in] sw_expected Expected status word after masking.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_apdu_batch_set_stop_condition(ifx_apdu_batch_t *self,
+                                               uint16_t sw_mask,
+                                               uint16_t sw_expected);
+
+/**
+ * \brief Sets clock used to measure the duration of each step.
+ *
+ * \param[in] self APDU batch to set clock for.
+ * \param[in] clock Clock to be used (might be \c NULL to disable timings).
+ * \param[in] context Context passed to \p clock.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_apdu_batch_set_clock(ifx_apdu_batch_t *self,
+                                      ifx_apdu_batch_clock_t clock,
+                                      void *context);
+
+/**
+ * \brief Exchanges APDUs back-to-back with secure element.
+ *
+ * \details The lock of the protocol stack is held for the whole batch. Each
+ * APDU is encoded into the request buffer of the protocol stack or the encode
+ * buffer of the batch and the response data is collected in the response
+ * arena of the batch, so the batch itself does not allocate per result once
+ * its buffers have grown to the required size. The protocol stack still
+ * allocates each response in ifx_protocol_transceive(), which is copied into
+ * the arena and freed. Execution stops at the first APDU that cannot be
+ * exchanged or whose status word does not match the stop condition.
+ *
+ * \param[in] self APDU batch holding buffers and settings.
+ * \param[in] protocol Protocol stack for performing necessary operations.
+ * \param[in] apdus APDUs to be executed in order.
+ * \param[in] apdu_count Number of APDUs in \p apdus.
+ * \param[out] results Buffer to store one result per APDU in (at least \p
+ * apdu_count entries).
+ * \param[out] executed Buffer to store number of APDUs in (number of valid
+ * entries in \p results including the APDU execution stopped at).
+ * \return ifx_status_t
+ * \retval IFX_SUCCESS : If all APDUs have been executed successfully
+ * \retval IFX_ERROR(LIB_APDU_PROTOCOL, IFX_APDU_BATCH_RUN, IFX_SW_ERROR) : If
+ * execution stopped on a status word
+ * \retval any other value : If an APDU could not be exchanged (also stored in
+ * the result of that APDU)
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_apdu_batch_run(ifx_apdu_batch_t *self,
+                                ifx_protocol_t *protocol,
+                                const ifx_apdu_t *apdus, size_t apdu_count,
+                                ifx_apdu_batch_result_t *results,
+                                size_t *executed);
+
+/**
+ * \brief Frees memory associated with APDU batch (but not object itself).
+ *
+ * \details Response data of previous results is no longer valid afterwards.
+ *
+ * \param[in] self APDU batch whose data shall be freed.
+ */
+void ifx_apdu_batch_destroy(ifx_apdu_batch_t *self);
+
+#ifdef __cplusplus
+}
+
+#endif
+#endif // IFX_APDU_BATCH_H
@@ -92,6 +92,12 @@ extern "C" {
  *
  * \details Encodes APDU, then sends it through ISO/OSI protocol.
  *          Reads back response and stores it in APDU response.
+ *          The APDU is encoded directly into the buffer returned by
+ *          ifx_protocol_get_request_buffer() if the protocol stack offers
+ *          one (e.g. T=1' for APDUs fitting into a single block), otherwise
+ *          into a temporary buffer.
+ *          The response buffer of the protocol stack is handed over to
+ *          \p response without copying (see ifx_apdu_response_decode_take()).
  *
  * \param[in] self  Protocol stack for performing necessary operations.
  * \param[in] apdu APDU to be send to secure element.
@@ -0,0 +1,347 @@
+// SPDX-FileCopyrightText: 2024 Infineon Technologies AG
+//
+// SPDX-License-Identifier: MIT
+
+/**
+ * \file ifx-apdu-batch.c
+ * \brief Execution of fixed sequences of APDUs over one protocol stack.
+ */
+#include "infineon/ifx-apdu-batch.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "infineon/ifx-apdu-protocol.h"
+#include "infineon/ifx-logger.h"
+#include "infineon/ifx-protocol.h"
+
+/**
+ * \brief String used as source information for logging.
+ */
+#define IFX_LOG_TAG                    IFX_APDU_PROTOCOL_LOG_TAG
+
+/**
+ * \brief Minimum number of bytes allocated for encode buffer and response
+ * arena.
+ */
+#define IFX_APDU_BATCH_MIN_BUFFER_SIZE 64U
+
+/**
+ * \brief Makes sure buffer can hold at least \p required bytes.
+ *
+ * \details Grows the buffer geometrically so that repeated calls only
+ * reallocate a logarithmic number of times. Existing content is kept.
+ *
+ * \param[in,out] buffer Buffer to be grown.
+ * \param[in,out] size Current size of \p buffer in bytes.
+ * \param[in] required Number of bytes the buffer must be able to hold.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t ifx_apdu_batch_reserve(uint8_t **buffer, size_t *size,
+                                           size_t required)
+{
+    if (*size >= required)
+    {
+        return IFX_SUCCESS;
+    }
+    size_t new_size = *size;
+    if (new_size < IFX_APDU_BATCH_MIN_BUFFER_SIZE)
+    {
+        new_size = IFX_APDU_BATCH_MIN_BUFFER_SIZE;
+    }
+    while (new_size < required)
+    {
+        new_size = (new_size > (SIZE_MAX / 2U)) ? required : (new_size * 2U);
+    }
+    uint8_t *grown = (uint8_t *) realloc(*buffer, new_size);
+    if (grown == NULL)
+    {
+        return IFX_ERROR(LIB_APDU_PROTOCOL, IFX_APDU_BATCH_RUN,
+                         IFX_OUT_OF_MEMORY);
+    }
+    *buffer = grown;
+    *size = new_size;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Exchanges single APDU and appends its response data to the response
+ * arena.
+ *
+ * \param[in] self APDU batch holding buffers.
+ * \param[in] protocol Protocol stack for performing necessary operations.
+ * \param[in] apdu APDU to be exchanged.
+ * \param[out] result Result to store status word and data length in.
+ * \param[in,out] arena_len Number of bytes used in response arena.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t ifx_apdu_batch_step(ifx_apdu_batch_t *self,
+                                        ifx_protocol_t *protocol,
+                                        const ifx_apdu_t *apdu,
+                                        ifx_apdu_batch_result_t *result,
+                                        size_t *arena_len)
+{
+    // Encode APDU into request buffer of protocol stack or own encode buffer
+    size_t encoded_len = ifx_apdu_encoded_size(apdu);
+    uint8_t *encoded = NULL;
+    ifx_status_t status;
+    if (ifx_protocol_get_request_buffer(protocol, encoded_len, &encoded) !=
+        IFX_SUCCESS)
+    {
+        status = ifx_apdu_batch_reserve(&self->_encoded, &self->_encoded_size,
+                                        encoded_len);
+        if (status != IFX_SUCCESS)
+        {
+            return status;
+        }
+        encoded = self->_encoded;
+    }
+    status = ifx_apdu_encode_into(apdu, encoded, encoded_len, &encoded_len);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    IFX_APDU_PROTOCOL_LOG_BYTES(protocol->_logger, IFX_LOG_TAG, IFX_LOG_INFO,
+                                ">> ", encoded, encoded_len, " ");
+
+    // Exchange data with secure element
+    uint8_t *response = NULL;
+    size_t response_len = 0U;
+    status = ifx_protocol_transceive(protocol, encoded, encoded_len, &response,
+                                     &response_len);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    if (response_len < 2U)
+    {
+        IFX_APDU_PROTOCOL_LOG_BYTES(protocol->_logger, IFX_LOG_TAG,
+                                    IFX_LOG_ERROR,
+                                    "received invalid APDU response: ",
+                                    response, response_len, " ");
+        free(response);
+        response = NULL;
+        return IFX_ERROR(LIB_APDU, IFX_APDU_RESPONSE_DECODE,
+                         IFX_TOO_LITTLE_DATA);
+    }
+    IFX_APDU_PROTOCOL_LOG_BYTES(protocol->_logger, IFX_LOG_TAG, IFX_LOG_INFO,
+                                "<< ", response, response_len, " ");
+
+    // Collect response data in arena
+    result->sw = (uint16_t) (((uint16_t) response[response_len - 2U] << 8) |
+                             response[response_len - 1U]);
+    result->len = response_len - 2U;
+    if (result->len > 0U)
+    {
+        status = ifx_apdu_batch_reserve(&self->_arena, &self->_arena_size,
+                                        *arena_len + result->len);
+        if (status == IFX_SUCCESS)
+        {
+            // clang-format off
+            memcpy(self->_arena + *arena_len, response, result->len); // Flawfinder: ignore
+            // clang-format on
+            *arena_len += result->len;
+        }
+        else
+        {
+            result->len = 0U;
+        }
+    }
+    free(response);
+    response = NULL;
+    return status;
+}
+
+/**
+ * \brief Initializes APDU batch stopping on any status word other than
+ * \c 0x9000 and without clock.
+ *
+ * \param[out] self APDU batch to be initialized.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_apdu_batch_initialize(ifx_apdu_batch_t *self)
+{
+    if (self == NULL)
+    {
+        return IFX_ERROR(LIB_APDU_PROTOCOL, IFX_APDU_BATCH_INITIALIZE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    self->_sw_mask = IFX_APDU_BATCH_DEFAULT_SW_MASK;
+    self->_sw_expected = IFX_APDU_BATCH_DEFAULT_SW;
+    self->_clock = NULL;
+    self->_clock_context = NULL;
+    self->_encoded = NULL;
+    self->_encoded_size = 0U;
+    self->_arena = NULL;
+    self->_arena_size = 0U;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Sets status words that allow ifx_apdu_batch_run() to continue with
+ * the next APDU.
+ *
+ * \param[in] self APDU batch to set stop condition for.
+ * \param[in] sw_mask Mask applied to the status word.
+ * \param[in] sw_expected Expected status word after masking.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_apdu_batch_set_stop_condition(ifx_apdu_batch_t *self,
+                                               uint16_t sw_mask,
+                                               uint16_t sw_expected)
+{
+    // Expected status word must be reachable after masking
+    if ((self == NULL) || ((sw_expected & (uint16_t) ~sw_mask) != 0U))
+    {
+        return IFX_ERROR(LIB_APDU_PROTOCOL, IFX_APDU_BATCH_SET_STOP_CONDITION,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    self->_sw_mask = sw_mask;
+    self->_sw_expected = sw_expected;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Sets clock used to measure the duration of each step.
+ *
+ * \param[in] self APDU batch to set clock for.
+ * \param[in] clock Clock to be used (might be \c NULL to disable timings).
+ * \param[in] context Context passed to \p clock.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_apdu_batch_set_clock(ifx_apdu_batch_t *self,
+                                      ifx_apdu_batch_clock_t clock,
+                                      void *context)
+{
+    if (self == NULL)
+    {
+        return IFX_ERROR(LIB_APDU_PROTOCOL, IFX_APDU_BATCH_SET_CLOCK,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    self->_clock = clock;
+    self->_clock_context = context;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Exchanges APDUs back-to-back with secure element.
+ *
+ * \param[in] self APDU batch holding buffers and settings.
+ * \param[in] protocol Protocol stack for performing necessary operations.
+ * \param[in] apdus APDUs to be executed in order.
+ * \param[in] apdu_count Number of APDUs in \p apdus.
+ * \param[out] results Buffer to store one result per APDU in (at least \p
+ * apdu_count entries).
+ * \param[out] executed Buffer to store number of APDUs in (number of valid
+ * entries in \p results including the APDU execution stopped at).
+ * \return ifx_status_t \c IFX_SUCCESS if all APDUs have been executed
+ * successfully, \c IFX_ERROR(LIB_APDU_PROTOCOL, IFX_APDU_BATCH_RUN,
+ * IFX_SW_ERROR) if execution stopped on a status word, any other value if an
+ * APDU could not be exchanged.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_apdu_batch_run(ifx_apdu_batch_t *self,
+                                ifx_protocol_t *protocol,
+                                const ifx_apdu_t *apdus, size_t apdu_count,
+                                ifx_apdu_batch_result_t *results,
+                                size_t *executed)
+{
+    // Validate parameters
+    if ((self == NULL) || (protocol == NULL) || (apdus == NULL) ||
+        (apdu_count == 0U) || (results == NULL) || (executed == NULL))
+    {
+        return IFX_ERROR(LIB_APDU_PROTOCOL, IFX_APDU_BATCH_RUN,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    *executed = 0U;
+
+    // Keep other users of protocol stack out for the whole batch
+    ifx_status_t status = ifx_protocol_lock(protocol);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    size_t arena_len = 0U;
+    size_t count = 0U;
+    while (count < apdu_count)
+    {
+        ifx_apdu_batch_result_t *result = &results[count];
+        result->sw = 0U;
+        result->data = NULL;
+        result->len = 0U;
+        result->duration_us = 0U;
+        uint64_t start_us =
+            (self->_clock != NULL) ? self->_clock(self->_clock_context) : 0U;
+        status = ifx_apdu_batch_step(self, protocol, &apdus[count], result,
+                                     &arena_len);
+        if (self->_clock != NULL)
+        {
+            result->duration_us = self->_clock(self->_clock_context) - start_us;
+        }
+        result->status = status;
+        count++;
+
+        // Stop on first error or unexpected status word
+        if (status != IFX_SUCCESS)
+        {
+            break;
+        }
+        if ((result->sw & self->_sw_mask) != self->_sw_expected)
+        {
+            IFX_APDU_PROTOCOL_LOG(protocol->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                                  "APDU batch stopped at step %u on SW %04X",
+                                  (unsigned) (count - 1U),
+                                  (unsigned) result->sw);
+            status = IFX_ERROR(LIB_APDU_PROTOCOL, IFX_APDU_BATCH_RUN,
+                               IFX_SW_ERROR);
+            break;
+        }
+    }
+    ifx_protocol_unlock(protocol);
+
+    // Arena may have moved while growing so only now resolve data pointers
+    size_t offset = 0U;
+    for (size_t i = 0U; i < count; i++)
+    {
+        if (results[i].len > 0U)
+        {
+            results[i].data = self->_arena + offset;
+            offset += results[i].len;
+        }
+    }
+    *executed = count;
+    return status;
+}
+
+/**
+ * \brief Frees memory associated with APDU batch (but not object itself).
+ *
+ * \param[in] self APDU batch whose data shall be freed.
+ */
+void ifx_apdu_batch_destroy(ifx_apdu_batch_t *self)
+{
+    if (self != NULL)
+    {
+        if (self->_encoded != NULL)
+        {
+            free(self->_encoded);
+            self->_encoded = NULL;
+        }
+        self->_encoded_size = 0U;
+        if (self->_arena != NULL)
+        {
+            free(self->_arena);
+            self->_arena = NULL;
+        }
+        self->_arena_size = 0U;
+    }
+}
@@ -8,6 +8,7 @@
  */
 #include "infineon/ifx-apdu-protocol.h"
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -25,6 +26,12 @@
  *
  * \details Encodes APDU, then sends it through ISO/OSI protocol.
  *          Reads back response and stores it in APDU response.
+ *          The APDU is encoded directly into the buffer returned by
+ *          ifx_protocol_get_request_buffer() if the protocol stack offers
+ *          one (e.g. T=1' for APDUs fitting into a single block), otherwise
+ *          into a temporary buffer.
+ *          The response buffer of the protocol stack is handed over to
+ *          \p response without copying (see ifx_apdu_response_decode_take()).
  *
  * \param[in] self  Protocol stack for performing necessary operations.
  * \param[in] apdu APDU to be send to secure element.
@@ -54,15 +61,28 @@ ifx_status_t ifx_apdu_protocol_transceive(ifx_protocol_t *self,
                          IFX_ILLEGAL_ARGUMENT);
     }
 
-    // Encode APDU
-    uint8_t *encoded = NULL;
-    size_t encoded_len = 0U;
-    ifx_status_t status = ifx_apdu_encode(apdu, &encoded, &encoded_len);
+    // Encode APDU straight into transmit buffer of protocol stack if possible
+    ifx_status_t status = ifx_protocol_lock(self);
     if (status != IFX_SUCCESS)
     {
-        // clang-format off
-        return status; // LCOV_EXCL_LINE
-        // clang-format on
+        return status;
+    }
+    size_t encoded_len = ifx_apdu_encoded_size(apdu);
+    uint8_t *encoded = NULL;
+    bool allocated = false;
+    if ((ifx_protocol_get_request_buffer(self, encoded_len, &encoded) !=
+         IFX_SUCCESS) ||
+        (ifx_apdu_encode_into(apdu, encoded, encoded_len, &encoded_len) !=
+         IFX_SUCCESS))
+    {
+        // Otherwise fall back to temporary buffer
+        status = ifx_apdu_encode(apdu, &encoded, &encoded_len);
+        if (status != IFX_SUCCESS)
+        {
+            ifx_protocol_unlock(self);
+            return status;
+        }
+        allocated = true;
     }
 
     // Log transmitted data
@@ -74,7 +94,8 @@ ifx_status_t ifx_apdu_protocol_transceive(ifx_protocol_t *self,
     size_t response_len = 0;
     status = ifx_protocol_transceive(self, encoded, encoded_len,
                                      &response_buffer, &response_len);
-    if ((encoded != NULL) && (encoded_len > 0U))
+    ifx_protocol_unlock(self);
+    if (allocated)
     {
         free(encoded);
         encoded = NULL;
@@ -84,8 +105,16 @@ ifx_status_t ifx_apdu_protocol_transceive(ifx_protocol_t *self,
         return status;
     }
 
-    // Decode APDU response
-    status = ifx_apdu_response_decode(response, response_buffer, response_len);
+    // Log before decoding as response buffer is handed over to APDU response
+    if (response_len >= 2U)
+    {
+        IFX_APDU_PROTOCOL_LOG_BYTES(self->_logger, IFX_LOG_TAG, IFX_LOG_INFO,
+                                    "<< ", response_buffer, response_len, " ");
+    }
+
+    // Decode APDU response without copying response data
+    status =
+        ifx_apdu_response_decode_take(response, response_buffer, response_len);
     if (status != IFX_SUCCESS)
     {
         IFX_APDU_PROTOCOL_LOG_BYTES(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
@@ -95,11 +124,6 @@ ifx_status_t ifx_apdu_protocol_transceive(ifx_protocol_t *self,
         response_buffer = NULL;
         return status;
     }
-
-    IFX_APDU_PROTOCOL_LOG_BYTES(self->_logger, IFX_LOG_TAG, IFX_LOG_INFO, "<< ",
-                                response_buffer, response_len, " ");
-    free(response_buffer);
-    response_buffer = NULL;
     return IFX_SUCCESS;
 }
 
@@ -20,13 +20,13 @@ extern "C" {
 /**
  * \brief IFX error encoding library identifier.
  */
-#define LIB_APDU                     UINT8_C(0x10)
+#define LIB_APDU                      UINT8_C(0x10)
 
 /**
  * \brief Check APDU response status word(SW) is success(0x9000)
  *  \param[in] response_sw response status word(SW).
  */
-#define IFX_CHECK_SW_OK(response_sw) (response_sw == 0x9000)
+#define IFX_CHECK_SW_OK(response_sw)  (response_sw == 0x9000)
 
 /**
  * \brief LE value for expecting any number of bytes <= 256.
@@ -34,7 +34,7 @@ extern "C" {
  * \details The short length APDU LE encoding according to ISO7816-3 Case 2S or
  * Case 4S is a single byte `0x00` meaning 256 bytes.
  */
-#define IFX_APDU_LE_ANY              0x100u
+#define IFX_APDU_LE_ANY               0x100u
 
 /**
  * \brief LE value for expecting any number of bytes <= 65536.
@@ -42,12 +42,12 @@ extern "C" {
  * \details The extended length APDU LE encoding according to ISO7816-3 Case 2E
  * or Case 4E is a 2 bytes `{0x00, 0x00}` meaning 65536 bytes.
  */
-#define IFX_APDU_LE_ANY_EXTENDED     0x10000u
+#define IFX_APDU_LE_ANY_EXTENDED      0x10000u
 
 /**
  * \brief IFX error encoding function identifier for ifx_apdu_decode().
  */
-#define IFX_APDU_DECODE              0x01u
+#define IFX_APDU_DECODE               0x01u
 
 /**
  * \brief Error reason if LC does not match length of data in ifx_apdu_decode().
@@ -56,7 +56,7 @@ extern "C" {
  * the full result code will always be \c
  * IFX_ERROR(LIB_APDU,IFX_APDU_DECODE,IFX_LC_MISMATCH)
  */
-#define IFX_LC_MISMATCH              0x01u
+#define IFX_LC_MISMATCH               0x01u
 
 /**
  * \brief Error reason if LC and LE do not use same form (short / extended)
@@ -66,22 +66,49 @@ extern "C" {
  * the full result code will always be \c
  * IFX_ERROR(LIB_APDU,IFX_APDU_DECODE,IFX_EXTENDED_LEN_MISMATCH)
  */
-#define IFX_EXTENDED_LEN_MISMATCH    0x02u
+#define IFX_EXTENDED_LEN_MISMATCH     0x02u
 
 /**
  * \brief IFX error encoding function identifier for ifx_apdu_encode().
  */
-#define IFX_APDU_ENCODE              0x02u
+#define IFX_APDU_ENCODE               0x02u
 
 /**
  * \brief IFX error encoding function identifier for ifx_apdu_response_decode().
  */
-#define IFX_APDU_RESPONSE_DECODE     0x03u
+#define IFX_APDU_RESPONSE_DECODE      0x03u
 
 /**
  * \brief IFX error encoding function identifier for ifx_apdu_response_encode().
  */
-#define IFX_APDU_RESPONSE_ENCODE     0x04u
+#define IFX_APDU_RESPONSE_ENCODE      0x04u
+
+/**
+ * \brief IFX error encoding function identifier for ifx_apdu_encode_into().
+ */
+#define IFX_APDU_ENCODE_INTO          0x06u
+
+/**
+ * \brief Error reason if caller provided buffer is too small for encoded APDU
+ * in ifx_apdu_encode_into().
+ *
+ * \details Used in combination with \ref LIB_APDU and \ref
+ * IFX_APDU_ENCODE_INTO so the full result code will always be \c
+ * IFX_ERROR(LIB_APDU,IFX_APDU_ENCODE_INTO,IFX_APDU_BUFFER_TOO_SMALL)
+ */
+#define IFX_APDU_BUFFER_TOO_SMALL     0x03u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_apdu_response_decode_view().
+ */
+#define IFX_APDU_RESPONSE_DECODE_VIEW 0x07u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_apdu_response_decode_take().
+ */
+#define IFX_APDU_RESPONSE_DECODE_TAKE 0x08u
 
 /** \struct ifx_apdu_t
  * \brief Data storage for APDU fields.
@@ -158,6 +185,36 @@ typedef struct
 ifx_status_t ifx_apdu_encode(const ifx_apdu_t *apdu, uint8_t **buffer,
                              size_t *buffer_len);
 
+/**
+ * \brief Returns number of bytes in binary representation of APDU.
+ *
+ * \param[in] apdu APDU to be encoded.
+ * \return size_t Number of bytes ifx_apdu_encode_into() will write (\c 0 if
+ * \p apdu is \c NULL).
+ * \relates ifx_apdu_t
+ */
+size_t ifx_apdu_encoded_size(const ifx_apdu_t *apdu);
+
+/**
+ * \brief Encodes APDU to its binary representation in caller provided buffer.
+ *
+ * \details Same encoding as ifx_apdu_encode() but without allocating memory,
+ * e.g. for encoding into a stack buffer or a buffer provided by the protocol
+ * stack (see ifx_protocol_get_request_buffer()). If \p buffer is too small
+ * the required size is stored in \p buffer_len.
+ *
+ * \param[in] apdu APDU to be encoded.
+ * \param[out] buffer Buffer to store encoded data in.
+ * \param[in] buffer_size Number of bytes available in \p buffer.
+ * \param[out] buffer_len Pointer for storing number of bytes in \p buffer.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, \c
+ * IFX_ERROR(LIB_APDU, IFX_APDU_ENCODE_INTO, IFX_APDU_BUFFER_TOO_SMALL) if \p
+ * buffer is too small, any other value in case of error.
+ * \relates ifx_apdu_t
+ */
+ifx_status_t ifx_apdu_encode_into(const ifx_apdu_t *apdu, uint8_t *buffer,
+                                  size_t buffer_size, size_t *buffer_len);
+
 /**
  * \brief Decodes binary data to its member representation in APDU object.
  *
@@ -198,6 +255,46 @@ void ifx_apdu_destroy(ifx_apdu_t *apdu);
 ifx_status_t ifx_apdu_response_decode(ifx_apdu_response_t *response,
                                       const uint8_t *data, size_t data_len);
 
+/**
+ * \brief Decodes binary data to ifx_apdu_response_t object borrowing the
+ * response data from \p data.
+ *
+ * \details No memory is allocated: ifx_apdu_response_t.data points into \p
+ * data, which has to stay valid (and unmodified) as long as \p response is
+ * used. The response does not own its data, so it must **NOT** be passed to
+ * ifx_apdu_response_destroy().
+ *
+ * \param[out] response ifx_apdu_response_t object to store values in.
+ * \param[in] data Binary data to be decoded (still owned by caller).
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \relates ifx_apdu_response_t
+ */
+ifx_status_t ifx_apdu_response_decode_view(ifx_apdu_response_t *response,
+                                           const uint8_t *data,
+                                           size_t data_len);
+
+/**
+ * \brief Decodes binary data to ifx_apdu_response_t object taking over
+ * ownership of \p data.
+ *
+ * \details No memory is allocated: as the response data precedes the status
+ * word, ifx_apdu_response_t.data simply becomes \p data, which must have been
+ * allocated with malloc() (e.g. the response of ifx_protocol_transceive()).
+ * It is freed by ifx_apdu_response_destroy(). Ownership is only transferred
+ * if successful, otherwise \p data still has to be freed by the caller.
+ *
+ * \param[out] response ifx_apdu_response_t object to store values in.
+ * \param[in] data Dynamically allocated binary data to be decoded.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \relates ifx_apdu_response_t
+ */
+ifx_status_t ifx_apdu_response_decode_take(ifx_apdu_response_t *response,
+                                           uint8_t *data, size_t data_len);
+
 /**
  * \brief Encodes ifx_apdu_response_t to its binary representation.
  *
@@ -219,6 +316,7 @@ ifx_status_t ifx_apdu_response_encode(const ifx_apdu_response_t *response,
  * ifx_apdu_response_decode(). Users would need to manually check which members
  * have been dynamically allocated and free them themselves. Calling this
  * function will ensure that all dynamically allocated members have been freed.
+ * Responses decoded by ifx_apdu_response_decode_view() must not be destroyed.
  *
  * \param[in] response ifx_apdu_response_t object whose data shall be freed.
  * \relates ifx_apdu_response_t
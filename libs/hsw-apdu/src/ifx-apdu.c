@@ -193,18 +193,20 @@ ifx_status_t ifx_apdu_decode(ifx_apdu_t *apdu, const uint8_t *data,
 }
 
 /**
- * \brief Encodes APDU to its binary representation.
+ * \brief Returns number of bytes in binary representation of APDU.
  *
  * \param[in] apdu APDU to be encoded.
- * \param[out] buffer Buffer to store encoded data in.
- * \param[out] buffer_len Pointer for storing number of bytes in \p buffer.
- * \return ifx_status_t \c IFX_SUCCESS if successful, any other value in
- * case of error.
+ * \return size_t Number of bytes ifx_apdu_encode_into() will write (\c 0 if
+ * \p apdu is \c NULL).
  * \relates APDU
  */
-ifx_status_t ifx_apdu_encode(const ifx_apdu_t *apdu, uint8_t **buffer,
-                             size_t *buffer_len)
+size_t ifx_apdu_encoded_size(const ifx_apdu_t *apdu)
 {
+    if (apdu == NULL)
+    {
+        return 0U;
+    }
+
     // Calculate required buffer size (minimum 4 bytes for header)
     size_t buffer_size = 4U + apdu->lc;
     bool extended_length = (apdu->lc > 0xffU) || (apdu->le > IFX_APDU_LE_ANY);
@@ -242,20 +244,44 @@ ifx_status_t ifx_apdu_encode(const ifx_apdu_t *apdu, uint8_t **buffer,
         }
     }
 
-    // Allocate memory for buffer
-    *buffer = (uint8_t *) malloc(buffer_size);
-    if (*buffer == NULL)
+    return buffer_size;
+}
+
+/**
+ * \brief Encodes APDU to its binary representation in caller provided buffer.
+ *
+ * \param[in] apdu APDU to be encoded.
+ * \param[out] buffer Buffer to store encoded data in.
+ * \param[in] buffer_size Number of bytes available in \p buffer.
+ * \param[out] buffer_len Pointer for storing number of bytes in \p buffer.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, \c
+ * IFX_ERROR(LIB_APDU, IFX_APDU_ENCODE_INTO, IFX_APDU_BUFFER_TOO_SMALL) if \p
+ * buffer is too small, any other value in case of error.
+ * \relates APDU
+ */
+ifx_status_t ifx_apdu_encode_into(const ifx_apdu_t *apdu, uint8_t *buffer,
+                                  size_t buffer_size, size_t *buffer_len)
+{
+    // Validate parameters
+    if ((apdu == NULL) || (buffer == NULL) || (buffer_len == NULL) ||
+        ((apdu->lc > 0U) && (apdu->data == NULL)))
     {
-        // clang-format off
-        return IFX_ERROR(LIB_APDU, IFX_APDU_ENCODE, IFX_OUT_OF_MEMORY); // LCOV_EXCL_LINE
-        // clang-format on
+        return IFX_ERROR(LIB_APDU, IFX_APDU_ENCODE_INTO, IFX_ILLEGAL_ARGUMENT);
     }
+    size_t encoded_size = ifx_apdu_encoded_size(apdu);
+    if (buffer_size < encoded_size)
+    {
+        *buffer_len = encoded_size;
+        return IFX_ERROR(LIB_APDU, IFX_APDU_ENCODE_INTO,
+                         IFX_APDU_BUFFER_TOO_SMALL);
+    }
+    bool extended_length = (apdu->lc > 0xffU) || (apdu->le > IFX_APDU_LE_ANY);
 
     // Encode header information
-    (*buffer)[0] = apdu->cla;
-    (*buffer)[1] = apdu->ins;
-    (*buffer)[2] = apdu->p1;
-    (*buffer)[3] = apdu->p2;
+    buffer[0] = apdu->cla;
+    buffer[1] = apdu->ins;
+    buffer[2] = apdu->p1;
+    buffer[3] = apdu->p2;
 
     // ISO7816-3 Case 3 or Case 4
     if (apdu->lc > 0x00U)
@@ -265,18 +291,18 @@ ifx_status_t ifx_apdu_encode(const ifx_apdu_t *apdu, uint8_t **buffer,
         // ISO7816-3 Case 3E or Case 4E
         if (extended_length)
         {
-            (*buffer)[offset] = 0x00U;
-            (*buffer)[offset + 1] = (apdu->lc & 0xff00U) >> 8;
-            (*buffer)[offset + 2] = apdu->lc & 0xffU;
+            buffer[offset] = 0x00U;
+            buffer[offset + 1] = (apdu->lc & 0xff00U) >> 8;
+            buffer[offset + 2] = apdu->lc & 0xffU;
             offset += 3;
         }
         // ISO7816-3 Case 3S or Case 4S
         else
         {
-            (*buffer)[offset] = apdu->lc & 0xffU;
+            buffer[offset] = apdu->lc & 0xffU;
             offset += 1U;
         }
-        memcpy((*buffer) + offset, apdu->data, apdu->lc); // Flawfinder: ignore
+        memcpy(buffer + offset, apdu->data, apdu->lc); // Flawfinder: ignore
         offset += apdu->lc;
 
         // ISO7816-3 Case 4
@@ -288,13 +314,13 @@ ifx_status_t ifx_apdu_encode(const ifx_apdu_t *apdu, uint8_t **buffer,
                 // Special case 0x10000 extends to {0x00, 0x00}
                 if (apdu->le == IFX_APDU_LE_ANY_EXTENDED)
                 {
-                    (*buffer)[offset] = 0x00U;
-                    (*buffer)[offset + 1] = 0x00U;
+                    buffer[offset] = 0x00U;
+                    buffer[offset + 1] = 0x00U;
                 }
                 else
                 {
-                    (*buffer)[offset] = (apdu->le & 0xff00U) >> 8;
-                    (*buffer)[offset + 1] = apdu->le & 0xffU;
+                    buffer[offset] = (apdu->le & 0xff00U) >> 8;
+                    buffer[offset + 1] = apdu->le & 0xffU;
                 }
             }
             // ISO7816-3 Case 4S
@@ -303,11 +329,11 @@ ifx_status_t ifx_apdu_encode(const ifx_apdu_t *apdu, uint8_t **buffer,
                 // Special case 0x100 extends to {0x00}
                 if (apdu->le == IFX_APDU_LE_ANY)
                 {
-                    (*buffer)[offset] = 0x00U;
+                    buffer[offset] = 0x00U;
                 }
                 else
                 {
-                    (*buffer)[offset] = apdu->le & 0xffU;
+                    buffer[offset] = apdu->le & 0xffU;
                 }
             }
         }
@@ -321,17 +347,17 @@ ifx_status_t ifx_apdu_encode(const ifx_apdu_t *apdu, uint8_t **buffer,
             // ISO7816-3 Case 2E
             if (extended_length)
             {
-                (*buffer)[4] = 0x00U;
+                buffer[4] = 0x00U;
                 // Special case 0x10000 extends to {0x00, 0x00}
                 if (apdu->le == IFX_APDU_LE_ANY_EXTENDED)
                 {
-                    (*buffer)[5] = 0x00U;
-                    (*buffer)[6] = 0x00U;
+                    buffer[5] = 0x00U;
+                    buffer[6] = 0x00U;
                 }
                 else
                 {
-                    (*buffer)[5] = (apdu->le & 0xff00U) >> 8;
-                    (*buffer)[6] = apdu->le & 0xffU;
+                    buffer[5] = (apdu->le & 0xff00U) >> 8;
+                    buffer[6] = apdu->le & 0xffU;
                 }
             }
             // ISO7816-3 Case 2S
@@ -340,20 +366,59 @@ ifx_status_t ifx_apdu_encode(const ifx_apdu_t *apdu, uint8_t **buffer,
                 // Special case 0x100 extends to {0x00}
                 if (apdu->le == IFX_APDU_LE_ANY)
                 {
-                    (*buffer)[4] = 0x00U;
+                    buffer[4] = 0x00U;
                 }
                 else
                 {
-                    (*buffer)[4] = apdu->le & 0xffU;
+                    buffer[4] = apdu->le & 0xffU;
                 }
             }
         }
     }
 
-    *buffer_len = buffer_size;
+    *buffer_len = encoded_size;
     return IFX_SUCCESS;
 }
 
+/**
+ * \brief Encodes APDU to its binary representation.
+ *
+ * \param[in] apdu APDU to be encoded.
+ * \param[out] buffer Buffer to store encoded data in.
+ * \param[out] buffer_len Pointer for storing number of bytes in \p buffer.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other value in
+ * case of error.
+ * \relates APDU
+ */
+ifx_status_t ifx_apdu_encode(const ifx_apdu_t *apdu, uint8_t **buffer,
+                             size_t *buffer_len)
+{
+    // Validate parameters
+    if ((apdu == NULL) || (buffer == NULL) || (buffer_len == NULL))
+    {
+        return IFX_ERROR(LIB_APDU, IFX_APDU_ENCODE, IFX_ILLEGAL_ARGUMENT);
+    }
+
+    // Allocate memory for buffer
+    size_t buffer_size = ifx_apdu_encoded_size(apdu);
+    *buffer = (uint8_t *) malloc(buffer_size);
+    if (*buffer == NULL)
+    {
+        // clang-format off
+        return IFX_ERROR(LIB_APDU, IFX_APDU_ENCODE, IFX_OUT_OF_MEMORY); // LCOV_EXCL_LINE
+        // clang-format on
+    }
+
+    ifx_status_t status =
+        ifx_apdu_encode_into(apdu, *buffer, buffer_size, buffer_len);
+    if (status != IFX_SUCCESS)
+    {
+        free(*buffer);
+        *buffer = NULL;
+    }
+    return status;
+}
+
 /**
  * \brief Frees memory associated with APDU object (but not object itself).
  *
@@ -422,6 +487,89 @@ ifx_status_t ifx_apdu_response_decode(ifx_apdu_response_t *response,
     return IFX_SUCCESS;
 }
 
+/**
+ * \brief Decodes binary data to ifx_apdu_response_t object borrowing the
+ * response data from \p data.
+ *
+ * \param[out] response ifx_apdu_response_t object to store values in.
+ * \param[in] data Binary data to be decoded (still owned by caller).
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \relates ifx_apdu_response_t
+ */
+ifx_status_t ifx_apdu_response_decode_view(ifx_apdu_response_t *response,
+                                           const uint8_t *data,
+                                           size_t data_len)
+{
+    // Validate parameters
+    if ((response == NULL) || (data == NULL))
+    {
+        return IFX_ERROR(LIB_APDU, IFX_APDU_RESPONSE_DECODE_VIEW,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    // Minimum APDU response length 2 bytes -> status word only
+    if (data_len < 2U)
+    {
+        return IFX_ERROR(LIB_APDU, IFX_APDU_RESPONSE_DECODE_VIEW,
+                         IFX_TOO_LITTLE_DATA);
+    }
+
+    // Reference data (never modified through view)
+    response->len = data_len - 2U;
+    response->data = (response->len > 0U) ? (uint8_t *) data : NULL;
+
+    // Decode status word
+    response->sw = (data[response->len] << 8) | data[response->len + 1];
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Decodes binary data to ifx_apdu_response_t object taking over
+ * ownership of \p data.
+ *
+ * \param[out] response ifx_apdu_response_t object to store values in.
+ * \param[in] data Dynamically allocated binary data to be decoded.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \relates ifx_apdu_response_t
+ */
+ifx_status_t ifx_apdu_response_decode_take(ifx_apdu_response_t *response,
+                                           uint8_t *data, size_t data_len)
+{
+    // Validate parameters
+    if ((response == NULL) || (data == NULL))
+    {
+        return IFX_ERROR(LIB_APDU, IFX_APDU_RESPONSE_DECODE_TAKE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    // Minimum APDU response length 2 bytes -> status word only
+    if (data_len < 2U)
+    {
+        return IFX_ERROR(LIB_APDU, IFX_APDU_RESPONSE_DECODE_TAKE,
+                         IFX_TOO_LITTLE_DATA);
+    }
+
+    // Decode status word
+    response->len = data_len - 2U;
+    response->sw = (data[response->len] << 8) | data[response->len + 1];
+
+    // Response data starts at beginning of buffer so it can simply be kept
+    if (response->len > 0U)
+    {
+        response->data = data;
+    }
+    else
+    {
+        free(data);
+        response->data = NULL;
+    }
+    return IFX_SUCCESS;
+}
+
 /**
  * \brief Encodes ifx_apdu_response_t to its binary representation.
  *
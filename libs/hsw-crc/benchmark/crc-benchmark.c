@@ -0,0 +1,246 @@
+// SPDX-FileCopyrightText: 2024 Infineon Technologies AG
+//
+// SPDX-License-Identifier: MIT
+
+/**
+ * \file crc-benchmark.c
+ * \brief Compares selected CRC engine against bitwise reference
+ * implementation for correctness and throughput.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "infineon/ifx-crc.h"
+
+#ifndef IFX_CRC_BENCHMARK_ENGINE_NAME
+#define IFX_CRC_BENCHMARK_ENGINE_NAME "UNKNOWN"
+#endif
+
+/**
+ * \brief Size of random test data used for correctness checks and benchmark.
+ */
+#define IFX_CRC_BENCHMARK_DATA_LEN 4096U
+
+/**
+ * \brief Number of passes over test data when measuring throughput.
+ */
+#define IFX_CRC_BENCHMARK_ITERATIONS 4096U
+
+/**
+ * \brief Function signature of all one-shot 16 bit CRC algorithms.
+ */
+typedef uint16_t (*ifx_crc16_t)(const uint8_t *data, size_t data_len);
+
+/**
+ * \brief Function signature of all incremental 16 bit CRC init functions.
+ */
+typedef uint16_t (*ifx_crc16_init_t)(void);
+
+/**
+ * \brief Function signature of all incremental 16 bit CRC update functions.
+ */
+typedef uint16_t (*ifx_crc16_update_t)(uint16_t crc, const uint8_t *data,
+                                       size_t data_len);
+
+/**
+ * \brief Function signature of all incremental 16 bit CRC final functions.
+ */
+typedef uint16_t (*ifx_crc16_final_t)(uint16_t crc);
+
+/**
+ * \brief Bitwise reference implementation of CCITT x.25 and MCRF4xx CRC.
+ *
+ * \param[in] data Data to calculate CRC over.
+ * \param[in] data_len Number of bytes in \p data.
+ * \param[in] xorout Value to be XORed to final CRC.
+ * \return uint16_t CRC over data.
+ */
+static uint16_t reference_crc16_8408(const uint8_t *data, size_t data_len,
+                                     uint16_t xorout)
+{
+    uint16_t crc = 0xffffU;
+    for (size_t i = 0U; i < data_len; i++)
+    {
+        crc ^= data[i];
+        for (size_t j = 0U; j < 8U; j++)
+        {
+            if ((crc & 1U) != 0U)
+            {
+                crc = (crc >> 1) ^ 0x8408U;
+            }
+            else
+            {
+                crc = crc >> 1U;
+            }
+        }
+    }
+    return crc ^ xorout;
+}
+
+/**
+ * \brief Bitwise reference implementation of CCITT x.25 CRC.
+ *
+ * \param[in] data Data to calculate CRC over.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return uint16_t CRC over data.
+ */
+static uint16_t reference_crc16_ccitt_x25(const uint8_t *data, size_t data_len)
+{
+    return reference_crc16_8408(data, data_len, 0xffffU);
+}
+
+/**
+ * \brief Bitwise reference implementation of MCRF4xx CRC.
+ *
+ * \param[in] data Data to calculate CRC over.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return uint16_t CRC over data.
+ */
+static uint16_t reference_crc16_mcrf4xx(const uint8_t *data, size_t data_len)
+{
+    return reference_crc16_8408(data, data_len, 0x0000U);
+}
+
+/**
+ * \brief Bitwise reference implementation of G+D T=1 CRC.
+ *
+ * \param[in] data Data to calculate CRC over.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return uint16_t CRC over data.
+ */
+static uint16_t reference_crc16_t1gd(const uint8_t *data, size_t data_len)
+{
+    uint16_t crc = 0xffffU;
+    for (size_t i = 0U; i < data_len; i++)
+    {
+        uint8_t read_byte = data[i];
+        for (size_t j = 0U; j < 8U; j++)
+        {
+            if ((crc ^ read_byte) & 0x01U)
+            {
+                crc ^= 0x10810U;
+            }
+            crc >>= 1U;
+            read_byte >>= 1U;
+        }
+    }
+    return crc;
+}
+
+/**
+ * \brief Description of single CRC algorithm under test.
+ */
+typedef struct
+{
+    const char *name;
+    ifx_crc16_t reference;
+    ifx_crc16_t crc;
+    ifx_crc16_init_t init;
+    ifx_crc16_update_t update;
+    ifx_crc16_final_t final;
+} crc_algorithm_t;
+
+/**
+ * \brief Checks one-shot and incremental API against reference for all
+ * lengths and split points up to given length.
+ *
+ * \param[in] algorithm Algorithm under test.
+ * \param[in] data Random test data.
+ * \param[in] max_len Maximum number of bytes to check.
+ * \return size_t Number of mismatches found.
+ */
+static size_t check_algorithm(const crc_algorithm_t *algorithm,
+                              const uint8_t *data, size_t max_len)
+{
+    size_t mismatches = 0U;
+    for (size_t len = 0U; len <= max_len; len++)
+    {
+        uint16_t expected = algorithm->reference(data, len);
+        if (algorithm->crc(data, len) != expected)
+        {
+            mismatches++;
+        }
+        for (size_t split = 0U; split <= len; split++)
+        {
+            uint16_t crc = algorithm->init();
+            crc = algorithm->update(crc, data, split);
+            crc = algorithm->update(crc, data + split, len - split);
+            if (algorithm->final(crc) != expected)
+            {
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * \brief Measures throughput of CRC function in MiB/s.
+ *
+ * \param[in] crc CRC function to measure.
+ * \param[in] data Random test data.
+ * \param[in] data_len Number of bytes in \p data.
+ * \param[out] checksum Accumulated CRC values (prevents optimizing away).
+ * \return double Throughput in MiB/s.
+ */
+static double measure_throughput(ifx_crc16_t crc, const uint8_t *data,
+                                 size_t data_len, uint16_t *checksum)
+{
+    clock_t start = clock();
+    for (size_t i = 0U; i < IFX_CRC_BENCHMARK_ITERATIONS; i++)
+    {
+        *checksum = (uint16_t) (*checksum + crc(data, data_len));
+    }
+    double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+    if (seconds <= 0.0)
+    {
+        seconds = 1.0 / CLOCKS_PER_SEC;
+    }
+    return ((double) data_len * IFX_CRC_BENCHMARK_ITERATIONS) /
+           (1024.0 * 1024.0) / seconds;
+}
+
+int main(void)
+{
+    static uint8_t data[IFX_CRC_BENCHMARK_DATA_LEN];
+    uint32_t seed = 0x12345678U;
+    for (size_t i = 0U; i < sizeof(data); i++)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        data[i] = (uint8_t) (seed >> 16);
+    }
+
+    const crc_algorithm_t algorithms[] = {
+        {"crc16_ccitt_x25", reference_crc16_ccitt_x25, ifx_crc16_ccitt_x25,
+         ifx_crc16_ccitt_x25_init, ifx_crc16_ccitt_x25_update,
+         ifx_crc16_ccitt_x25_final},
+        {"crc16_mcrf4xx", reference_crc16_mcrf4xx, ifx_crc16_mcrf4xx,
+         ifx_crc16_mcrf4xx_init, ifx_crc16_mcrf4xx_update,
+         ifx_crc16_mcrf4xx_final},
+        {"crc16_t1gd", reference_crc16_t1gd, ifx_crc16_t1gd,
+         ifx_crc16_t1gd_init, ifx_crc16_t1gd_update, ifx_crc16_t1gd_final}};
+
+    int result = EXIT_SUCCESS;
+    uint16_t checksum = 0U;
+    printf("CRC engine: %s\n", IFX_CRC_BENCHMARK_ENGINE_NAME);
+    for (size_t i = 0U; i < (sizeof(algorithms) / sizeof(algorithms[0])); i++)
+    {
+        const crc_algorithm_t *algorithm = &algorithms[i];
+        size_t mismatches = check_algorithm(algorithm, data, 300U);
+        double reference = measure_throughput(algorithm->reference, data,
+                                              sizeof(data), &checksum);
+        double engine = measure_throughput(algorithm->crc, data, sizeof(data),
+                                           &checksum);
+        printf("%-16s %s  reference %9.1f MiB/s  engine %9.1f MiB/s  "
+               "(x%.1f)\n",
+               algorithm->name, (mismatches == 0U) ? "OK  " : "FAIL",
+               reference, engine, engine / reference);
+        if (mismatches != 0U)
+        {
+            result = EXIT_FAILURE;
+        }
+    }
+    printf("checksum %04x\n", checksum);
+    return result;
+}
@@ -16,6 +16,41 @@
 extern "C" {
 #endif
 
+/**
+ * \brief CRC engine processing one bit per iteration (smallest footprint).
+ */
+#define IFX_CRC_ENGINE_BITWISE    0
+
+/**
+ * \brief CRC engine using one 256 entry lookup table per polynomial.
+ */
+#define IFX_CRC_ENGINE_TABLE      1
+
+/**
+ * \brief CRC engine processing 4 bytes per iteration using 4 lookup tables
+ * per polynomial.
+ */
+#define IFX_CRC_ENGINE_SLICE_BY_4 4
+
+/**
+ * \brief CRC engine processing 8 bytes per iteration using 8 lookup tables
+ * per polynomial.
+ */
+#define IFX_CRC_ENGINE_SLICE_BY_8 8
+
+/**
+ * \def IFX_CRC_ENGINE
+ * \brief Compile time selection of CRC engine used by all 16 bit CRC
+ * algorithms.
+ *
+ * \details One of \ref IFX_CRC_ENGINE_BITWISE, \ref IFX_CRC_ENGINE_TABLE, \ref
+ * IFX_CRC_ENGINE_SLICE_BY_4 or \ref IFX_CRC_ENGINE_SLICE_BY_8. All engines
+ * calculate identical values and only differ in speed and memory footprint.
+ */
+#ifndef IFX_CRC_ENGINE
+#define IFX_CRC_ENGINE IFX_CRC_ENGINE_TABLE
+#endif
+
 /**
  * \brief Calculates 16 bit CRC according to CCITT x.25 specification.
  *
@@ -25,6 +60,45 @@ extern "C" {
  */
 uint16_t ifx_crc16_ccitt_x25(const uint8_t *data, size_t data_len);
 
+/**
+ * \brief Starts incremental 16 bit CRC calculation according to CCITT x.25
+ * specification.
+ *
+ * \details Use ifx_crc16_ccitt_x25_update() to add data and
+ * ifx_crc16_ccitt_x25_final() to get the final CRC.
+ *
+ * \code
+ *      uint16_t crc = ifx_crc16_ccitt_x25_init();
+ *      crc = ifx_crc16_ccitt_x25_update(crc, prologue, prologue_len);
+ *      crc = ifx_crc16_ccitt_x25_update(crc, payload, payload_len);
+ *      crc = ifx_crc16_ccitt_x25_final(crc);
+ * \endcode
+ *
+ * \return uint16_t Intermediate CRC state.
+ */
+uint16_t ifx_crc16_ccitt_x25_init(void);
+
+/**
+ * \brief Adds data to incremental 16 bit CRC calculation according to CCITT
+ * x.25 specification.
+ *
+ * \param[in] crc Intermediate CRC state.
+ * \param[in] data Data to calculate CRC over.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return uint16_t Updated intermediate CRC state.
+ */
+uint16_t ifx_crc16_ccitt_x25_update(uint16_t crc, const uint8_t *data,
+                                    size_t data_len);
+
+/**
+ * \brief Finishes incremental 16 bit CRC calculation according to CCITT x.25
+ * specification.
+ *
+ * \param[in] crc Intermediate CRC state.
+ * \return uint16_t CRC over all data.
+ */
+uint16_t ifx_crc16_ccitt_x25_final(uint16_t crc);
+
 /**
  * \brief Calculates 16 bit CRC according to MCRF4xx specification.
  *
@@ -34,6 +108,36 @@ uint16_t ifx_crc16_ccitt_x25(const uint8_t *data, size_t data_len);
  */
 uint16_t ifx_crc16_mcrf4xx(const uint8_t *data, size_t data_len);
 
+/**
+ * \brief Starts incremental 16 bit CRC calculation according to MCRF4xx
+ * specification.
+ *
+ * \return uint16_t Intermediate CRC state.
+ * \see ifx_crc16_ccitt_x25_init()
+ */
+uint16_t ifx_crc16_mcrf4xx_init(void);
+
+/**
+ * \brief Adds data to incremental 16 bit CRC calculation according to MCRF4xx
+ * specification.
+ *
+ * \param[in] crc Intermediate CRC state.
+ * \param[in] data Data to calculate CRC over.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return uint16_t Updated intermediate CRC state.
+ */
+uint16_t ifx_crc16_mcrf4xx_update(uint16_t crc, const uint8_t *data,
+                                  size_t data_len);
+
+/**
+ * \brief Finishes incremental 16 bit CRC calculation according to MCRF4xx
+ * specification.
+ *
+ * \param[in] crc Intermediate CRC state.
+ * \return uint16_t CRC over all data.
+ */
+uint16_t ifx_crc16_mcrf4xx_final(uint16_t crc);
+
 /**
  * \brief Calculates 16 bit CRC according to G+D T=1 protocol specification.
  *
@@ -43,6 +147,36 @@ uint16_t ifx_crc16_mcrf4xx(const uint8_t *data, size_t data_len);
  */
 uint16_t ifx_crc16_t1gd(const uint8_t *data, size_t data_len);
 
+/**
+ * \brief Starts incremental 16 bit CRC calculation according to G+D T=1
+ * protocol specification.
+ *
+ * \return uint16_t Intermediate CRC state.
+ * \see ifx_crc16_ccitt_x25_init()
+ */
+uint16_t ifx_crc16_t1gd_init(void);
+
+/**
+ * \brief Adds data to incremental 16 bit CRC calculation according to G+D T=1
+ * protocol specification.
+ *
+ * \param[in] crc Intermediate CRC state.
+ * \param[in] data Data to calculate CRC over.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return uint16_t Updated intermediate CRC state.
+ */
+uint16_t ifx_crc16_t1gd_update(uint16_t crc, const uint8_t *data,
+                               size_t data_len);
+
+/**
+ * \brief Finishes incremental 16 bit CRC calculation according to G+D T=1
+ * protocol specification.
+ *
+ * \param[in] crc Intermediate CRC state.
+ * \return uint16_t CRC over all data.
+ */
+uint16_t ifx_crc16_t1gd_final(uint16_t crc);
+
 /**
  * \brief Calculates 8 bit Longitudinal Redundancy Code (LRC).
  *
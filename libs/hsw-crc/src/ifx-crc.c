@@ -8,16 +8,107 @@
  */
 #include "infineon/ifx-crc.h"
 
+#if IFX_CRC_ENGINE == IFX_CRC_ENGINE_TABLE
+#define IFX_CRC_TABLE_SLICES 1
+#elif IFX_CRC_ENGINE == IFX_CRC_ENGINE_SLICE_BY_4
+#define IFX_CRC_TABLE_SLICES 4
+#elif IFX_CRC_ENGINE == IFX_CRC_ENGINE_SLICE_BY_8
+#define IFX_CRC_TABLE_SLICES 8
+#elif IFX_CRC_ENGINE != IFX_CRC_ENGINE_BITWISE
+#error "Unsupported IFX_CRC_ENGINE selected"
+#endif
+
+#ifdef IFX_CRC_TABLE_SLICES
+#include "ifx-crc-tables.h"
+
 /**
- * \brief Calculates 16 bit CRC according to CCITT x.25 specification.
+ * \brief Kernel parameter for reflected 16 bit CRC calculation (lookup table
+ * slices of polynomial).
+ */
+typedef const uint16_t (*ifx_crc16_kernel_t)[256];
+
+/**
+ * \brief Kernel for reflected 16 bit CRC with polynomial 0x8408.
+ */
+#define IFX_CRC16_KERNEL_8408 IFX_CRC16_TABLE_8408
+
+/**
+ * \brief Kernel for reflected 16 bit CRC with polynomial 0x0408.
+ */
+#define IFX_CRC16_KERNEL_0408 IFX_CRC16_TABLE_0408
+
+/**
+ * \brief Updates reflected 16 bit CRC using lookup tables.
+ *
+ * \details Processes `IFX_CRC_TABLE_SLICES` bytes per iteration as long as
+ * enough data is available and falls back to one byte per iteration for the
+ * remainder.
  *
+ * \param[in] crc Intermediate CRC state.
  * \param[in] data Data to calculate CRC over.
  * \param[in] data_len Number of bytes in \p data.
- * \return uint16_t CRC over data.
+ * \param[in] table Lookup table slices for polynomial.
+ * \return uint16_t Updated intermediate CRC state.
  */
-uint16_t ifx_crc16_ccitt_x25(const uint8_t *data, size_t data_len)
+static uint16_t ifx_crc16_reflected_update(uint16_t crc, const uint8_t *data,
+                                           size_t data_len,
+                                           ifx_crc16_kernel_t table)
+{
+    size_t i = 0U;
+#if IFX_CRC_TABLE_SLICES == 8
+    for (; (data_len - i) >= 8U; i += 8U)
+    {
+        crc ^= (uint16_t) (data[i] | (data[i + 1U] << 8));
+        crc = table[7][crc & 0xffU] ^ table[6][crc >> 8] ^
+              table[5][data[i + 2U]] ^ table[4][data[i + 3U]] ^
+              table[3][data[i + 4U]] ^ table[2][data[i + 5U]] ^
+              table[1][data[i + 6U]] ^ table[0][data[i + 7U]];
+    }
+#elif IFX_CRC_TABLE_SLICES == 4
+    for (; (data_len - i) >= 4U; i += 4U)
+    {
+        crc ^= (uint16_t) (data[i] | (data[i + 1U] << 8));
+        crc = table[3][crc & 0xffU] ^ table[2][crc >> 8] ^
+              table[1][data[i + 2U]] ^ table[0][data[i + 3U]];
+    }
+#endif
+    for (; i < data_len; i++)
+    {
+        crc = (crc >> 8) ^ table[0][(crc ^ data[i]) & 0xffU];
+    }
+    return crc;
+}
+#else
+
+/**
+ * \brief Kernel parameter for reflected 16 bit CRC calculation (reflected
+ * polynomial).
+ */
+typedef uint16_t ifx_crc16_kernel_t;
+
+/**
+ * \brief Kernel for reflected 16 bit CRC with polynomial 0x8408.
+ */
+#define IFX_CRC16_KERNEL_8408 0x8408U
+
+/**
+ * \brief Kernel for reflected 16 bit CRC with polynomial 0x0408.
+ */
+#define IFX_CRC16_KERNEL_0408 0x0408U
+
+/**
+ * \brief Updates reflected 16 bit CRC one bit at a time.
+ *
+ * \param[in] crc Intermediate CRC state.
+ * \param[in] data Data to calculate CRC over.
+ * \param[in] data_len Number of bytes in \p data.
+ * \param[in] polynomial Reflected polynomial.
+ * \return uint16_t Updated intermediate CRC state.
+ */
+static uint16_t ifx_crc16_reflected_update(uint16_t crc, const uint8_t *data,
+                                           size_t data_len,
+                                           ifx_crc16_kernel_t polynomial)
 {
-    uint16_t crc = 0xffffU;
     for (size_t i = 0U; i < data_len; i++)
     {
         crc ^= data[i];
@@ -25,7 +116,7 @@ uint16_t ifx_crc16_ccitt_x25(const uint8_t *data, size_t data_len)
         {
             if ((crc & 1U) != 0U)
             {
-                crc = (crc >> 1) ^ 0x8408U;
+                crc = (crc >> 1) ^ polynomial;
             }
             else
             {
@@ -33,6 +124,60 @@ uint16_t ifx_crc16_ccitt_x25(const uint8_t *data, size_t data_len)
             }
         }
     }
+    return crc;
+}
+#endif
+
+/**
+ * \brief Calculates 16 bit CRC according to CCITT x.25 specification.
+ *
+ * \param[in] data Data to calculate CRC over.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return uint16_t CRC over data.
+ */
+uint16_t ifx_crc16_ccitt_x25(const uint8_t *data, size_t data_len)
+{
+    uint16_t crc = ifx_crc16_ccitt_x25_init();
+    crc = ifx_crc16_ccitt_x25_update(crc, data, data_len);
+    return ifx_crc16_ccitt_x25_final(crc);
+}
+
+/**
+ * \brief Starts incremental 16 bit CRC calculation according to CCITT x.25
+ * specification.
+ *
+ * \return uint16_t Intermediate CRC state.
+ */
+uint16_t ifx_crc16_ccitt_x25_init(void)
+{
+    return 0xffffU;
+}
+
+/**
+ * \brief Adds data to incremental 16 bit CRC calculation according to CCITT
+ * x.25 specification.
+ *
+ * \param[in] crc Intermediate CRC state.
+ * \param[in] data Data to calculate CRC over.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return uint16_t Updated intermediate CRC state.
+ */
+uint16_t ifx_crc16_ccitt_x25_update(uint16_t crc, const uint8_t *data,
+                                    size_t data_len)
+{
+    return ifx_crc16_reflected_update(crc, data, data_len,
+                                      IFX_CRC16_KERNEL_8408);
+}
+
+/**
+ * \brief Finishes incremental 16 bit CRC calculation according to CCITT x.25
+ * specification.
+ *
+ * \param[in] crc Intermediate CRC state.
+ * \return uint16_t CRC over all data.
+ */
+uint16_t ifx_crc16_ccitt_x25_final(uint16_t crc)
+{
     return crc ^ 0xffffU;
 }
 
@@ -45,22 +190,47 @@ uint16_t ifx_crc16_ccitt_x25(const uint8_t *data, size_t data_len)
  */
 uint16_t ifx_crc16_mcrf4xx(const uint8_t *data, size_t data_len)
 {
-    uint16_t crc = 0xffffU;
-    for (size_t i = 0U; i < data_len; i++)
-    {
-        crc ^= data[i];
-        for (size_t j = 0U; j < 8U; j++)
-        {
-            if ((crc & 1) != 0)
-            {
-                crc = (crc >> 1) ^ 0x8408U;
-            }
-            else
-            {
-                crc = crc >> 1U;
-            }
-        }
-    }
+    uint16_t crc = ifx_crc16_mcrf4xx_init();
+    crc = ifx_crc16_mcrf4xx_update(crc, data, data_len);
+    return ifx_crc16_mcrf4xx_final(crc);
+}
+
+/**
+ * \brief Starts incremental 16 bit CRC calculation according to MCRF4xx
+ * specification.
+ *
+ * \return uint16_t Intermediate CRC state.
+ */
+uint16_t ifx_crc16_mcrf4xx_init(void)
+{
+    return 0xffffU;
+}
+
+/**
+ * \brief Adds data to incremental 16 bit CRC calculation according to MCRF4xx
+ * specification.
+ *
+ * \param[in] crc Intermediate CRC state.
+ * \param[in] data Data to calculate CRC over.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return uint16_t Updated intermediate CRC state.
+ */
+uint16_t ifx_crc16_mcrf4xx_update(uint16_t crc, const uint8_t *data,
+                                  size_t data_len)
+{
+    return ifx_crc16_reflected_update(crc, data, data_len,
+                                      IFX_CRC16_KERNEL_8408);
+}
+
+/**
+ * \brief Finishes incremental 16 bit CRC calculation according to MCRF4xx
+ * specification.
+ *
+ * \param[in] crc Intermediate CRC state.
+ * \return uint16_t CRC over all data.
+ */
+uint16_t ifx_crc16_mcrf4xx_final(uint16_t crc)
+{
     return crc;
 }
 
@@ -73,20 +243,50 @@ uint16_t ifx_crc16_mcrf4xx(const uint8_t *data, size_t data_len)
  */
 uint16_t ifx_crc16_t1gd(const uint8_t *data, size_t data_len)
 {
-    uint16_t crc = 0xffffU;
-    for (size_t i = 0U; i < data_len; i++)
-    {
-        uint8_t read_byte = data[i];
-        for (size_t j = 0U; j < 8U; j++)
-        {
-            if ((crc ^ read_byte) & 0x01U)
-            {
-                crc ^= 0x10810U;
-            }
-            crc >>= 1U;
-            read_byte >>= 1U;
-        }
-    }
+    uint16_t crc = ifx_crc16_t1gd_init();
+    crc = ifx_crc16_t1gd_update(crc, data, data_len);
+    return ifx_crc16_t1gd_final(crc);
+}
+
+/**
+ * \brief Starts incremental 16 bit CRC calculation according to G+D T=1
+ * protocol specification.
+ *
+ * \return uint16_t Intermediate CRC state.
+ */
+uint16_t ifx_crc16_t1gd_init(void)
+{
+    return 0xffffU;
+}
+
+/**
+ * \brief Adds data to incremental 16 bit CRC calculation according to G+D T=1
+ * protocol specification.
+ *
+ * \details The specification uses polynomial 0x10810 on a 16 bit register
+ * which is equivalent to the reflected polynomial 0x0408.
+ *
+ * \param[in] crc Intermediate CRC state.
+ * \param[in] data Data to calculate CRC over.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return uint16_t Updated intermediate CRC state.
+ */
+uint16_t ifx_crc16_t1gd_update(uint16_t crc, const uint8_t *data,
+                               size_t data_len)
+{
+    return ifx_crc16_reflected_update(crc, data, data_len,
+                                      IFX_CRC16_KERNEL_0408);
+}
+
+/**
+ * \brief Finishes incremental 16 bit CRC calculation according to G+D T=1
+ * protocol specification.
+ *
+ * \param[in] crc Intermediate CRC state.
+ * \return uint16_t CRC over all data.
+ */
+uint16_t ifx_crc16_t1gd_final(uint16_t crc)
+{
     return crc;
 }
 
@@ -0,0 +1,596 @@
+// SPDX-FileCopyrightText: 2024 Infineon Technologies AG
+//
+// SPDX-License-Identifier: MIT
+
+/**
+ * \file ifx-crc-tables.h
+ * \brief Precomputed lookup tables for table-driven CRC engines.
+ *
+ * \details Only included by ifx-crc.c if a table-driven engine has been
+ * selected via \ref IFX_CRC_ENGINE. The number of slices compiled in depends
+ * on the selected engine (1, 4 or 8 slices of 256 entries each).
+ */
+#ifndef IFX_CRC_TABLES_H
+#define IFX_CRC_TABLES_H
+
+#include <stdint.h>
+
+#ifndef IFX_CRC_TABLE_SLICES
+#error "IFX_CRC_TABLE_SLICES must be defined before including ifx-crc-tables.h"
+#endif
+
+// clang-format off
+/**
+ * \brief Lookup tables for reflected 16 bit CRC with polynomial 0x8408
+ * (CCITT x.25 / MCRF4xx).
+ *
+ * \details Slice \c k holds the CRC contribution of a byte followed by \c k
+ * zero bytes.
+ */
+static const uint16_t IFX_CRC16_TABLE_8408[IFX_CRC_TABLE_SLICES][256] = {
+    {
+        0x0000U, 0x1189U, 0x2312U, 0x329BU, 0x4624U, 0x57ADU, 0x6536U, 0x74BFU,
+        0x8C48U, 0x9DC1U, 0xAF5AU, 0xBED3U, 0xCA6CU, 0xDBE5U, 0xE97EU, 0xF8F7U,
+        0x1081U, 0x0108U, 0x3393U, 0x221AU, 0x56A5U, 0x472CU, 0x75B7U, 0x643EU,
+        0x9CC9U, 0x8D40U, 0xBFDBU, 0xAE52U, 0xDAEDU, 0xCB64U, 0xF9FFU, 0xE876U,
+        0x2102U, 0x308BU, 0x0210U, 0x1399U, 0x6726U, 0x76AFU, 0x4434U, 0x55BDU,
+        0xAD4AU, 0xBCC3U, 0x8E58U, 0x9FD1U, 0xEB6EU, 0xFAE7U, 0xC87CU, 0xD9F5U,
+        0x3183U, 0x200AU, 0x1291U, 0x0318U, 0x77A7U, 0x662EU, 0x54B5U, 0x453CU,
+        0xBDCBU, 0xAC42U, 0x9ED9U, 0x8F50U, 0xFBEFU, 0xEA66U, 0xD8FDU, 0xC974U,
+        0x4204U, 0x538DU, 0x6116U, 0x709FU, 0x0420U, 0x15A9U, 0x2732U, 0x36BBU,
+        0xCE4CU, 0xDFC5U, 0xED5EU, 0xFCD7U, 0x8868U, 0x99E1U, 0xAB7AU, 0xBAF3U,
+        0x5285U, 0x430CU, 0x7197U, 0x601EU, 0x14A1U, 0x0528U, 0x37B3U, 0x263AU,
+        0xDECDU, 0xCF44U, 0xFDDFU, 0xEC56U, 0x98E9U, 0x8960U, 0xBBFBU, 0xAA72U,
+        0x6306U, 0x728FU, 0x4014U, 0x519DU, 0x2522U, 0x34ABU, 0x0630U, 0x17B9U,
+        0xEF4EU, 0xFEC7U, 0xCC5CU, 0xDDD5U, 0xA96AU, 0xB8E3U, 0x8A78U, 0x9BF1U,
+        0x7387U, 0x620EU, 0x5095U, 0x411CU, 0x35A3U, 0x242AU, 0x16B1U, 0x0738U,
+        0xFFCFU, 0xEE46U, 0xDCDDU, 0xCD54U, 0xB9EBU, 0xA862U, 0x9AF9U, 0x8B70U,
+        0x8408U, 0x9581U, 0xA71AU, 0xB693U, 0xC22CU, 0xD3A5U, 0xE13EU, 0xF0B7U,
+        0x0840U, 0x19C9U, 0x2B52U, 0x3ADBU, 0x4E64U, 0x5FEDU, 0x6D76U, 0x7CFFU,
+        0x9489U, 0x8500U, 0xB79BU, 0xA612U, 0xD2ADU, 0xC324U, 0xF1BFU, 0xE036U,
+        0x18C1U, 0x0948U, 0x3BD3U, 0x2A5AU, 0x5EE5U, 0x4F6CU, 0x7DF7U, 0x6C7EU,
+        0xA50AU, 0xB483U, 0x8618U, 0x9791U, 0xE32EU, 0xF2A7U, 0xC03CU, 0xD1B5U,
+        0x2942U, 0x38CBU, 0x0A50U, 0x1BD9U, 0x6F66U, 0x7EEFU, 0x4C74U, 0x5DFDU,
+        0xB58BU, 0xA402U, 0x9699U, 0x8710U, 0xF3AFU, 0xE226U, 0xD0BDU, 0xC134U,
+        0x39C3U, 0x284AU, 0x1AD1U, 0x0B58U, 0x7FE7U, 0x6E6EU, 0x5CF5U, 0x4D7CU,
+        0xC60CU, 0xD785U, 0xE51EU, 0xF497U, 0x8028U, 0x91A1U, 0xA33AU, 0xB2B3U,
+        0x4A44U, 0x5BCDU, 0x6956U, 0x78DFU, 0x0C60U, 0x1DE9U, 0x2F72U, 0x3EFBU,
+        0xD68DU, 0xC704U, 0xF59FU, 0xE416U, 0x90A9U, 0x8120U, 0xB3BBU, 0xA232U,
+        0x5AC5U, 0x4B4CU, 0x79D7U, 0x685EU, 0x1CE1U, 0x0D68U, 0x3FF3U, 0x2E7AU,
+        0xE70EU, 0xF687U, 0xC41CU, 0xD595U, 0xA12AU, 0xB0A3U, 0x8238U, 0x93B1U,
+        0x6B46U, 0x7ACFU, 0x4854U, 0x59DDU, 0x2D62U, 0x3CEBU, 0x0E70U, 0x1FF9U,
+        0xF78FU, 0xE606U, 0xD49DU, 0xC514U, 0xB1ABU, 0xA022U, 0x92B9U, 0x8330U,
+        0x7BC7U, 0x6A4EU, 0x58D5U, 0x495CU, 0x3DE3U, 0x2C6AU, 0x1EF1U, 0x0F78U,
+    },
+#if IFX_CRC_TABLE_SLICES >= 4
+    {
+        0x0000U, 0x19D8U, 0x33B0U, 0x2A68U, 0x6760U, 0x7EB8U, 0x54D0U, 0x4D08U,
+        0xCEC0U, 0xD718U, 0xFD70U, 0xE4A8U, 0xA9A0U, 0xB078U, 0x9A10U, 0x83C8U,
+        0x9591U, 0x8C49U, 0xA621U, 0xBFF9U, 0xF2F1U, 0xEB29U, 0xC141U, 0xD899U,
+        0x5B51U, 0x4289U, 0x68E1U, 0x7139U, 0x3C31U, 0x25E9U, 0x0F81U, 0x1659U,
+        0x2333U, 0x3AEBU, 0x1083U, 0x095BU, 0x4453U, 0x5D8BU, 0x77E3U, 0x6E3BU,
+        0xEDF3U, 0xF42BU, 0xDE43U, 0xC79BU, 0x8A93U, 0x934BU, 0xB923U, 0xA0FBU,
+        0xB6A2U, 0xAF7AU, 0x8512U, 0x9CCAU, 0xD1C2U, 0xC81AU, 0xE272U, 0xFBAAU,
+        0x7862U, 0x61BAU, 0x4BD2U, 0x520AU, 0x1F02U, 0x06DAU, 0x2CB2U, 0x356AU,
+        0x4666U, 0x5FBEU, 0x75D6U, 0x6C0EU, 0x2106U, 0x38DEU, 0x12B6U, 0x0B6EU,
+        0x88A6U, 0x917EU, 0xBB16U, 0xA2CEU, 0xEFC6U, 0xF61EU, 0xDC76U, 0xC5AEU,
+        0xD3F7U, 0xCA2FU, 0xE047U, 0xF99FU, 0xB497U, 0xAD4FU, 0x8727U, 0x9EFFU,
+        0x1D37U, 0x04EFU, 0x2E87U, 0x375FU, 0x7A57U, 0x638FU, 0x49E7U, 0x503FU,
+        0x6555U, 0x7C8DU, 0x56E5U, 0x4F3DU, 0x0235U, 0x1BEDU, 0x3185U, 0x285DU,
+        0xAB95U, 0xB24DU, 0x9825U, 0x81FDU, 0xCCF5U, 0xD52DU, 0xFF45U, 0xE69DU,
+        0xF0C4U, 0xE91CU, 0xC374U, 0xDAACU, 0x97A4U, 0x8E7CU, 0xA414U, 0xBDCCU,
+        0x3E04U, 0x27DCU, 0x0DB4U, 0x146CU, 0x5964U, 0x40BCU, 0x6AD4U, 0x730CU,
+        0x8CCCU, 0x9514U, 0xBF7CU, 0xA6A4U, 0xEBACU, 0xF274U, 0xD81CU, 0xC1C4U,
+        0x420CU, 0x5BD4U, 0x71BCU, 0x6864U, 0x256CU, 0x3CB4U, 0x16DCU, 0x0F04U,
+        0x195DU, 0x0085U, 0x2AEDU, 0x3335U, 0x7E3DU, 0x67E5U, 0x4D8DU, 0x5455U,
+        0xD79DU, 0xCE45U, 0xE42DU, 0xFDF5U, 0xB0FDU, 0xA925U, 0x834DU, 0x9A95U,
+        0xAFFFU, 0xB627U, 0x9C4FU, 0x8597U, 0xC89FU, 0xD147U, 0xFB2FU, 0xE2F7U,
+        0x613FU, 0x78E7U, 0x528FU, 0x4B57U, 0x065FU, 0x1F87U, 0x35EFU, 0x2C37U,
+        0x3A6EU, 0x23B6U, 0x09DEU, 0x1006U, 0x5D0EU, 0x44D6U, 0x6EBEU, 0x7766U,
+        0xF4AEU, 0xED76U, 0xC71EU, 0xDEC6U, 0x93CEU, 0x8A16U, 0xA07EU, 0xB9A6U,
+        0xCAAAU, 0xD372U, 0xF91AU, 0xE0C2U, 0xADCAU, 0xB412U, 0x9E7AU, 0x87A2U,
+        0x046AU, 0x1DB2U, 0x37DAU, 0x2E02U, 0x630AU, 0x7AD2U, 0x50BAU, 0x4962U,
+        0x5F3BU, 0x46E3U, 0x6C8BU, 0x7553U, 0x385BU, 0x2183U, 0x0BEBU, 0x1233U,
+        0x91FBU, 0x8823U, 0xA24BU, 0xBB93U, 0xF69BU, 0xEF43U, 0xC52BU, 0xDCF3U,
+        0xE999U, 0xF041U, 0xDA29U, 0xC3F1U, 0x8EF9U, 0x9721U, 0xBD49U, 0xA491U,
+        0x2759U, 0x3E81U, 0x14E9U, 0x0D31U, 0x4039U, 0x59E1U, 0x7389U, 0x6A51U,
+        0x7C08U, 0x65D0U, 0x4FB8U, 0x5660U, 0x1B68U, 0x02B0U, 0x28D8U, 0x3100U,
+        0xB2C8U, 0xAB10U, 0x8178U, 0x98A0U, 0xD5A8U, 0xCC70U, 0xE618U, 0xFFC0U,
+    },
+    {
+        0x0000U, 0x5ADCU, 0xB5B8U, 0xEF64U, 0x6361U, 0x39BDU, 0xD6D9U, 0x8C05U,
+        0xC6C2U, 0x9C1EU, 0x737AU, 0x29A6U, 0xA5A3U, 0xFF7FU, 0x101BU, 0x4AC7U,
+        0x8595U, 0xDF49U, 0x302DU, 0x6AF1U, 0xE6F4U, 0xBC28U, 0x534CU, 0x0990U,
+        0x4357U, 0x198BU, 0xF6EFU, 0xAC33U, 0x2036U, 0x7AEAU, 0x958EU, 0xCF52U,
+        0x033BU, 0x59E7U, 0xB683U, 0xEC5FU, 0x605AU, 0x3A86U, 0xD5E2U, 0x8F3EU,
+        0xC5F9U, 0x9F25U, 0x7041U, 0x2A9DU, 0xA698U, 0xFC44U, 0x1320U, 0x49FCU,
+        0x86AEU, 0xDC72U, 0x3316U, 0x69CAU, 0xE5CFU, 0xBF13U, 0x5077U, 0x0AABU,
+        0x406CU, 0x1AB0U, 0xF5D4U, 0xAF08U, 0x230DU, 0x79D1U, 0x96B5U, 0xCC69U,
+        0x0676U, 0x5CAAU, 0xB3CEU, 0xE912U, 0x6517U, 0x3FCBU, 0xD0AFU, 0x8A73U,
+        0xC0B4U, 0x9A68U, 0x750CU, 0x2FD0U, 0xA3D5U, 0xF909U, 0x166DU, 0x4CB1U,
+        0x83E3U, 0xD93FU, 0x365BU, 0x6C87U, 0xE082U, 0xBA5EU, 0x553AU, 0x0FE6U,
+        0x4521U, 0x1FFDU, 0xF099U, 0xAA45U, 0x2640U, 0x7C9CU, 0x93F8U, 0xC924U,
+        0x054DU, 0x5F91U, 0xB0F5U, 0xEA29U, 0x662CU, 0x3CF0U, 0xD394U, 0x8948U,
+        0xC38FU, 0x9953U, 0x7637U, 0x2CEBU, 0xA0EEU, 0xFA32U, 0x1556U, 0x4F8AU,
+        0x80D8U, 0xDA04U, 0x3560U, 0x6FBCU, 0xE3B9U, 0xB965U, 0x5601U, 0x0CDDU,
+        0x461AU, 0x1CC6U, 0xF3A2U, 0xA97EU, 0x257BU, 0x7FA7U, 0x90C3U, 0xCA1FU,
+        0x0CECU, 0x5630U, 0xB954U, 0xE388U, 0x6F8DU, 0x3551U, 0xDA35U, 0x80E9U,
+        0xCA2EU, 0x90F2U, 0x7F96U, 0x254AU, 0xA94FU, 0xF393U, 0x1CF7U, 0x462BU,
+        0x8979U, 0xD3A5U, 0x3CC1U, 0x661DU, 0xEA18U, 0xB0C4U, 0x5FA0U, 0x057CU,
+        0x4FBBU, 0x1567U, 0xFA03U, 0xA0DFU, 0x2CDAU, 0x7606U, 0x9962U, 0xC3BEU,
+        0x0FD7U, 0x550BU, 0xBA6FU, 0xE0B3U, 0x6CB6U, 0x366AU, 0xD90EU, 0x83D2U,
+        0xC915U, 0x93C9U, 0x7CADU, 0x2671U, 0xAA74U, 0xF0A8U, 0x1FCCU, 0x4510U,
+        0x8A42U, 0xD09EU, 0x3FFAU, 0x6526U, 0xE923U, 0xB3FFU, 0x5C9BU, 0x0647U,
+        0x4C80U, 0x165CU, 0xF938U, 0xA3E4U, 0x2FE1U, 0x753DU, 0x9A59U, 0xC085U,
+        0x0A9AU, 0x5046U, 0xBF22U, 0xE5FEU, 0x69FBU, 0x3327U, 0xDC43U, 0x869FU,
+        0xCC58U, 0x9684U, 0x79E0U, 0x233CU, 0xAF39U, 0xF5E5U, 0x1A81U, 0x405DU,
+        0x8F0FU, 0xD5D3U, 0x3AB7U, 0x606BU, 0xEC6EU, 0xB6B2U, 0x59D6U, 0x030AU,
+        0x49CDU, 0x1311U, 0xFC75U, 0xA6A9U, 0x2AACU, 0x7070U, 0x9F14U, 0xC5C8U,
+        0x09A1U, 0x537DU, 0xBC19U, 0xE6C5U, 0x6AC0U, 0x301CU, 0xDF78U, 0x85A4U,
+        0xCF63U, 0x95BFU, 0x7ADBU, 0x2007U, 0xAC02U, 0xF6DEU, 0x19BAU, 0x4366U,
+        0x8C34U, 0xD6E8U, 0x398CU, 0x6350U, 0xEF55U, 0xB589U, 0x5AEDU, 0x0031U,
+        0x4AF6U, 0x102AU, 0xFF4EU, 0xA592U, 0x2997U, 0x734BU, 0x9C2FU, 0xC6F3U,
+    },
+    {
+        0x0000U, 0x1CBBU, 0x3976U, 0x25CDU, 0x72ECU, 0x6E57U, 0x4B9AU, 0x5721U,
+        0xE5D8U, 0xF963U, 0xDCAEU, 0xC015U, 0x9734U, 0x8B8FU, 0xAE42U, 0xB2F9U,
+        0xC3A1U, 0xDF1AU, 0xFAD7U, 0xE66CU, 0xB14DU, 0xADF6U, 0x883BU, 0x9480U,
+        0x2679U, 0x3AC2U, 0x1F0FU, 0x03B4U, 0x5495U, 0x482EU, 0x6DE3U, 0x7158U,
+        0x8F53U, 0x93E8U, 0xB625U, 0xAA9EU, 0xFDBFU, 0xE104U, 0xC4C9U, 0xD872U,
+        0x6A8BU, 0x7630U, 0x53FDU, 0x4F46U, 0x1867U, 0x04DCU, 0x2111U, 0x3DAAU,
+        0x4CF2U, 0x5049U, 0x7584U, 0x693FU, 0x3E1EU, 0x22A5U, 0x0768U, 0x1BD3U,
+        0xA92AU, 0xB591U, 0x905CU, 0x8CE7U, 0xDBC6U, 0xC77DU, 0xE2B0U, 0xFE0BU,
+        0x16B7U, 0x0A0CU, 0x2FC1U, 0x337AU, 0x645BU, 0x78E0U, 0x5D2DU, 0x4196U,
+        0xF36FU, 0xEFD4U, 0xCA19U, 0xD6A2U, 0x8183U, 0x9D38U, 0xB8F5U, 0xA44EU,
+        0xD516U, 0xC9ADU, 0xEC60U, 0xF0DBU, 0xA7FAU, 0xBB41U, 0x9E8CU, 0x8237U,
+        0x30CEU, 0x2C75U, 0x09B8U, 0x1503U, 0x4222U, 0x5E99U, 0x7B54U, 0x67EFU,
+        0x99E4U, 0x855FU, 0xA092U, 0xBC29U, 0xEB08U, 0xF7B3U, 0xD27EU, 0xCEC5U,
+        0x7C3CU, 0x6087U, 0x454AU, 0x59F1U, 0x0ED0U, 0x126BU, 0x37A6U, 0x2B1DU,
+        0x5A45U, 0x46FEU, 0x6333U, 0x7F88U, 0x28A9U, 0x3412U, 0x11DFU, 0x0D64U,
+        0xBF9DU, 0xA326U, 0x86EBU, 0x9A50U, 0xCD71U, 0xD1CAU, 0xF407U, 0xE8BCU,
+        0x2D6EU, 0x31D5U, 0x1418U, 0x08A3U, 0x5F82U, 0x4339U, 0x66F4U, 0x7A4FU,
+        0xC8B6U, 0xD40DU, 0xF1C0U, 0xED7BU, 0xBA5AU, 0xA6E1U, 0x832CU, 0x9F97U,
+        0xEECFU, 0xF274U, 0xD7B9U, 0xCB02U, 0x9C23U, 0x8098U, 0xA555U, 0xB9EEU,
+        0x0B17U, 0x17ACU, 0x3261U, 0x2EDAU, 0x79FBU, 0x6540U, 0x408DU, 0x5C36U,
+        0xA23DU, 0xBE86U, 0x9B4BU, 0x87F0U, 0xD0D1U, 0xCC6AU, 0xE9A7U, 0xF51CU,
+        0x47E5U, 0x5B5EU, 0x7E93U, 0x6228U, 0x3509U, 0x29B2U, 0x0C7FU, 0x10C4U,
+        0x619CU, 0x7D27U, 0x58EAU, 0x4451U, 0x1370U, 0x0FCBU, 0x2A06U, 0x36BDU,
+        0x8444U, 0x98FFU, 0xBD32U, 0xA189U, 0xF6A8U, 0xEA13U, 0xCFDEU, 0xD365U,
+        0x3BD9U, 0x2762U, 0x02AFU, 0x1E14U, 0x4935U, 0x558EU, 0x7043U, 0x6CF8U,
+        0xDE01U, 0xC2BAU, 0xE777U, 0xFBCCU, 0xACEDU, 0xB056U, 0x959BU, 0x8920U,
+        0xF878U, 0xE4C3U, 0xC10EU, 0xDDB5U, 0x8A94U, 0x962FU, 0xB3E2U, 0xAF59U,
+        0x1DA0U, 0x011BU, 0x24D6U, 0x386DU, 0x6F4CU, 0x73F7U, 0x563AU, 0x4A81U,
+        0xB48AU, 0xA831U, 0x8DFCU, 0x9147U, 0xC666U, 0xDADDU, 0xFF10U, 0xE3ABU,
+        0x5152U, 0x4DE9U, 0x6824U, 0x749FU, 0x23BEU, 0x3F05U, 0x1AC8U, 0x0673U,
+        0x772BU, 0x6B90U, 0x4E5DU, 0x52E6U, 0x05C7U, 0x197CU, 0x3CB1U, 0x200AU,
+        0x92F3U, 0x8E48U, 0xAB85U, 0xB73EU, 0xE01FU, 0xFCA4U, 0xD969U, 0xC5D2U,
+    },
+#endif
+#if IFX_CRC_TABLE_SLICES >= 8
+    {
+        0x0000U, 0x0B44U, 0x1688U, 0x1DCCU, 0x2D10U, 0x2654U, 0x3B98U, 0x30DCU,
+        0x5A20U, 0x5164U, 0x4CA8U, 0x47ECU, 0x7730U, 0x7C74U, 0x61B8U, 0x6AFCU,
+        0xB440U, 0xBF04U, 0xA2C8U, 0xA98CU, 0x9950U, 0x9214U, 0x8FD8U, 0x849CU,
+        0xEE60U, 0xE524U, 0xF8E8U, 0xF3ACU, 0xC370U, 0xC834U, 0xD5F8U, 0xDEBCU,
+        0x6091U, 0x6BD5U, 0x7619U, 0x7D5DU, 0x4D81U, 0x46C5U, 0x5B09U, 0x504DU,
+        0x3AB1U, 0x31F5U, 0x2C39U, 0x277DU, 0x17A1U, 0x1CE5U, 0x0129U, 0x0A6DU,
+        0xD4D1U, 0xDF95U, 0xC259U, 0xC91DU, 0xF9C1U, 0xF285U, 0xEF49U, 0xE40DU,
+        0x8EF1U, 0x85B5U, 0x9879U, 0x933DU, 0xA3E1U, 0xA8A5U, 0xB569U, 0xBE2DU,
+        0xC122U, 0xCA66U, 0xD7AAU, 0xDCEEU, 0xEC32U, 0xE776U, 0xFABAU, 0xF1FEU,
+        0x9B02U, 0x9046U, 0x8D8AU, 0x86CEU, 0xB612U, 0xBD56U, 0xA09AU, 0xABDEU,
+        0x7562U, 0x7E26U, 0x63EAU, 0x68AEU, 0x5872U, 0x5336U, 0x4EFAU, 0x45BEU,
+        0x2F42U, 0x2406U, 0x39CAU, 0x328EU, 0x0252U, 0x0916U, 0x14DAU, 0x1F9EU,
+        0xA1B3U, 0xAAF7U, 0xB73BU, 0xBC7FU, 0x8CA3U, 0x87E7U, 0x9A2BU, 0x916FU,
+        0xFB93U, 0xF0D7U, 0xED1BU, 0xE65FU, 0xD683U, 0xDDC7U, 0xC00BU, 0xCB4FU,
+        0x15F3U, 0x1EB7U, 0x037BU, 0x083FU, 0x38E3U, 0x33A7U, 0x2E6BU, 0x252FU,
+        0x4FD3U, 0x4497U, 0x595BU, 0x521FU, 0x62C3U, 0x6987U, 0x744BU, 0x7F0FU,
+        0x8A55U, 0x8111U, 0x9CDDU, 0x9799U, 0xA745U, 0xAC01U, 0xB1CDU, 0xBA89U,
+        0xD075U, 0xDB31U, 0xC6FDU, 0xCDB9U, 0xFD65U, 0xF621U, 0xEBEDU, 0xE0A9U,
+        0x3E15U, 0x3551U, 0x289DU, 0x23D9U, 0x1305U, 0x1841U, 0x058DU, 0x0EC9U,
+        0x6435U, 0x6F71U, 0x72BDU, 0x79F9U, 0x4925U, 0x4261U, 0x5FADU, 0x54E9U,
+        0xEAC4U, 0xE180U, 0xFC4CU, 0xF708U, 0xC7D4U, 0xCC90U, 0xD15CU, 0xDA18U,
+        0xB0E4U, 0xBBA0U, 0xA66CU, 0xAD28U, 0x9DF4U, 0x96B0U, 0x8B7CU, 0x8038U,
+        0x5E84U, 0x55C0U, 0x480CU, 0x4348U, 0x7394U, 0x78D0U, 0x651CU, 0x6E58U,
+        0x04A4U, 0x0FE0U, 0x122CU, 0x1968U, 0x29B4U, 0x22F0U, 0x3F3CU, 0x3478U,
+        0x4B77U, 0x4033U, 0x5DFFU, 0x56BBU, 0x6667U, 0x6D23U, 0x70EFU, 0x7BABU,
+        0x1157U, 0x1A13U, 0x07DFU, 0x0C9BU, 0x3C47U, 0x3703U, 0x2ACFU, 0x218BU,
+        0xFF37U, 0xF473U, 0xE9BFU, 0xE2FBU, 0xD227U, 0xD963U, 0xC4AFU, 0xCFEBU,
+        0xA517U, 0xAE53U, 0xB39FU, 0xB8DBU, 0x8807U, 0x8343U, 0x9E8FU, 0x95CBU,
+        0x2BE6U, 0x20A2U, 0x3D6EU, 0x362AU, 0x06F6U, 0x0DB2U, 0x107EU, 0x1B3AU,
+        0x71C6U, 0x7A82U, 0x674EU, 0x6C0AU, 0x5CD6U, 0x5792U, 0x4A5EU, 0x411AU,
+        0x9FA6U, 0x94E2U, 0x892EU, 0x826AU, 0xB2B6U, 0xB9F2U, 0xA43EU, 0xAF7AU,
+        0xC586U, 0xCEC2U, 0xD30EU, 0xD84AU, 0xE896U, 0xE3D2U, 0xFE1EU, 0xF55AU,
+    },
+    {
+        0x0000U, 0x042BU, 0x0856U, 0x0C7DU, 0x10ACU, 0x1487U, 0x18FAU, 0x1CD1U,
+        0x2158U, 0x2573U, 0x290EU, 0x2D25U, 0x31F4U, 0x35DFU, 0x39A2U, 0x3D89U,
+        0x42B0U, 0x469BU, 0x4AE6U, 0x4ECDU, 0x521CU, 0x5637U, 0x5A4AU, 0x5E61U,
+        0x63E8U, 0x67C3U, 0x6BBEU, 0x6F95U, 0x7344U, 0x776FU, 0x7B12U, 0x7F39U,
+        0x8560U, 0x814BU, 0x8D36U, 0x891DU, 0x95CCU, 0x91E7U, 0x9D9AU, 0x99B1U,
+        0xA438U, 0xA013U, 0xAC6EU, 0xA845U, 0xB494U, 0xB0BFU, 0xBCC2U, 0xB8E9U,
+        0xC7D0U, 0xC3FBU, 0xCF86U, 0xCBADU, 0xD77CU, 0xD357U, 0xDF2AU, 0xDB01U,
+        0xE688U, 0xE2A3U, 0xEEDEU, 0xEAF5U, 0xF624U, 0xF20FU, 0xFE72U, 0xFA59U,
+        0x02D1U, 0x06FAU, 0x0A87U, 0x0EACU, 0x127DU, 0x1656U, 0x1A2BU, 0x1E00U,
+        0x2389U, 0x27A2U, 0x2BDFU, 0x2FF4U, 0x3325U, 0x370EU, 0x3B73U, 0x3F58U,
+        0x4061U, 0x444AU, 0x4837U, 0x4C1CU, 0x50CDU, 0x54E6U, 0x589BU, 0x5CB0U,
+        0x6139U, 0x6512U, 0x696FU, 0x6D44U, 0x7195U, 0x75BEU, 0x79C3U, 0x7DE8U,
+        0x87B1U, 0x839AU, 0x8FE7U, 0x8BCCU, 0x971DU, 0x9336U, 0x9F4BU, 0x9B60U,
+        0xA6E9U, 0xA2C2U, 0xAEBFU, 0xAA94U, 0xB645U, 0xB26EU, 0xBE13U, 0xBA38U,
+        0xC501U, 0xC12AU, 0xCD57U, 0xC97CU, 0xD5ADU, 0xD186U, 0xDDFBU, 0xD9D0U,
+        0xE459U, 0xE072U, 0xEC0FU, 0xE824U, 0xF4F5U, 0xF0DEU, 0xFCA3U, 0xF888U,
+        0x05A2U, 0x0189U, 0x0DF4U, 0x09DFU, 0x150EU, 0x1125U, 0x1D58U, 0x1973U,
+        0x24FAU, 0x20D1U, 0x2CACU, 0x2887U, 0x3456U, 0x307DU, 0x3C00U, 0x382BU,
+        0x4712U, 0x4339U, 0x4F44U, 0x4B6FU, 0x57BEU, 0x5395U, 0x5FE8U, 0x5BC3U,
+        0x664AU, 0x6261U, 0x6E1CU, 0x6A37U, 0x76E6U, 0x72CDU, 0x7EB0U, 0x7A9BU,
+        0x80C2U, 0x84E9U, 0x8894U, 0x8CBFU, 0x906EU, 0x9445U, 0x9838U, 0x9C13U,
+        0xA19AU, 0xA5B1U, 0xA9CCU, 0xADE7U, 0xB136U, 0xB51DU, 0xB960U, 0xBD4BU,
+        0xC272U, 0xC659U, 0xCA24U, 0xCE0FU, 0xD2DEU, 0xD6F5U, 0xDA88U, 0xDEA3U,
+        0xE32AU, 0xE701U, 0xEB7CU, 0xEF57U, 0xF386U, 0xF7ADU, 0xFBD0U, 0xFFFBU,
+        0x0773U, 0x0358U, 0x0F25U, 0x0B0EU, 0x17DFU, 0x13F4U, 0x1F89U, 0x1BA2U,
+        0x262BU, 0x2200U, 0x2E7DU, 0x2A56U, 0x3687U, 0x32ACU, 0x3ED1U, 0x3AFAU,
+        0x45C3U, 0x41E8U, 0x4D95U, 0x49BEU, 0x556FU, 0x5144U, 0x5D39U, 0x5912U,
+        0x649BU, 0x60B0U, 0x6CCDU, 0x68E6U, 0x7437U, 0x701CU, 0x7C61U, 0x784AU,
+        0x8213U, 0x8638U, 0x8A45U, 0x8E6EU, 0x92BFU, 0x9694U, 0x9AE9U, 0x9EC2U,
+        0xA34BU, 0xA760U, 0xAB1DU, 0xAF36U, 0xB3E7U, 0xB7CCU, 0xBBB1U, 0xBF9AU,
+        0xC0A3U, 0xC488U, 0xC8F5U, 0xCCDEU, 0xD00FU, 0xD424U, 0xD859U, 0xDC72U,
+        0xE1FBU, 0xE5D0U, 0xE9ADU, 0xED86U, 0xF157U, 0xF57CU, 0xF901U, 0xFD2AU,
+    },
+    {
+        0x0000U, 0x9FD5U, 0x37BBU, 0xA86EU, 0x6F76U, 0xF0A3U, 0x58CDU, 0xC718U,
+        0xDEECU, 0x4139U, 0xE957U, 0x7682U, 0xB19AU, 0x2E4FU, 0x8621U, 0x19F4U,
+        0xB5C9U, 0x2A1CU, 0x8272U, 0x1DA7U, 0xDABFU, 0x456AU, 0xED04U, 0x72D1U,
+        0x6B25U, 0xF4F0U, 0x5C9EU, 0xC34BU, 0x0453U, 0x9B86U, 0x33E8U, 0xAC3DU,
+        0x6383U, 0xFC56U, 0x5438U, 0xCBEDU, 0x0CF5U, 0x9320U, 0x3B4EU, 0xA49BU,
+        0xBD6FU, 0x22BAU, 0x8AD4U, 0x1501U, 0xD219U, 0x4DCCU, 0xE5A2U, 0x7A77U,
+        0xD64AU, 0x499FU, 0xE1F1U, 0x7E24U, 0xB93CU, 0x26E9U, 0x8E87U, 0x1152U,
+        0x08A6U, 0x9773U, 0x3F1DU, 0xA0C8U, 0x67D0U, 0xF805U, 0x506BU, 0xCFBEU,
+        0xC706U, 0x58D3U, 0xF0BDU, 0x6F68U, 0xA870U, 0x37A5U, 0x9FCBU, 0x001EU,
+        0x19EAU, 0x863FU, 0x2E51U, 0xB184U, 0x769CU, 0xE949U, 0x4127U, 0xDEF2U,
+        0x72CFU, 0xED1AU, 0x4574U, 0xDAA1U, 0x1DB9U, 0x826CU, 0x2A02U, 0xB5D7U,
+        0xAC23U, 0x33F6U, 0x9B98U, 0x044DU, 0xC355U, 0x5C80U, 0xF4EEU, 0x6B3BU,
+        0xA485U, 0x3B50U, 0x933EU, 0x0CEBU, 0xCBF3U, 0x5426U, 0xFC48U, 0x639DU,
+        0x7A69U, 0xE5BCU, 0x4DD2U, 0xD207U, 0x151FU, 0x8ACAU, 0x22A4U, 0xBD71U,
+        0x114CU, 0x8E99U, 0x26F7U, 0xB922U, 0x7E3AU, 0xE1EFU, 0x4981U, 0xD654U,
+        0xCFA0U, 0x5075U, 0xF81BU, 0x67CEU, 0xA0D6U, 0x3F03U, 0x976DU, 0x08B8U,
+        0x861DU, 0x19C8U, 0xB1A6U, 0x2E73U, 0xE96BU, 0x76BEU, 0xDED0U, 0x4105U,
+        0x58F1U, 0xC724U, 0x6F4AU, 0xF09FU, 0x3787U, 0xA852U, 0x003CU, 0x9FE9U,
+        0x33D4U, 0xAC01U, 0x046FU, 0x9BBAU, 0x5CA2U, 0xC377U, 0x6B19U, 0xF4CCU,
+        0xED38U, 0x72EDU, 0xDA83U, 0x4556U, 0x824EU, 0x1D9BU, 0xB5F5U, 0x2A20U,
+        0xE59EU, 0x7A4BU, 0xD225U, 0x4DF0U, 0x8AE8U, 0x153DU, 0xBD53U, 0x2286U,
+        0x3B72U, 0xA4A7U, 0x0CC9U, 0x931CU, 0x5404U, 0xCBD1U, 0x63BFU, 0xFC6AU,
+        0x5057U, 0xCF82U, 0x67ECU, 0xF839U, 0x3F21U, 0xA0F4U, 0x089AU, 0x974FU,
+        0x8EBBU, 0x116EU, 0xB900U, 0x26D5U, 0xE1CDU, 0x7E18U, 0xD676U, 0x49A3U,
+        0x411BU, 0xDECEU, 0x76A0U, 0xE975U, 0x2E6DU, 0xB1B8U, 0x19D6U, 0x8603U,
+        0x9FF7U, 0x0022U, 0xA84CU, 0x3799U, 0xF081U, 0x6F54U, 0xC73AU, 0x58EFU,
+        0xF4D2U, 0x6B07U, 0xC369U, 0x5CBCU, 0x9BA4U, 0x0471U, 0xAC1FU, 0x33CAU,
+        0x2A3EU, 0xB5EBU, 0x1D85U, 0x8250U, 0x4548U, 0xDA9DU, 0x72F3U, 0xED26U,
+        0x2298U, 0xBD4DU, 0x1523U, 0x8AF6U, 0x4DEEU, 0xD23BU, 0x7A55U, 0xE580U,
+        0xFC74U, 0x63A1U, 0xCBCFU, 0x541AU, 0x9302U, 0x0CD7U, 0xA4B9U, 0x3B6CU,
+        0x9751U, 0x0884U, 0xA0EAU, 0x3F3FU, 0xF827U, 0x67F2U, 0xCF9CU, 0x5049U,
+        0x49BDU, 0xD668U, 0x7E06U, 0xE1D3U, 0x26CBU, 0xB91EU, 0x1170U, 0x8EA5U,
+    },
+    {
+        0x0000U, 0x81BFU, 0x0B6FU, 0x8AD0U, 0x16DEU, 0x9761U, 0x1DB1U, 0x9C0EU,
+        0x2DBCU, 0xAC03U, 0x26D3U, 0xA76CU, 0x3B62U, 0xBADDU, 0x300DU, 0xB1B2U,
+        0x5B78U, 0xDAC7U, 0x5017U, 0xD1A8U, 0x4DA6U, 0xCC19U, 0x46C9U, 0xC776U,
+        0x76C4U, 0xF77BU, 0x7DABU, 0xFC14U, 0x601AU, 0xE1A5U, 0x6B75U, 0xEACAU,
+        0xB6F0U, 0x374FU, 0xBD9FU, 0x3C20U, 0xA02EU, 0x2191U, 0xAB41U, 0x2AFEU,
+        0x9B4CU, 0x1AF3U, 0x9023U, 0x119CU, 0x8D92U, 0x0C2DU, 0x86FDU, 0x0742U,
+        0xED88U, 0x6C37U, 0xE6E7U, 0x6758U, 0xFB56U, 0x7AE9U, 0xF039U, 0x7186U,
+        0xC034U, 0x418BU, 0xCB5BU, 0x4AE4U, 0xD6EAU, 0x5755U, 0xDD85U, 0x5C3AU,
+        0x65F1U, 0xE44EU, 0x6E9EU, 0xEF21U, 0x732FU, 0xF290U, 0x7840U, 0xF9FFU,
+        0x484DU, 0xC9F2U, 0x4322U, 0xC29DU, 0x5E93U, 0xDF2CU, 0x55FCU, 0xD443U,
+        0x3E89U, 0xBF36U, 0x35E6U, 0xB459U, 0x2857U, 0xA9E8U, 0x2338U, 0xA287U,
+        0x1335U, 0x928AU, 0x185AU, 0x99E5U, 0x05EBU, 0x8454U, 0x0E84U, 0x8F3BU,
+        0xD301U, 0x52BEU, 0xD86EU, 0x59D1U, 0xC5DFU, 0x4460U, 0xCEB0U, 0x4F0FU,
+        0xFEBDU, 0x7F02U, 0xF5D2U, 0x746DU, 0xE863U, 0x69DCU, 0xE30CU, 0x62B3U,
+        0x8879U, 0x09C6U, 0x8316U, 0x02A9U, 0x9EA7U, 0x1F18U, 0x95C8U, 0x1477U,
+        0xA5C5U, 0x247AU, 0xAEAAU, 0x2F15U, 0xB31BU, 0x32A4U, 0xB874U, 0x39CBU,
+        0xCBE2U, 0x4A5DU, 0xC08DU, 0x4132U, 0xDD3CU, 0x5C83U, 0xD653U, 0x57ECU,
+        0xE65EU, 0x67E1U, 0xED31U, 0x6C8EU, 0xF080U, 0x713FU, 0xFBEFU, 0x7A50U,
+        0x909AU, 0x1125U, 0x9BF5U, 0x1A4AU, 0x8644U, 0x07FBU, 0x8D2BU, 0x0C94U,
+        0xBD26U, 0x3C99U, 0xB649U, 0x37F6U, 0xABF8U, 0x2A47U, 0xA097U, 0x2128U,
+        0x7D12U, 0xFCADU, 0x767DU, 0xF7C2U, 0x6BCCU, 0xEA73U, 0x60A3U, 0xE11CU,
+        0x50AEU, 0xD111U, 0x5BC1U, 0xDA7EU, 0x4670U, 0xC7CFU, 0x4D1FU, 0xCCA0U,
+        0x266AU, 0xA7D5U, 0x2D05U, 0xACBAU, 0x30B4U, 0xB10BU, 0x3BDBU, 0xBA64U,
+        0x0BD6U, 0x8A69U, 0x00B9U, 0x8106U, 0x1D08U, 0x9CB7U, 0x1667U, 0x97D8U,
+        0xAE13U, 0x2FACU, 0xA57CU, 0x24C3U, 0xB8CDU, 0x3972U, 0xB3A2U, 0x321DU,
+        0x83AFU, 0x0210U, 0x88C0U, 0x097FU, 0x9571U, 0x14CEU, 0x9E1EU, 0x1FA1U,
+        0xF56BU, 0x74D4U, 0xFE04U, 0x7FBBU, 0xE3B5U, 0x620AU, 0xE8DAU, 0x6965U,
+        0xD8D7U, 0x5968U, 0xD3B8U, 0x5207U, 0xCE09U, 0x4FB6U, 0xC566U, 0x44D9U,
+        0x18E3U, 0x995CU, 0x138CU, 0x9233U, 0x0E3DU, 0x8F82U, 0x0552U, 0x84EDU,
+        0x355FU, 0xB4E0U, 0x3E30U, 0xBF8FU, 0x2381U, 0xA23EU, 0x28EEU, 0xA951U,
+        0x439BU, 0xC224U, 0x48F4U, 0xC94BU, 0x5545U, 0xD4FAU, 0x5E2AU, 0xDF95U,
+        0x6E27U, 0xEF98U, 0x6548U, 0xE4F7U, 0x78F9U, 0xF946U, 0x7396U, 0xF229U,
+    },
+#endif
+};
+
+/**
+ * \brief Lookup tables for reflected 16 bit CRC with polynomial 0x0408
+ * (G+D T=1).
+ *
+ * \details Slice \c k holds the CRC contribution of a byte followed by \c k
+ * zero bytes.
+ */
+static const uint16_t IFX_CRC16_TABLE_0408[IFX_CRC_TABLE_SLICES][256] = {
+    {
+        0x0000U, 0x0089U, 0x0112U, 0x019BU, 0x0224U, 0x02ADU, 0x0336U, 0x03BFU,
+        0x0448U, 0x04C1U, 0x055AU, 0x05D3U, 0x066CU, 0x06E5U, 0x077EU, 0x07F7U,
+        0x0081U, 0x0008U, 0x0193U, 0x011AU, 0x02A5U, 0x022CU, 0x03B7U, 0x033EU,
+        0x04C9U, 0x0440U, 0x05DBU, 0x0552U, 0x06EDU, 0x0664U, 0x07FFU, 0x0776U,
+        0x0102U, 0x018BU, 0x0010U, 0x0099U, 0x0326U, 0x03AFU, 0x0234U, 0x02BDU,
+        0x054AU, 0x05C3U, 0x0458U, 0x04D1U, 0x076EU, 0x07E7U, 0x067CU, 0x06F5U,
+        0x0183U, 0x010AU, 0x0091U, 0x0018U, 0x03A7U, 0x032EU, 0x02B5U, 0x023CU,
+        0x05CBU, 0x0542U, 0x04D9U, 0x0450U, 0x07EFU, 0x0766U, 0x06FDU, 0x0674U,
+        0x0204U, 0x028DU, 0x0316U, 0x039FU, 0x0020U, 0x00A9U, 0x0132U, 0x01BBU,
+        0x064CU, 0x06C5U, 0x075EU, 0x07D7U, 0x0468U, 0x04E1U, 0x057AU, 0x05F3U,
+        0x0285U, 0x020CU, 0x0397U, 0x031EU, 0x00A1U, 0x0028U, 0x01B3U, 0x013AU,
+        0x06CDU, 0x0644U, 0x07DFU, 0x0756U, 0x04E9U, 0x0460U, 0x05FBU, 0x0572U,
+        0x0306U, 0x038FU, 0x0214U, 0x029DU, 0x0122U, 0x01ABU, 0x0030U, 0x00B9U,
+        0x074EU, 0x07C7U, 0x065CU, 0x06D5U, 0x056AU, 0x05E3U, 0x0478U, 0x04F1U,
+        0x0387U, 0x030EU, 0x0295U, 0x021CU, 0x01A3U, 0x012AU, 0x00B1U, 0x0038U,
+        0x07CFU, 0x0746U, 0x06DDU, 0x0654U, 0x05EBU, 0x0562U, 0x04F9U, 0x0470U,
+        0x0408U, 0x0481U, 0x051AU, 0x0593U, 0x062CU, 0x06A5U, 0x073EU, 0x07B7U,
+        0x0040U, 0x00C9U, 0x0152U, 0x01DBU, 0x0264U, 0x02EDU, 0x0376U, 0x03FFU,
+        0x0489U, 0x0400U, 0x059BU, 0x0512U, 0x06ADU, 0x0624U, 0x07BFU, 0x0736U,
+        0x00C1U, 0x0048U, 0x01D3U, 0x015AU, 0x02E5U, 0x026CU, 0x03F7U, 0x037EU,
+        0x050AU, 0x0583U, 0x0418U, 0x0491U, 0x072EU, 0x07A7U, 0x063CU, 0x06B5U,
+        0x0142U, 0x01CBU, 0x0050U, 0x00D9U, 0x0366U, 0x03EFU, 0x0274U, 0x02FDU,
+        0x058BU, 0x0502U, 0x0499U, 0x0410U, 0x07AFU, 0x0726U, 0x06BDU, 0x0634U,
+        0x01C3U, 0x014AU, 0x00D1U, 0x0058U, 0x03E7U, 0x036EU, 0x02F5U, 0x027CU,
+        0x060CU, 0x0685U, 0x071EU, 0x0797U, 0x0428U, 0x04A1U, 0x053AU, 0x05B3U,
+        0x0244U, 0x02CDU, 0x0356U, 0x03DFU, 0x0060U, 0x00E9U, 0x0172U, 0x01FBU,
+        0x068DU, 0x0604U, 0x079FU, 0x0716U, 0x04A9U, 0x0420U, 0x05BBU, 0x0532U,
+        0x02C5U, 0x024CU, 0x03D7U, 0x035EU, 0x00E1U, 0x0068U, 0x01F3U, 0x017AU,
+        0x070EU, 0x0787U, 0x061CU, 0x0695U, 0x052AU, 0x05A3U, 0x0438U, 0x04B1U,
+        0x0346U, 0x03CFU, 0x0254U, 0x02DDU, 0x0162U, 0x01EBU, 0x0070U, 0x00F9U,
+        0x078FU, 0x0706U, 0x069DU, 0x0614U, 0x05ABU, 0x0522U, 0x04B9U, 0x0430U,
+        0x03C7U, 0x034EU, 0x02D5U, 0x025CU, 0x01E3U, 0x016AU, 0x00F1U, 0x0078U,
+    },
+#if IFX_CRC_TABLE_SLICES >= 4
+    {
+        0x0000U, 0x00C9U, 0x0192U, 0x015BU, 0x0324U, 0x03EDU, 0x02B6U, 0x027FU,
+        0x0648U, 0x0681U, 0x07DAU, 0x0713U, 0x056CU, 0x05A5U, 0x04FEU, 0x0437U,
+        0x0481U, 0x0448U, 0x0513U, 0x05DAU, 0x07A5U, 0x076CU, 0x0637U, 0x06FEU,
+        0x02C9U, 0x0200U, 0x035BU, 0x0392U, 0x01EDU, 0x0124U, 0x007FU, 0x00B6U,
+        0x0113U, 0x01DAU, 0x0081U, 0x0048U, 0x0237U, 0x02FEU, 0x03A5U, 0x036CU,
+        0x075BU, 0x0792U, 0x06C9U, 0x0600U, 0x047FU, 0x04B6U, 0x05EDU, 0x0524U,
+        0x0592U, 0x055BU, 0x0400U, 0x04C9U, 0x06B6U, 0x067FU, 0x0724U, 0x07EDU,
+        0x03DAU, 0x0313U, 0x0248U, 0x0281U, 0x00FEU, 0x0037U, 0x016CU, 0x01A5U,
+        0x0226U, 0x02EFU, 0x03B4U, 0x037DU, 0x0102U, 0x01CBU, 0x0090U, 0x0059U,
+        0x046EU, 0x04A7U, 0x05FCU, 0x0535U, 0x074AU, 0x0783U, 0x06D8U, 0x0611U,
+        0x06A7U, 0x066EU, 0x0735U, 0x07FCU, 0x0583U, 0x054AU, 0x0411U, 0x04D8U,
+        0x00EFU, 0x0026U, 0x017DU, 0x01B4U, 0x03CBU, 0x0302U, 0x0259U, 0x0290U,
+        0x0335U, 0x03FCU, 0x02A7U, 0x026EU, 0x0011U, 0x00D8U, 0x0183U, 0x014AU,
+        0x057DU, 0x05B4U, 0x04EFU, 0x0426U, 0x0659U, 0x0690U, 0x07CBU, 0x0702U,
+        0x07B4U, 0x077DU, 0x0626U, 0x06EFU, 0x0490U, 0x0459U, 0x0502U, 0x05CBU,
+        0x01FCU, 0x0135U, 0x006EU, 0x00A7U, 0x02D8U, 0x0211U, 0x034AU, 0x0383U,
+        0x044CU, 0x0485U, 0x05DEU, 0x0517U, 0x0768U, 0x07A1U, 0x06FAU, 0x0633U,
+        0x0204U, 0x02CDU, 0x0396U, 0x035FU, 0x0120U, 0x01E9U, 0x00B2U, 0x007BU,
+        0x00CDU, 0x0004U, 0x015FU, 0x0196U, 0x03E9U, 0x0320U, 0x027BU, 0x02B2U,
+        0x0685U, 0x064CU, 0x0717U, 0x07DEU, 0x05A1U, 0x0568U, 0x0433U, 0x04FAU,
+        0x055FU, 0x0596U, 0x04CDU, 0x0404U, 0x067BU, 0x06B2U, 0x07E9U, 0x0720U,
+        0x0317U, 0x03DEU, 0x0285U, 0x024CU, 0x0033U, 0x00FAU, 0x01A1U, 0x0168U,
+        0x01DEU, 0x0117U, 0x004CU, 0x0085U, 0x02FAU, 0x0233U, 0x0368U, 0x03A1U,
+        0x0796U, 0x075FU, 0x0604U, 0x06CDU, 0x04B2U, 0x047BU, 0x0520U, 0x05E9U,
+        0x066AU, 0x06A3U, 0x07F8U, 0x0731U, 0x054EU, 0x0587U, 0x04DCU, 0x0415U,
+        0x0022U, 0x00EBU, 0x01B0U, 0x0179U, 0x0306U, 0x03CFU, 0x0294U, 0x025DU,
+        0x02EBU, 0x0222U, 0x0379U, 0x03B0U, 0x01CFU, 0x0106U, 0x005DU, 0x0094U,
+        0x04A3U, 0x046AU, 0x0531U, 0x05F8U, 0x0787U, 0x074EU, 0x0615U, 0x06DCU,
+        0x0779U, 0x07B0U, 0x06EBU, 0x0622U, 0x045DU, 0x0494U, 0x05CFU, 0x0506U,
+        0x0131U, 0x01F8U, 0x00A3U, 0x006AU, 0x0215U, 0x02DCU, 0x0387U, 0x034EU,
+        0x03F8U, 0x0331U, 0x026AU, 0x02A3U, 0x00DCU, 0x0015U, 0x014EU, 0x0187U,
+        0x05B0U, 0x0579U, 0x0422U, 0x04EBU, 0x0694U, 0x065DU, 0x0706U, 0x07CFU,
+    },
+    {
+        0x0000U, 0x02CDU, 0x059AU, 0x0757U, 0x0325U, 0x01E8U, 0x06BFU, 0x0472U,
+        0x064AU, 0x0487U, 0x03D0U, 0x011DU, 0x056FU, 0x07A2U, 0x00F5U, 0x0238U,
+        0x0485U, 0x0648U, 0x011FU, 0x03D2U, 0x07A0U, 0x056DU, 0x023AU, 0x00F7U,
+        0x02CFU, 0x0002U, 0x0755U, 0x0598U, 0x01EAU, 0x0327U, 0x0470U, 0x06BDU,
+        0x011BU, 0x03D6U, 0x0481U, 0x064CU, 0x023EU, 0x00F3U, 0x07A4U, 0x0569U,
+        0x0751U, 0x059CU, 0x02CBU, 0x0006U, 0x0474U, 0x06B9U, 0x01EEU, 0x0323U,
+        0x059EU, 0x0753U, 0x0004U, 0x02C9U, 0x06BBU, 0x0476U, 0x0321U, 0x01ECU,
+        0x03D4U, 0x0119U, 0x064EU, 0x0483U, 0x00F1U, 0x023CU, 0x056BU, 0x07A6U,
+        0x0236U, 0x00FBU, 0x07ACU, 0x0561U, 0x0113U, 0x03DEU, 0x0489U, 0x0644U,
+        0x047CU, 0x06B1U, 0x01E6U, 0x032BU, 0x0759U, 0x0594U, 0x02C3U, 0x000EU,
+        0x06B3U, 0x047EU, 0x0329U, 0x01E4U, 0x0596U, 0x075BU, 0x000CU, 0x02C1U,
+        0x00F9U, 0x0234U, 0x0563U, 0x07AEU, 0x03DCU, 0x0111U, 0x0646U, 0x048BU,
+        0x032DU, 0x01E0U, 0x06B7U, 0x047AU, 0x0008U, 0x02C5U, 0x0592U, 0x075FU,
+        0x0567U, 0x07AAU, 0x00FDU, 0x0230U, 0x0642U, 0x048FU, 0x03D8U, 0x0115U,
+        0x07A8U, 0x0565U, 0x0232U, 0x00FFU, 0x048DU, 0x0640U, 0x0117U, 0x03DAU,
+        0x01E2U, 0x032FU, 0x0478U, 0x06B5U, 0x02C7U, 0x000AU, 0x075DU, 0x0590U,
+        0x046CU, 0x06A1U, 0x01F6U, 0x033BU, 0x0749U, 0x0584U, 0x02D3U, 0x001EU,
+        0x0226U, 0x00EBU, 0x07BCU, 0x0571U, 0x0103U, 0x03CEU, 0x0499U, 0x0654U,
+        0x00E9U, 0x0224U, 0x0573U, 0x07BEU, 0x03CCU, 0x0101U, 0x0656U, 0x049BU,
+        0x06A3U, 0x046EU, 0x0339U, 0x01F4U, 0x0586U, 0x074BU, 0x001CU, 0x02D1U,
+        0x0577U, 0x07BAU, 0x00EDU, 0x0220U, 0x0652U, 0x049FU, 0x03C8U, 0x0105U,
+        0x033DU, 0x01F0U, 0x06A7U, 0x046AU, 0x0018U, 0x02D5U, 0x0582U, 0x074FU,
+        0x01F2U, 0x033FU, 0x0468U, 0x06A5U, 0x02D7U, 0x001AU, 0x074DU, 0x0580U,
+        0x07B8U, 0x0575U, 0x0222U, 0x00EFU, 0x049DU, 0x0650U, 0x0107U, 0x03CAU,
+        0x065AU, 0x0497U, 0x03C0U, 0x010DU, 0x057FU, 0x07B2U, 0x00E5U, 0x0228U,
+        0x0010U, 0x02DDU, 0x058AU, 0x0747U, 0x0335U, 0x01F8U, 0x06AFU, 0x0462U,
+        0x02DFU, 0x0012U, 0x0745U, 0x0588U, 0x01FAU, 0x0337U, 0x0460U, 0x06ADU,
+        0x0495U, 0x0658U, 0x010FU, 0x03C2U, 0x07B0U, 0x057DU, 0x022AU, 0x00E7U,
+        0x0741U, 0x058CU, 0x02DBU, 0x0016U, 0x0464U, 0x06A9U, 0x01FEU, 0x0333U,
+        0x010BU, 0x03C6U, 0x0491U, 0x065CU, 0x022EU, 0x00E3U, 0x07B4U, 0x0579U,
+        0x03C4U, 0x0109U, 0x065EU, 0x0493U, 0x00E1U, 0x022CU, 0x057BU, 0x07B6U,
+        0x058EU, 0x0743U, 0x0014U, 0x02D9U, 0x06ABU, 0x0466U, 0x0331U, 0x01FCU,
+    },
+    {
+        0x0000U, 0x00EBU, 0x01D6U, 0x013DU, 0x03ACU, 0x0347U, 0x027AU, 0x0291U,
+        0x0758U, 0x07B3U, 0x068EU, 0x0665U, 0x04F4U, 0x041FU, 0x0522U, 0x05C9U,
+        0x06A1U, 0x064AU, 0x0777U, 0x079CU, 0x050DU, 0x05E6U, 0x04DBU, 0x0430U,
+        0x01F9U, 0x0112U, 0x002FU, 0x00C4U, 0x0255U, 0x02BEU, 0x0383U, 0x0368U,
+        0x0553U, 0x05B8U, 0x0485U, 0x046EU, 0x06FFU, 0x0614U, 0x0729U, 0x07C2U,
+        0x020BU, 0x02E0U, 0x03DDU, 0x0336U, 0x01A7U, 0x014CU, 0x0071U, 0x009AU,
+        0x03F2U, 0x0319U, 0x0224U, 0x02CFU, 0x005EU, 0x00B5U, 0x0188U, 0x0163U,
+        0x04AAU, 0x0441U, 0x057CU, 0x0597U, 0x0706U, 0x07EDU, 0x06D0U, 0x063BU,
+        0x02B7U, 0x025CU, 0x0361U, 0x038AU, 0x011BU, 0x01F0U, 0x00CDU, 0x0026U,
+        0x05EFU, 0x0504U, 0x0439U, 0x04D2U, 0x0643U, 0x06A8U, 0x0795U, 0x077EU,
+        0x0416U, 0x04FDU, 0x05C0U, 0x052BU, 0x07BAU, 0x0751U, 0x066CU, 0x0687U,
+        0x034EU, 0x03A5U, 0x0298U, 0x0273U, 0x00E2U, 0x0009U, 0x0134U, 0x01DFU,
+        0x07E4U, 0x070FU, 0x0632U, 0x06D9U, 0x0448U, 0x04A3U, 0x059EU, 0x0575U,
+        0x00BCU, 0x0057U, 0x016AU, 0x0181U, 0x0310U, 0x03FBU, 0x02C6U, 0x022DU,
+        0x0145U, 0x01AEU, 0x0093U, 0x0078U, 0x02E9U, 0x0202U, 0x033FU, 0x03D4U,
+        0x061DU, 0x06F6U, 0x07CBU, 0x0720U, 0x05B1U, 0x055AU, 0x0467U, 0x048CU,
+        0x056EU, 0x0585U, 0x04B8U, 0x0453U, 0x06C2U, 0x0629U, 0x0714U, 0x07FFU,
+        0x0236U, 0x02DDU, 0x03E0U, 0x030BU, 0x019AU, 0x0171U, 0x004CU, 0x00A7U,
+        0x03CFU, 0x0324U, 0x0219U, 0x02F2U, 0x0063U, 0x0088U, 0x01B5U, 0x015EU,
+        0x0497U, 0x047CU, 0x0541U, 0x05AAU, 0x073BU, 0x07D0U, 0x06EDU, 0x0606U,
+        0x003DU, 0x00D6U, 0x01EBU, 0x0100U, 0x0391U, 0x037AU, 0x0247U, 0x02ACU,
+        0x0765U, 0x078EU, 0x06B3U, 0x0658U, 0x04C9U, 0x0422U, 0x051FU, 0x05F4U,
+        0x069CU, 0x0677U, 0x074AU, 0x07A1U, 0x0530U, 0x05DBU, 0x04E6U, 0x040DU,
+        0x01C4U, 0x012FU, 0x0012U, 0x00F9U, 0x0268U, 0x0283U, 0x03BEU, 0x0355U,
+        0x07D9U, 0x0732U, 0x060FU, 0x06E4U, 0x0475U, 0x049EU, 0x05A3U, 0x0548U,
+        0x0081U, 0x006AU, 0x0157U, 0x01BCU, 0x032DU, 0x03C6U, 0x02FBU, 0x0210U,
+        0x0178U, 0x0193U, 0x00AEU, 0x0045U, 0x02D4U, 0x023FU, 0x0302U, 0x03E9U,
+        0x0620U, 0x06CBU, 0x07F6U, 0x071DU, 0x058CU, 0x0567U, 0x045AU, 0x04B1U,
+        0x028AU, 0x0261U, 0x035CU, 0x03B7U, 0x0126U, 0x01CDU, 0x00F0U, 0x001BU,
+        0x05D2U, 0x0539U, 0x0404U, 0x04EFU, 0x067EU, 0x0695U, 0x07A8U, 0x0743U,
+        0x042BU, 0x04C0U, 0x05FDU, 0x0516U, 0x0787U, 0x076CU, 0x0651U, 0x06BAU,
+        0x0373U, 0x0398U, 0x02A5U, 0x024EU, 0x00DFU, 0x0034U, 0x0109U, 0x01E2U,
+    },
+#endif
+#if IFX_CRC_TABLE_SLICES >= 8
+    {
+        0x0000U, 0x02DDU, 0x05BAU, 0x0767U, 0x0365U, 0x01B8U, 0x06DFU, 0x0402U,
+        0x06CAU, 0x0417U, 0x0370U, 0x01ADU, 0x05AFU, 0x0772U, 0x0015U, 0x02C8U,
+        0x0585U, 0x0758U, 0x003FU, 0x02E2U, 0x06E0U, 0x043DU, 0x035AU, 0x0187U,
+        0x034FU, 0x0192U, 0x06F5U, 0x0428U, 0x002AU, 0x02F7U, 0x0590U, 0x074DU,
+        0x031BU, 0x01C6U, 0x06A1U, 0x047CU, 0x007EU, 0x02A3U, 0x05C4U, 0x0719U,
+        0x05D1U, 0x070CU, 0x006BU, 0x02B6U, 0x06B4U, 0x0469U, 0x030EU, 0x01D3U,
+        0x069EU, 0x0443U, 0x0324U, 0x01F9U, 0x05FBU, 0x0726U, 0x0041U, 0x029CU,
+        0x0054U, 0x0289U, 0x05EEU, 0x0733U, 0x0331U, 0x01ECU, 0x068BU, 0x0456U,
+        0x0636U, 0x04EBU, 0x038CU, 0x0151U, 0x0553U, 0x078EU, 0x00E9U, 0x0234U,
+        0x00FCU, 0x0221U, 0x0546U, 0x079BU, 0x0399U, 0x0144U, 0x0623U, 0x04FEU,
+        0x03B3U, 0x016EU, 0x0609U, 0x04D4U, 0x00D6U, 0x020BU, 0x056CU, 0x07B1U,
+        0x0579U, 0x07A4U, 0x00C3U, 0x021EU, 0x061CU, 0x04C1U, 0x03A6U, 0x017BU,
+        0x052DU, 0x07F0U, 0x0097U, 0x024AU, 0x0648U, 0x0495U, 0x03F2U, 0x012FU,
+        0x03E7U, 0x013AU, 0x065DU, 0x0480U, 0x0082U, 0x025FU, 0x0538U, 0x07E5U,
+        0x00A8U, 0x0275U, 0x0512U, 0x07CFU, 0x03CDU, 0x0110U, 0x0677U, 0x04AAU,
+        0x0662U, 0x04BFU, 0x03D8U, 0x0105U, 0x0507U, 0x07DAU, 0x00BDU, 0x0260U,
+        0x047DU, 0x06A0U, 0x01C7U, 0x031AU, 0x0718U, 0x05C5U, 0x02A2U, 0x007FU,
+        0x02B7U, 0x006AU, 0x070DU, 0x05D0U, 0x01D2U, 0x030FU, 0x0468U, 0x06B5U,
+        0x01F8U, 0x0325U, 0x0442U, 0x069FU, 0x029DU, 0x0040U, 0x0727U, 0x05FAU,
+        0x0732U, 0x05EFU, 0x0288U, 0x0055U, 0x0457U, 0x068AU, 0x01EDU, 0x0330U,
+        0x0766U, 0x05BBU, 0x02DCU, 0x0001U, 0x0403U, 0x06DEU, 0x01B9U, 0x0364U,
+        0x01ACU, 0x0371U, 0x0416U, 0x06CBU, 0x02C9U, 0x0014U, 0x0773U, 0x05AEU,
+        0x02E3U, 0x003EU, 0x0759U, 0x0584U, 0x0186U, 0x035BU, 0x043CU, 0x06E1U,
+        0x0429U, 0x06F4U, 0x0193U, 0x034EU, 0x074CU, 0x0591U, 0x02F6U, 0x002BU,
+        0x024BU, 0x0096U, 0x07F1U, 0x052CU, 0x012EU, 0x03F3U, 0x0494U, 0x0649U,
+        0x0481U, 0x065CU, 0x013BU, 0x03E6U, 0x07E4U, 0x0539U, 0x025EU, 0x0083U,
+        0x07CEU, 0x0513U, 0x0274U, 0x00A9U, 0x04ABU, 0x0676U, 0x0111U, 0x03CCU,
+        0x0104U, 0x03D9U, 0x04BEU, 0x0663U, 0x0261U, 0x00BCU, 0x07DBU, 0x0506U,
+        0x0150U, 0x038DU, 0x04EAU, 0x0637U, 0x0235U, 0x00E8U, 0x078FU, 0x0552U,
+        0x079AU, 0x0547U, 0x0220U, 0x00FDU, 0x04FFU, 0x0622U, 0x0145U, 0x0398U,
+        0x04D5U, 0x0608U, 0x016FU, 0x03B2U, 0x07B0U, 0x056DU, 0x020AU, 0x00D7U,
+        0x021FU, 0x00C2U, 0x07A5U, 0x0578U, 0x017AU, 0x03A7U, 0x04C0U, 0x061DU,
+    },
+    {
+        0x0000U, 0x006AU, 0x00D4U, 0x00BEU, 0x01A8U, 0x01C2U, 0x017CU, 0x0116U,
+        0x0350U, 0x033AU, 0x0384U, 0x03EEU, 0x02F8U, 0x0292U, 0x022CU, 0x0246U,
+        0x06A0U, 0x06CAU, 0x0674U, 0x061EU, 0x0708U, 0x0762U, 0x07DCU, 0x07B6U,
+        0x05F0U, 0x059AU, 0x0524U, 0x054EU, 0x0458U, 0x0432U, 0x048CU, 0x04E6U,
+        0x0551U, 0x053BU, 0x0585U, 0x05EFU, 0x04F9U, 0x0493U, 0x042DU, 0x0447U,
+        0x0601U, 0x066BU, 0x06D5U, 0x06BFU, 0x07A9U, 0x07C3U, 0x077DU, 0x0717U,
+        0x03F1U, 0x039BU, 0x0325U, 0x034FU, 0x0259U, 0x0233U, 0x028DU, 0x02E7U,
+        0x00A1U, 0x00CBU, 0x0075U, 0x001FU, 0x0109U, 0x0163U, 0x01DDU, 0x01B7U,
+        0x02B3U, 0x02D9U, 0x0267U, 0x020DU, 0x031BU, 0x0371U, 0x03CFU, 0x03A5U,
+        0x01E3U, 0x0189U, 0x0137U, 0x015DU, 0x004BU, 0x0021U, 0x009FU, 0x00F5U,
+        0x0413U, 0x0479U, 0x04C7U, 0x04ADU, 0x05BBU, 0x05D1U, 0x056FU, 0x0505U,
+        0x0743U, 0x0729U, 0x0797U, 0x07FDU, 0x06EBU, 0x0681U, 0x063FU, 0x0655U,
+        0x07E2U, 0x0788U, 0x0736U, 0x075CU, 0x064AU, 0x0620U, 0x069EU, 0x06F4U,
+        0x04B2U, 0x04D8U, 0x0466U, 0x040CU, 0x051AU, 0x0570U, 0x05CEU, 0x05A4U,
+        0x0142U, 0x0128U, 0x0196U, 0x01FCU, 0x00EAU, 0x0080U, 0x003EU, 0x0054U,
+        0x0212U, 0x0278U, 0x02C6U, 0x02ACU, 0x03BAU, 0x03D0U, 0x036EU, 0x0304U,
+        0x0566U, 0x050CU, 0x05B2U, 0x05D8U, 0x04CEU, 0x04A4U, 0x041AU, 0x0470U,
+        0x0636U, 0x065CU, 0x06E2U, 0x0688U, 0x079EU, 0x07F4U, 0x074AU, 0x0720U,
+        0x03C6U, 0x03ACU, 0x0312U, 0x0378U, 0x026EU, 0x0204U, 0x02BAU, 0x02D0U,
+        0x0096U, 0x00FCU, 0x0042U, 0x0028U, 0x013EU, 0x0154U, 0x01EAU, 0x0180U,
+        0x0037U, 0x005DU, 0x00E3U, 0x0089U, 0x019FU, 0x01F5U, 0x014BU, 0x0121U,
+        0x0367U, 0x030DU, 0x03B3U, 0x03D9U, 0x02CFU, 0x02A5U, 0x021BU, 0x0271U,
+        0x0697U, 0x06FDU, 0x0643U, 0x0629U, 0x073FU, 0x0755U, 0x07EBU, 0x0781U,
+        0x05C7U, 0x05ADU, 0x0513U, 0x0579U, 0x046FU, 0x0405U, 0x04BBU, 0x04D1U,
+        0x07D5U, 0x07BFU, 0x0701U, 0x076BU, 0x067DU, 0x0617U, 0x06A9U, 0x06C3U,
+        0x0485U, 0x04EFU, 0x0451U, 0x043BU, 0x052DU, 0x0547U, 0x05F9U, 0x0593U,
+        0x0175U, 0x011FU, 0x01A1U, 0x01CBU, 0x00DDU, 0x00B7U, 0x0009U, 0x0063U,
+        0x0225U, 0x024FU, 0x02F1U, 0x029BU, 0x038DU, 0x03E7U, 0x0359U, 0x0333U,
+        0x0284U, 0x02EEU, 0x0250U, 0x023AU, 0x032CU, 0x0346U, 0x03F8U, 0x0392U,
+        0x01D4U, 0x01BEU, 0x0100U, 0x016AU, 0x007CU, 0x0016U, 0x00A8U, 0x00C2U,
+        0x0424U, 0x044EU, 0x04F0U, 0x049AU, 0x058CU, 0x05E6U, 0x0558U, 0x0532U,
+        0x0774U, 0x071EU, 0x07A0U, 0x07CAU, 0x06DCU, 0x06B6U, 0x0608U, 0x0662U,
+    },
+    {
+        0x0000U, 0x065CU, 0x04A9U, 0x02F5U, 0x0143U, 0x071FU, 0x05EAU, 0x03B6U,
+        0x0286U, 0x04DAU, 0x062FU, 0x0073U, 0x03C5U, 0x0599U, 0x076CU, 0x0130U,
+        0x050CU, 0x0350U, 0x01A5U, 0x07F9U, 0x044FU, 0x0213U, 0x00E6U, 0x06BAU,
+        0x078AU, 0x01D6U, 0x0323U, 0x057FU, 0x06C9U, 0x0095U, 0x0260U, 0x043CU,
+        0x0209U, 0x0455U, 0x06A0U, 0x00FCU, 0x034AU, 0x0516U, 0x07E3U, 0x01BFU,
+        0x008FU, 0x06D3U, 0x0426U, 0x027AU, 0x01CCU, 0x0790U, 0x0565U, 0x0339U,
+        0x0705U, 0x0159U, 0x03ACU, 0x05F0U, 0x0646U, 0x001AU, 0x02EFU, 0x04B3U,
+        0x0583U, 0x03DFU, 0x012AU, 0x0776U, 0x04C0U, 0x029CU, 0x0069U, 0x0635U,
+        0x0412U, 0x024EU, 0x00BBU, 0x06E7U, 0x0551U, 0x030DU, 0x01F8U, 0x07A4U,
+        0x0694U, 0x00C8U, 0x023DU, 0x0461U, 0x07D7U, 0x018BU, 0x037EU, 0x0522U,
+        0x011EU, 0x0742U, 0x05B7U, 0x03EBU, 0x005DU, 0x0601U, 0x04F4U, 0x02A8U,
+        0x0398U, 0x05C4U, 0x0731U, 0x016DU, 0x02DBU, 0x0487U, 0x0672U, 0x002EU,
+        0x061BU, 0x0047U, 0x02B2U, 0x04EEU, 0x0758U, 0x0104U, 0x03F1U, 0x05ADU,
+        0x049DU, 0x02C1U, 0x0034U, 0x0668U, 0x05DEU, 0x0382U, 0x0177U, 0x072BU,
+        0x0317U, 0x054BU, 0x07BEU, 0x01E2U, 0x0254U, 0x0408U, 0x06FDU, 0x00A1U,
+        0x0191U, 0x07CDU, 0x0538U, 0x0364U, 0x00D2U, 0x068EU, 0x047BU, 0x0227U,
+        0x0035U, 0x0669U, 0x049CU, 0x02C0U, 0x0176U, 0x072AU, 0x05DFU, 0x0383U,
+        0x02B3U, 0x04EFU, 0x061AU, 0x0046U, 0x03F0U, 0x05ACU, 0x0759U, 0x0105U,
+        0x0539U, 0x0365U, 0x0190U, 0x07CCU, 0x047AU, 0x0226U, 0x00D3U, 0x068FU,
+        0x07BFU, 0x01E3U, 0x0316U, 0x054AU, 0x06FCU, 0x00A0U, 0x0255U, 0x0409U,
+        0x023CU, 0x0460U, 0x0695U, 0x00C9U, 0x037FU, 0x0523U, 0x07D6U, 0x018AU,
+        0x00BAU, 0x06E6U, 0x0413U, 0x024FU, 0x01F9U, 0x07A5U, 0x0550U, 0x030CU,
+        0x0730U, 0x016CU, 0x0399U, 0x05C5U, 0x0673U, 0x002FU, 0x02DAU, 0x0486U,
+        0x05B6U, 0x03EAU, 0x011FU, 0x0743U, 0x04F5U, 0x02A9U, 0x005CU, 0x0600U,
+        0x0427U, 0x027BU, 0x008EU, 0x06D2U, 0x0564U, 0x0338U, 0x01CDU, 0x0791U,
+        0x06A1U, 0x00FDU, 0x0208U, 0x0454U, 0x07E2U, 0x01BEU, 0x034BU, 0x0517U,
+        0x012BU, 0x0777U, 0x0582U, 0x03DEU, 0x0068U, 0x0634U, 0x04C1U, 0x029DU,
+        0x03ADU, 0x05F1U, 0x0704U, 0x0158U, 0x02EEU, 0x04B2U, 0x0647U, 0x001BU,
+        0x062EU, 0x0072U, 0x0287U, 0x04DBU, 0x076DU, 0x0131U, 0x03C4U, 0x0598U,
+        0x04A8U, 0x02F4U, 0x0001U, 0x065DU, 0x05EBU, 0x03B7U, 0x0142U, 0x071EU,
+        0x0322U, 0x057EU, 0x078BU, 0x01D7U, 0x0261U, 0x043DU, 0x06C8U, 0x0094U,
+        0x01A4U, 0x07F8U, 0x050DU, 0x0351U, 0x00E7U, 0x06BBU, 0x044EU, 0x0212U,
+    },
+    {
+        0x0000U, 0x04EFU, 0x01CFU, 0x0520U, 0x039EU, 0x0771U, 0x0251U, 0x06BEU,
+        0x073CU, 0x03D3U, 0x06F3U, 0x021CU, 0x04A2U, 0x004DU, 0x056DU, 0x0182U,
+        0x0669U, 0x0286U, 0x07A6U, 0x0349U, 0x05F7U, 0x0118U, 0x0438U, 0x00D7U,
+        0x0155U, 0x05BAU, 0x009AU, 0x0475U, 0x02CBU, 0x0624U, 0x0304U, 0x07EBU,
+        0x04C3U, 0x002CU, 0x050CU, 0x01E3U, 0x075DU, 0x03B2U, 0x0692U, 0x027DU,
+        0x03FFU, 0x0710U, 0x0230U, 0x06DFU, 0x0061U, 0x048EU, 0x01AEU, 0x0541U,
+        0x02AAU, 0x0645U, 0x0365U, 0x078AU, 0x0134U, 0x05DBU, 0x00FBU, 0x0414U,
+        0x0596U, 0x0179U, 0x0459U, 0x00B6U, 0x0608U, 0x02E7U, 0x07C7U, 0x0328U,
+        0x0197U, 0x0578U, 0x0058U, 0x04B7U, 0x0209U, 0x06E6U, 0x03C6U, 0x0729U,
+        0x06ABU, 0x0244U, 0x0764U, 0x038BU, 0x0535U, 0x01DAU, 0x04FAU, 0x0015U,
+        0x07FEU, 0x0311U, 0x0631U, 0x02DEU, 0x0460U, 0x008FU, 0x05AFU, 0x0140U,
+        0x00C2U, 0x042DU, 0x010DU, 0x05E2U, 0x035CU, 0x07B3U, 0x0293U, 0x067CU,
+        0x0554U, 0x01BBU, 0x049BU, 0x0074U, 0x06CAU, 0x0225U, 0x0705U, 0x03EAU,
+        0x0268U, 0x0687U, 0x03A7U, 0x0748U, 0x01F6U, 0x0519U, 0x0039U, 0x04D6U,
+        0x033DU, 0x07D2U, 0x02F2U, 0x061DU, 0x00A3U, 0x044CU, 0x016CU, 0x0583U,
+        0x0401U, 0x00EEU, 0x05CEU, 0x0121U, 0x079FU, 0x0370U, 0x0650U, 0x02BFU,
+        0x032EU, 0x07C1U, 0x02E1U, 0x060EU, 0x00B0U, 0x045FU, 0x017FU, 0x0590U,
+        0x0412U, 0x00FDU, 0x05DDU, 0x0132U, 0x078CU, 0x0363U, 0x0643U, 0x02ACU,
+        0x0547U, 0x01A8U, 0x0488U, 0x0067U, 0x06D9U, 0x0236U, 0x0716U, 0x03F9U,
+        0x027BU, 0x0694U, 0x03B4U, 0x075BU, 0x01E5U, 0x050AU, 0x002AU, 0x04C5U,
+        0x07EDU, 0x0302U, 0x0622U, 0x02CDU, 0x0473U, 0x009CU, 0x05BCU, 0x0153U,
+        0x00D1U, 0x043EU, 0x011EU, 0x05F1U, 0x034FU, 0x07A0U, 0x0280U, 0x066FU,
+        0x0184U, 0x056BU, 0x004BU, 0x04A4U, 0x021AU, 0x06F5U, 0x03D5U, 0x073AU,
+        0x06B8U, 0x0257U, 0x0777U, 0x0398U, 0x0526U, 0x01C9U, 0x04E9U, 0x0006U,
+        0x02B9U, 0x0656U, 0x0376U, 0x0799U, 0x0127U, 0x05C8U, 0x00E8U, 0x0407U,
+        0x0585U, 0x016AU, 0x044AU, 0x00A5U, 0x061BU, 0x02F4U, 0x07D4U, 0x033BU,
+        0x04D0U, 0x003FU, 0x051FU, 0x01F0U, 0x074EU, 0x03A1U, 0x0681U, 0x026EU,
+        0x03ECU, 0x0703U, 0x0223U, 0x06CCU, 0x0072U, 0x049DU, 0x01BDU, 0x0552U,
+        0x067AU, 0x0295U, 0x07B5U, 0x035AU, 0x05E4U, 0x010BU, 0x042BU, 0x00C4U,
+        0x0146U, 0x05A9U, 0x0089U, 0x0466U, 0x02D8U, 0x0637U, 0x0317U, 0x07F8U,
+        0x0013U, 0x04FCU, 0x01DCU, 0x0533U, 0x038DU, 0x0762U, 0x0242U, 0x06ADU,
+        0x072FU, 0x03C0U, 0x06E0U, 0x020FU, 0x04B1U, 0x005EU, 0x057EU, 0x0191U,
+    },
+#endif
+};
+// clang-format on
+
+#endif // IFX_CRC_TABLES_H
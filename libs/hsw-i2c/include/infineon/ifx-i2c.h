@@ -124,6 +124,12 @@ ifx_status_t ifx_i2c_set_slave_address(ifx_protocol_t *self, uint16_t address);
  * between consecutive I2C requests. Setting this guard time will ensure that
  * said time is awaited between requests.
  *
+ * The guard time is measured from the end of the previous transaction.
+ * Implementations shall timestamp every transaction (e.g. by setting an
+ * \c ifx_timer_t to the guard time once it has finished) and only wait for
+ * the remainder before the next one, so that time spent by upper layers
+ * between transactions is not waited for twice.
+ *
  * \param[in] self Protocol object to get I2C guard time for.
  * \param[out] guard_time_us_buffer Buffer to store I2C guard time in.
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
@@ -138,6 +144,9 @@ ifx_status_t ifx_i2c_get_guard_time(ifx_protocol_t *self,
 /**
  * \brief Sets guard time to be waited between I2C transmissions.
  *
+ * \details Takes effect for the next transaction, the remaining guard time of
+ * the previous transaction is not extended.
+ *
  * \param[in] self Protocol object to set I2C guard time for.
  * \param[in] guard_time_us Desired I2C guard time in [us].
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
@@ -59,6 +59,23 @@ extern "C" {
  */
 #define IFX_PROTOCOL_TRANSCEIVE         UINT8_C(0x05)
 
+/**
+ * \brief IFX error encoding function identifier for ifx_protocol_set_lock().
+ */
+#define IFX_PROTOCOL_SET_LOCK           UINT8_C(0x06)
+
+/**
+ * \brief IFX error encoding function identifier for ifx_protocol_lock() and
+ * \ref ifx_protocol_lock_acquire_callback_t.
+ */
+#define IFX_PROTOCOL_LOCK               UINT8_C(0x07)
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_protocol_get_request_buffer().
+ */
+#define IFX_PROTOCOL_GET_REQUEST_BUFFER UINT8_C(0x08)
+
 /**
  * \brief Function independent error reason for invalid protocol stack (missing
  * required function).
@@ -68,6 +85,48 @@ extern "C" {
 // Forward declaration only
 typedef struct ifx_protocol ifx_protocol_t;
 
+/**
+ * \brief Acquires lock of protocol stack.
+ *
+ * \details Must block until the lock is held by the calling thread. The lock
+ * must be recursive (acquirable again by the thread already holding it), as
+ * protocol layers call their own locked public functions internally.
+ *
+ * \param[in] context Context of the lock (e.g. the mutex).
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+typedef ifx_status_t (*ifx_protocol_lock_acquire_callback_t)(void *context);
+
+/**
+ * \brief Releases lock of protocol stack acquired once by calling thread.
+ *
+ * \param[in] context Context of the lock (e.g. the mutex).
+ */
+typedef void (*ifx_protocol_lock_release_callback_t)(void *context);
+
+/** \struct ifx_protocol_lock_t
+ * \brief Platform specific recursive lock serializing calls to a protocol
+ * stack from several threads.
+ */
+typedef struct
+{
+    /**
+     * \brief Function acquiring the lock.
+     */
+    ifx_protocol_lock_acquire_callback_t acquire;
+
+    /**
+     * \brief Function releasing the lock.
+     */
+    ifx_protocol_lock_release_callback_t release;
+
+    /**
+     * \brief Context passed to \ref acquire and \ref release.
+     */
+    void *context;
+} ifx_protocol_lock_t;
+
 /**
  * \brief Protocol layer specific secure element activation function.
  *
@@ -170,6 +229,44 @@ typedef ifx_status_t (*ifx_protocol_receive_callback_t)(ifx_protocol_t *self,
                                                         uint8_t **response,
                                                         size_t *response_len);
 
+/**
+ * \brief Protocol layer specific function providing a buffer to encode the
+ * next request in.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] size Number of bytes the request will (at most) consist of.
+ * \param[out] buffer Buffer to store pointer to request buffer in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value if no buffer of \p size bytes is available.
+ */
+typedef ifx_status_t (*ifx_protocol_get_request_buffer_callback_t)(
+    ifx_protocol_t *self, size_t size, uint8_t **buffer);
+
+/**
+ * \brief Returns buffer owned by the protocol stack to encode the next request
+ * in.
+ *
+ * \details Some protocol layers can send data from their own transmit buffer
+ * without copying it (e.g. T=1' with requests fitting into a single block).
+ * Callers may encode a request of up to \p size bytes into the returned buffer
+ * and pass it to ifx_protocol_transceive() as \c data. The buffer stays valid
+ * until the next call to any function of the protocol stack. If the protocol
+ * stack is shared between threads the lock must be held from this call until
+ * ifx_protocol_transceive() has returned.
+ *
+ * Only the top layer is asked as data passed to lower layers is framed first.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] size Number of bytes the request will (at most) consist of.
+ * \param[out] buffer Buffer to store pointer to request buffer in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value if no buffer of \p size bytes is available (callers should then
+ * encode the request into a buffer of their own).
+ * \relates ifx_protocol
+ */
+ifx_status_t ifx_protocol_get_request_buffer(ifx_protocol_t *self, size_t size,
+                                             uint8_t **buffer);
+
 /**
  * \brief Protocol layer specific destructor.
  *
@@ -207,6 +304,57 @@ void ifx_protocol_destroy(ifx_protocol_t *self);
  */
 void ifx_protocol_set_logger(ifx_protocol_t *self, ifx_logger_t *logger);
 
+/**
+ * \brief Sets lock to be used by Protocol.
+ *
+ * \details Sets lock for whole protocol stack, so all layers below will also
+ * use it. Layers stacked on top of \p self later on use the lock of the
+ * closest layer below them that has one. Once set, ifx_protocol_activate(),
+ * ifx_protocol_transceive() and the public functions of protocol layers
+ * modifying protocol state (e.g. T=1' S-blocks) hold the lock while running,
+ * so several threads can share one protocol stack. Without lock (default) no
+ * synchronization is performed.
+ *
+ * Locking can be compiled out for single-threaded builds by defining \c
+ * IFX_PROTOCOL_SINGLE_THREADED, in which case this function fails.
+ *
+ * \param[in] self Protocol object to set lock for.
+ * \param[in] lock Recursive lock to be used (might be \c NULL to clear lock).
+ * Must stay valid as long as it is set.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \relates ifx_protocol
+ */
+ifx_status_t ifx_protocol_set_lock(ifx_protocol_t *self,
+                                   ifx_protocol_lock_t *lock);
+
+#ifdef IFX_PROTOCOL_SINGLE_THREADED
+#define ifx_protocol_lock(self)   ((void) (self), IFX_SUCCESS)
+#define ifx_protocol_unlock(self) ((void) (self))
+#else
+/**
+ * \brief Acquires lock of protocol stack (if any).
+ *
+ * \details For protocol layer developers to guard public functions modifying
+ * protocol state. Every successful call must be paired with
+ * ifx_protocol_unlock().
+ *
+ * \param[in] self Protocol object to acquire lock for.
+ * \return ifx_status_t \c IFX_SUCCESS if successful or no lock is set, any
+ * other value in case of error.
+ * \relates ifx_protocol
+ */
+ifx_status_t ifx_protocol_lock(ifx_protocol_t *self);
+
+/**
+ * \brief Releases lock of protocol stack acquired by ifx_protocol_lock().
+ *
+ * \param[in] self Protocol object to release lock for.
+ * \relates ifx_protocol
+ */
+void ifx_protocol_unlock(ifx_protocol_t *self);
+#endif
+
 /**
  * \brief Initializes Protocol object by setting all members to valid values.
  *
@@ -290,6 +438,17 @@ struct ifx_protocol
      */
     ifx_protocol_receive_callback_t _receive;
 
+    /**
+     * \brief Private function providing a buffer to encode the next request
+     * in.
+     *
+     * \details Set by implementation's initialization function, do **NOT** set
+     * manually!
+     *
+     * \details Can be \c NULL if ISO/OSI layer has no transmit buffer to share.
+     */
+    ifx_protocol_get_request_buffer_callback_t _get_request_buffer;
+
     /**
      * \brief Private destructor if further cleanup is necessary
      *
@@ -311,6 +470,15 @@ struct ifx_protocol
      */
     ifx_logger_t *_logger;
 
+    /**
+     * \brief Private member for optional lock.
+     *
+     * \details Set by ifx_protocol_set_lock(), do **NOT** set manually!
+     *
+     * \details Might be \c NULL.
+     */
+    ifx_protocol_lock_t *_lock;
+
     /**
      * \brief Private member for generic properties as \c void*.
      *
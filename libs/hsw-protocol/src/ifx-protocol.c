@@ -35,18 +35,25 @@ ifx_status_t ifx_protocol_activate(ifx_protocol_t *self, uint8_t **response,
                          IFX_ILLEGAL_ARGUMENT);
     }
 
+    ifx_status_t status = ifx_protocol_lock(self);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+
     // Check if current layer has activation function
     if (self->_activate != NULL)
     {
-        return self->_activate(self, response, response_len);
+        status = self->_activate(self, response, response_len);
     }
 
     // Otherwise try next layer
-    if (self->_base != NULL)
+    else if (self->_base != NULL)
     {
-        return ifx_protocol_activate(self->_base, response, response_len);
+        status = ifx_protocol_activate(self->_base, response, response_len);
     }
-    return IFX_SUCCESS;
+    ifx_protocol_unlock(self);
+    return status;
 }
 
 /**
@@ -84,25 +91,68 @@ ifx_status_t ifx_protocol_transceive(ifx_protocol_t *self, const uint8_t *data,
                          IFX_ILLEGAL_ARGUMENT);
     }
 
+    // Check protocol stack before waiting for lock
+    if ((self->_transceive == NULL) &&
+        ((self->_transmit == NULL) || (self->_receive == NULL)))
+    {
+        return IFX_ERROR(LIB_PROTOCOL, IFX_PROTOCOL_TRANSCEIVE,
+                         IFX_PROTOCOL_STACK_INVALID);
+    }
+    ifx_status_t status = ifx_protocol_lock(self);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+
     // If protocol defines transceive function then directly use it
     if (self->_transceive != NULL)
     {
-        return self->_transceive(self, data, data_len, response, response_len);
+        status =
+            self->_transceive(self, data, data_len, response, response_len);
     }
 
     // Otherwise fall back to transmit / receive
-    if ((self->_transmit) == NULL || (self->_receive == NULL))
+    else
     {
-        return IFX_ERROR(LIB_PROTOCOL, IFX_PROTOCOL_TRANSCEIVE,
-                         IFX_PROTOCOL_STACK_INVALID);
+        status = self->_transmit(self, data, data_len);
+        if (!ifx_error_check(status))
+        {
+            status = self->_receive(self, IFX_PROTOCOL_RECEIVE_LEN_UNKOWN,
+                                    response, response_len);
+        }
+    }
+    ifx_protocol_unlock(self);
+    return status;
+}
+
+/**
+ * \brief Returns buffer owned by the protocol stack to encode the next request
+ * in.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] size Number of bytes the request will (at most) consist of.
+ * \param[out] buffer Buffer to store pointer to request buffer in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value if no buffer of \p size bytes is available.
+ * \relates ifx_protocol
+ */
+ifx_status_t ifx_protocol_get_request_buffer(ifx_protocol_t *self, size_t size,
+                                             uint8_t **buffer)
+{
+    // Validate parameters
+    if ((self == NULL) || (buffer == NULL))
+    {
+        return IFX_ERROR(LIB_PROTOCOL, IFX_PROTOCOL_GET_REQUEST_BUFFER,
+                         IFX_ILLEGAL_ARGUMENT);
     }
-    ifx_status_t status = self->_transmit(self, data, data_len);
-    if (ifx_error_check(status))
+
+    // Only top layer knows how data will be sent
+    if (self->_get_request_buffer == NULL)
     {
-        return status;
+        return IFX_ERROR(LIB_PROTOCOL, IFX_PROTOCOL_GET_REQUEST_BUFFER,
+                         IFX_PROTOCOL_STACK_INVALID);
     }
-    return self->_receive(self, IFX_PROTOCOL_RECEIVE_LEN_UNKOWN, response,
-                          response_len);
+    return self->_get_request_buffer(self, size, buffer);
 }
 
 /**
@@ -165,6 +215,100 @@ void ifx_protocol_set_logger(ifx_protocol_t *self, ifx_logger_t *logger)
     }
 }
 
+/**
+ * \brief Sets lock to be used by Protocol.
+ *
+ * \details Sets lock for whole protocol stack, so all layers below will also
+ * use it.
+ *
+ * \param[in] self Protocol object to set lock for.
+ * \param[in] lock Recursive lock to be used (might be \c NULL to clear lock).
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \relates ifx_protocol
+ */
+ifx_status_t ifx_protocol_set_lock(ifx_protocol_t *self,
+                                   ifx_protocol_lock_t *lock)
+{
+    // Validate parameters
+    if ((self == NULL) ||
+        ((lock != NULL) && ((lock->acquire == NULL) || (lock->release == NULL))))
+    {
+        return IFX_ERROR(LIB_PROTOCOL, IFX_PROTOCOL_SET_LOCK,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+#ifdef IFX_PROTOCOL_SINGLE_THREADED
+    if (lock != NULL)
+    {
+        return IFX_ERROR(LIB_PROTOCOL, IFX_PROTOCOL_SET_LOCK,
+                         IFX_INVALID_STATE);
+    }
+#endif
+
+    // Set lock for all layers
+    for (ifx_protocol_t *layer = self; layer != NULL; layer = layer->_base)
+    {
+        layer->_lock = lock;
+    }
+    return IFX_SUCCESS;
+}
+
+#ifndef IFX_PROTOCOL_SINGLE_THREADED
+/**
+ * \brief Returns lock of protocol layer or of the closest layer below it.
+ *
+ * \details Layers stacked on top of a stack after ifx_protocol_set_lock() has
+ * been called thereby use the lock of the stack as well.
+ *
+ * \param[in] self Protocol object to find lock for.
+ * \return ifx_protocol_lock_t* Lock to be used or \c NULL if no lock is set.
+ */
+static ifx_protocol_lock_t *ifx_protocol_find_lock(ifx_protocol_t *self)
+{
+    for (ifx_protocol_t *layer = self; layer != NULL; layer = layer->_base)
+    {
+        if (layer->_lock != NULL)
+        {
+            return layer->_lock;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * \brief Acquires lock of protocol stack (if any).
+ *
+ * \param[in] self Protocol object to acquire lock for.
+ * \return ifx_status_t \c IFX_SUCCESS if successful or no lock is set, any
+ * other value in case of error.
+ * \relates ifx_protocol
+ */
+ifx_status_t ifx_protocol_lock(ifx_protocol_t *self)
+{
+    ifx_protocol_lock_t *lock = ifx_protocol_find_lock(self);
+    if (lock == NULL)
+    {
+        return IFX_SUCCESS;
+    }
+    return lock->acquire(lock->context);
+}
+
+/**
+ * \brief Releases lock of protocol stack acquired by ifx_protocol_lock().
+ *
+ * \param[in] self Protocol object to release lock for.
+ * \relates ifx_protocol
+ */
+void ifx_protocol_unlock(ifx_protocol_t *self)
+{
+    ifx_protocol_lock_t *lock = ifx_protocol_find_lock(self);
+    if (lock != NULL)
+    {
+        lock->release(lock->context);
+    }
+}
+#endif
+
 /**
  * \brief Initializes Protocol object by setting all members to valid values.
  *
@@ -190,8 +334,10 @@ ifx_status_t ifx_protocol_layer_initialize(ifx_protocol_t *self)
     self->_transceive = NULL;
     self->_transmit = NULL;
     self->_receive = NULL;
+    self->_get_request_buffer = NULL;
     self->_destructor = NULL;
     self->_logger = NULL;
+    self->_lock = NULL;
     self->_properties = NULL;
     return IFX_SUCCESS;
 }
@@ -0,0 +1,386 @@
+// SPDX-FileCopyrightText: 2024 Infineon Technologies AG
+//
+// SPDX-License-Identifier: MIT
+
+/**
+ * \file t1prime-benchmark.c
+ * \brief Measures T=1' throughput and latency against the virtual secure
+ * element for a matrix of APDU sizes and link settings.
+ *
+ * \details Prints one CSV line per setting so that results can be compared
+ * automatically between library versions. Usage:
+ * `hsw-t1prime-benchmark [iterations]`.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "infineon/ifx-error.h"
+#include "infineon/ifx-protocol.h"
+#include "infineon/ifx-t1prime-virtual.h"
+#include "infineon/ifx-t1prime.h"
+
+/**
+ * \brief Number of APDUs exchanged per setting if not given on command line.
+ */
+#define IFX_T1PRIME_BENCHMARK_ITERATIONS 200U
+
+#ifdef IFX_T1PRIME_INTERFACE_I2C
+/**
+ * \brief Name of interface the library has been built for.
+ */
+#define IFX_T1PRIME_BENCHMARK_INTERFACE "i2c"
+#else
+#define IFX_T1PRIME_BENCHMARK_INTERFACE "spi"
+#endif
+
+/**
+ * \brief Description of single BWT / WTX pattern.
+ */
+typedef struct
+{
+    const char *name;
+    uint16_t bwt_ms;
+    uint8_t wtx_requests;
+    uint8_t wtx_multiplier;
+} wtx_pattern_t;
+
+/**
+ * \brief Single setting of the benchmark matrix.
+ */
+typedef struct
+{
+    size_t apdu_len;
+    size_t ifsc;
+    const wtx_pattern_t *wtx;
+    uint32_t crc_error_rate_ppm;
+} benchmark_setting_t;
+
+/**
+ * \brief Results of single setting (all values accumulated over iterations).
+ */
+typedef struct
+{
+    size_t failures;
+    uint64_t blocks;
+    uint64_t wire_bytes;
+    uint64_t transactions;
+    uint64_t retransmissions;
+    uint64_t allocations;
+    double cpu_seconds;
+    uint64_t latency_p50_us;
+    uint64_t latency_p99_us;
+} benchmark_result_t;
+
+/**
+ * \brief APDU sizes (command data, response is 2 bytes longer).
+ */
+static const size_t apdu_sizes[] = {16U, 261U, 1024U, 4096U};
+
+/**
+ * \brief IFSC values announced by virtual secure element.
+ */
+static const size_t ifsc_values[] = {32U, 254U, 1024U};
+
+/**
+ * \brief BWT / WTX patterns (S(WTX request)s are sent before every response).
+ */
+static const wtx_pattern_t wtx_patterns[] = {{"none", 300U, 0U, 0U},
+                                             {"single", 300U, 1U, 1U},
+                                             {"repeated", 100U, 4U, 2U}};
+
+/**
+ * \brief Probabilities in [1/1000000] of blocks sent with invalid CRC.
+ */
+static const uint32_t crc_error_rates_ppm[] = {0U, 1000U, 10000U};
+
+#ifdef IFX_T1PRIME_BENCHMARK_COUNT_ALLOCATIONS
+/**
+ * \brief Number of heap allocations since program start.
+ *
+ * \details Counted by wrapping malloc(), calloc() and realloc() at link time
+ * (`-Wl,--wrap`), so allocations of the virtual secure element are included.
+ */
+static uint64_t allocations = 0U;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void *__wrap_malloc(size_t size);
+void *__wrap_calloc(size_t count, size_t size);
+void *__wrap_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    allocations++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    allocations++;
+    return __real_realloc(ptr, size);
+}
+#endif
+
+/**
+ * \brief Returns latencies modelled for the interface the library has been
+ * built for.
+ *
+ * \param[out] timing Buffer to store latencies in.
+ */
+static void get_timing(ifx_t1prime_virtual_timing_t *timing)
+{
+#ifdef IFX_T1PRIME_INTERFACE_I2C
+    // 400kHz with 9 clock cycles per byte plus start, address and stop
+    timing->transaction_us = 30U;
+    timing->byte_ns = 22500U;
+#else
+    // 1MHz with 8 clock cycles per byte plus chip select
+    timing->transaction_us = 5U;
+    timing->byte_ns = 8000U;
+#endif
+    timing->turnaround_us = 100U;
+    timing->processing_us = 500U;
+}
+
+/**
+ * \brief Compares two latencies for qsort().
+ *
+ * \param[in] a First latency.
+ * \param[in] b Second latency.
+ * \return int Negative, \c 0 or positive if \p a is less, equal or greater
+ * than \p b.
+ */
+static int compare_latencies(const void *a, const void *b)
+{
+    uint64_t first = *(const uint64_t *) a;
+    uint64_t second = *(const uint64_t *) b;
+    return (first > second) - (first < second);
+}
+
+/**
+ * \brief Returns percentile of sorted latencies (nearest rank).
+ *
+ * \param[in] latencies Sorted latencies.
+ * \param[in] count Number of values in \p latencies.
+ * \param[in] percent Percentile to be returned.
+ * \return uint64_t Latency at given percentile.
+ */
+static uint64_t percentile(const uint64_t *latencies, size_t count,
+                           size_t percent)
+{
+    size_t rank = ((count * percent) + 99U) / 100U;
+    return latencies[(rank > 0U) ? (rank - 1U) : 0U];
+}
+
+/**
+ * \brief Exchanges APDUs for single setting.
+ *
+ * \param[in] setting Setting to be measured.
+ * \param[in] iterations Number of APDUs to be exchanged.
+ * \param[out] result Buffer to store results in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other value if the
+ * setting could not be measured at all.
+ */
+static ifx_status_t run_setting(const benchmark_setting_t *setting,
+                                size_t iterations, benchmark_result_t *result)
+{
+    memset(result, 0, sizeof(benchmark_result_t));
+    uint8_t *data = malloc(setting->apdu_len);
+    uint64_t *latencies = malloc(iterations * sizeof(uint64_t));
+    if ((data == NULL) || (latencies == NULL))
+    {
+        free(data);
+        free(latencies);
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                         IFX_OUT_OF_MEMORY);
+    }
+    for (size_t i = 0U; i < setting->apdu_len; i++)
+    {
+        data[i] = (uint8_t) (i * 31U);
+    }
+
+    // Virtual secure element as driver layer
+    ifx_protocol_t driver;
+    ifx_protocol_t protocol;
+    ifx_t1prime_virtual_timing_t timing;
+    get_timing(&timing);
+    ifx_status_t status = ifx_t1prime_virtual_initialize(&driver);
+    if (ifx_error_check(status))
+    {
+        free(data);
+        free(latencies);
+        return status;
+    }
+    status = ifx_t1prime_virtual_set_link_parameters(
+        &driver, setting->ifsc, 0xfeU, setting->wtx->bwt_ms);
+    if (!ifx_error_check(status))
+    {
+        status = ifx_t1prime_virtual_set_timing(&driver, &timing);
+    }
+    if (!ifx_error_check(status))
+    {
+        status = ifx_t1prime_initialize(&protocol, &driver);
+    }
+    if (ifx_error_check(status))
+    {
+        ifx_protocol_destroy(&driver);
+        free(data);
+        free(latencies);
+        return status;
+    }
+
+    uint8_t *response = NULL;
+    size_t response_len = 0U;
+    status = ifx_protocol_activate(&protocol, &response, &response_len);
+    free(response);
+
+    ifx_t1prime_virtual_statistics_t statistics;
+    for (size_t i = 0U; (i < iterations) && !ifx_error_check(status); i++)
+    {
+        ifx_t1prime_virtual_faults_t faults;
+        memset(&faults, 0, sizeof(faults));
+        faults.wtx_requests = setting->wtx->wtx_requests;
+        faults.wtx_multiplier = setting->wtx->wtx_multiplier;
+        faults.crc_error_rate_ppm = setting->crc_error_rate_ppm;
+        faults.seed = (uint32_t) i + 1U;
+        status = ifx_t1prime_virtual_inject_faults(&driver, &faults);
+        if (!ifx_error_check(status))
+        {
+            status = ifx_t1prime_virtual_get_statistics(&driver, &statistics,
+                                                        true);
+        }
+        if (ifx_error_check(status))
+        {
+            break;
+        }
+
+#ifdef IFX_T1PRIME_BENCHMARK_COUNT_ALLOCATIONS
+        uint64_t allocations_before = allocations;
+#endif
+        clock_t start = clock();
+        ifx_status_t exchange_status =
+            ifx_protocol_transceive(&protocol, data, setting->apdu_len,
+                                    &response, &response_len);
+        result->cpu_seconds += (double) (clock() - start) / CLOCKS_PER_SEC;
+#ifdef IFX_T1PRIME_BENCHMARK_COUNT_ALLOCATIONS
+        result->allocations += allocations - allocations_before;
+#endif
+        if (ifx_error_check(exchange_status) ||
+            (response_len != (setting->apdu_len + 2U)) ||
+            (memcmp(response, data, setting->apdu_len) != 0))
+        {
+            result->failures++;
+        }
+        if (!ifx_error_check(exchange_status))
+        {
+            free(response);
+        }
+
+        status = ifx_t1prime_virtual_get_statistics(&driver, &statistics,
+                                                    false);
+        result->blocks += statistics.blocks_received + statistics.blocks_sent;
+        result->wire_bytes += statistics.bytes_written + statistics.bytes_read;
+        result->transactions += statistics.transactions;
+        result->retransmissions += statistics.retransmissions;
+        latencies[i] = statistics.time_us;
+    }
+
+    if (!ifx_error_check(status))
+    {
+        qsort(latencies, iterations, sizeof(uint64_t), compare_latencies);
+        result->latency_p50_us = percentile(latencies, iterations, 50U);
+        result->latency_p99_us = percentile(latencies, iterations, 99U);
+    }
+    ifx_protocol_destroy(&protocol);
+    free(data);
+    free(latencies);
+    return status;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t iterations = IFX_T1PRIME_BENCHMARK_ITERATIONS;
+    if (argc > 1)
+    {
+        iterations = (size_t) strtoul(argv[1], NULL, 10);
+        if (iterations == 0U)
+        {
+            fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    int exit_code = EXIT_SUCCESS;
+    printf("interface,apdu_len,ifsc,bwt_ms,wtx,crc_error_rate_ppm,iterations,"
+           "failures,blocks_per_apdu,wire_bytes_per_apdu,"
+           "transactions_per_apdu,retransmissions_per_apdu,"
+           "allocations_per_apdu,cpu_us_per_apdu,latency_p50_us,"
+           "latency_p99_us\n");
+    for (size_t a = 0U; a < (sizeof(apdu_sizes) / sizeof(apdu_sizes[0])); a++)
+    {
+        for (size_t f = 0U; f < (sizeof(ifsc_values) / sizeof(ifsc_values[0]));
+             f++)
+        {
+            for (size_t w = 0U;
+                 w < (sizeof(wtx_patterns) / sizeof(wtx_patterns[0])); w++)
+            {
+                for (size_t c = 0U; c < (sizeof(crc_error_rates_ppm) /
+                                         sizeof(crc_error_rates_ppm[0]));
+                     c++)
+                {
+                    benchmark_setting_t setting = {
+                        apdu_sizes[a], ifsc_values[f], &wtx_patterns[w],
+                        crc_error_rates_ppm[c]};
+                    benchmark_result_t result;
+                    ifx_status_t status =
+                        run_setting(&setting, iterations, &result);
+                    if (ifx_error_check(status))
+                    {
+                        fprintf(stderr,
+                                "setting %zu/%zu/%s/%lu failed: %08lx\n",
+                                setting.apdu_len, setting.ifsc,
+                                setting.wtx->name,
+                                (unsigned long) setting.crc_error_rate_ppm,
+                                (unsigned long) status);
+                        exit_code = EXIT_FAILURE;
+                        continue;
+                    }
+
+                    double count = (double) iterations;
+#ifdef IFX_T1PRIME_BENCHMARK_COUNT_ALLOCATIONS
+                    double allocations_per_apdu =
+                        (double) result.allocations / count;
+#else
+                    double allocations_per_apdu = -1.0;
+#endif
+                    printf("%s,%zu,%zu,%u,%s,%lu,%zu,%zu,%.2f,%.2f,%.2f,%.3f,"
+                           "%.2f,%.2f,%llu,%llu\n",
+                           IFX_T1PRIME_BENCHMARK_INTERFACE, setting.apdu_len,
+                           setting.ifsc, (unsigned) setting.wtx->bwt_ms,
+                           setting.wtx->name,
+                           (unsigned long) setting.crc_error_rate_ppm,
+                           iterations, result.failures,
+                           (double) result.blocks / count,
+                           (double) result.wire_bytes / count,
+                           (double) result.transactions / count,
+                           (double) result.retransmissions / count,
+                           allocations_per_apdu,
+                           (result.cpu_seconds * 1000000.0) / count,
+                           (unsigned long long) result.latency_p50_us,
+                           (unsigned long long) result.latency_p99_us);
+                }
+            }
+        }
+    }
+    return exit_code;
+}
@@ -0,0 +1,227 @@
+// SPDX-FileCopyrightText: 2024 Infineon Technologies AG
+//
+// SPDX-License-Identifier: MIT
+
+/**
+ * \file infineon/ifx-t1prime-irq-fd.h
+ * \brief Global Platform T=1' interrupt handler waiting on a file descriptor.
+ *
+ * \details Ready-made \ref ifx_t1prime_irq_handler_t for POSIX systems. The
+ * T=1' data interrupt is signalled by a file descriptor becoming readable,
+ * e.g. a GPIO character device line event file descriptor, an eventfd or the
+ * read end of a pipe.
+ */
+#ifndef IFX_T1PRIME_IRQ_FD_H
+#define IFX_T1PRIME_IRQ_FD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "infineon/ifx-error.h"
+#include "infineon/ifx-protocol.h"
+#include "infineon/ifx-t1prime.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_irq_fd_initialize().
+ */
+#define IFX_T1PRIME_IRQ_FD_INITIALIZE     0x25u
+
+/**
+ * \brief IFX error encoding function identifier for ifx_t1prime_set_irq_fd().
+ */
+#define IFX_T1PRIME_SET_IRQ_FD            0x26u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_irq_fd_get_statistics().
+ */
+#define IFX_T1PRIME_IRQ_FD_GET_STATISTICS 0x27u
+
+/**
+ * \brief Error reason if file descriptor has been closed or is in an error
+ * state while waiting for the data interrupt.
+ *
+ * \details Used in combination with \ref LIB_T1PRIME and \ref IFX_T1PRIME_IRQ.
+ */
+#define IFX_T1PRIME_IRQ_FD_HANGUP         0x02u
+
+/** \struct ifx_t1prime_irq_fd_statistics_t
+ * \brief Waits for the data interrupt counted by file descriptor interrupt
+ * handler.
+ */
+typedef struct
+{
+    /**
+     * \brief Number of times the interrupt handler has been called.
+     */
+    uint32_t waits;
+
+    /**
+     * \brief Number of waits woken up by the interrupt.
+     */
+    uint32_t triggered;
+
+    /**
+     * \brief Number of waits that timed out.
+     */
+    uint32_t timeouts;
+
+    /**
+     * \brief Number of waits that failed.
+     */
+    uint32_t errors;
+
+    /**
+     * \brief Sum of wait times of all triggered waits in [us].
+     *
+     * \details The wait time is the time from the start of a wait until the
+     * interrupt handler returns to the T=1' protocol. It mostly consists of
+     * the time the secure element needs to prepare its response and is not
+     * the latency between the interrupt edge and waking up (see
+     * \ref latency_total_us).
+     */
+    uint64_t wait_total_us;
+
+    /**
+     * \brief Shortest wait time of all triggered waits in [us].
+     */
+    uint32_t wait_min_us;
+
+    /**
+     * \brief Longest wait time of all triggered waits in [us].
+     */
+    uint32_t wait_max_us;
+
+    /**
+     * \brief Number of triggered waits whose wake-up latency has been
+     * measured.
+     *
+     * \details Only GPIO line events of the version 2 GPIO character device
+     * ABI (Linux) carry the time of the interrupt edge. Other file
+     * descriptors (e.g. eventfds) only count wait times.
+     */
+    uint32_t latencies;
+
+    /**
+     * \brief Sum of wake-up latencies in [us].
+     *
+     * \details The wake-up latency is the time from the interrupt edge
+     * (\c timestamp_ns of the GPIO line event, \c CLOCK_MONOTONIC) until the
+     * interrupt handler returns to the T=1' protocol.
+     */
+    uint64_t latency_total_us;
+
+    /**
+     * \brief Shortest wake-up latency in [us].
+     */
+    uint32_t latency_min_us;
+
+    /**
+     * \brief Longest wake-up latency in [us].
+     */
+    uint32_t latency_max_us;
+} ifx_t1prime_irq_fd_statistics_t;
+
+/** \struct ifx_t1prime_irq_fd_t
+ * \brief File descriptor signalling the T=1' data interrupt.
+ *
+ * \details Owned by the caller and must stay valid as long as it is set for a
+ * protocol stack. Members are only to be accessed using the functions in this
+ * file.
+ */
+typedef struct
+{
+    /**
+     * \brief File descriptor becoming readable on data interrupt.
+     */
+    int _fd;
+
+    /**
+     * \brief Waits counted so far.
+     */
+    ifx_t1prime_irq_fd_statistics_t _statistics;
+} ifx_t1prime_irq_fd_t;
+
+/**
+ * \brief Initializes file descriptor interrupt source.
+ *
+ * \details Every time \p fd is readable the interrupt is considered triggered
+ * and one read() of at most 64 bytes consumes the event. Suitable file
+ * descriptors are GPIO line event file descriptors (requested for the edge
+ * signalling data ready), eventfds and pipes. Non-blocking file descriptors
+ * are recommended. The file descriptor is not closed by this library.
+ *
+ * \param[out] irq File descriptor interrupt source to be initialized.
+ * \param[in] fd File descriptor becoming readable on data interrupt.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_irq_fd_initialize(ifx_t1prime_irq_fd_t *irq, int fd);
+
+/**
+ * \brief Enables IRQ mode waiting for the data interrupt on a file descriptor.
+ *
+ * \details Sets ifx_t1prime_irq_fd_handler() as interrupt handler and \p irq
+ * as its context.
+ *
+ * \code
+ *      int fd = eventfd(0, EFD_NONBLOCK);
+ *      ifx_t1prime_irq_fd_t irq;
+ *      ifx_t1prime_irq_fd_initialize(&irq, fd);
+ *      ifx_t1prime_set_irq_fd(&protocol, &irq);
+ * \endcode
+ *
+ * \param[in] self T=1' protocol stack to enable IRQ mode for.
+ * \param[in] irq File descriptor interrupt source (\c NULL to switch back to
+ * polling mode).
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_set_irq_fd(ifx_protocol_t *self,
+                                    ifx_t1prime_irq_fd_t *irq);
+
+/**
+ * \brief \ref ifx_t1prime_irq_handler_t waiting on the file descriptor set
+ * via ifx_t1prime_set_irq_fd().
+ *
+ * \details Sleeps in poll() until the file descriptor is readable or \p
+ * timeout_us has passed. The timeout is rounded up to full milliseconds and
+ * restarted with the remaining time if poll() is interrupted by a signal.
+ *
+ * \param[in] self T=1' protocol stack waiting for data interrupt.
+ * \param[in] timeout_us Timeout until interrupt has to have triggered (in
+ * [us]).
+ * \return ifx_status_t \c IFX_T1PRIME_IRQ_TRIGGERED if successful, \c
+ * IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IRQ, IFX_T1PRIME_IRQ_NOT_TRIGGERED) on
+ * timeout, any other value in case of error.
+ */
+ifx_status_t ifx_t1prime_irq_fd_handler(ifx_protocol_t *self,
+                                        uint32_t timeout_us);
+
+/**
+ * \brief Returns waits counted by file descriptor interrupt handler.
+ *
+ * \param[in] irq File descriptor interrupt source.
+ * \param[out] statistics Buffer to store counters in.
+ * \param[in] reset Whether to reset counters afterwards.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t
+ifx_t1prime_irq_fd_get_statistics(ifx_t1prime_irq_fd_t *irq,
+                                  ifx_t1prime_irq_fd_statistics_t *statistics,
+                                  bool reset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IFX_T1PRIME_IRQ_FD_H
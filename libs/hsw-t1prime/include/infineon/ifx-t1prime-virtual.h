@@ -0,0 +1,345 @@
+// SPDX-FileCopyrightText: 2024 Infineon Technologies AG
+//
+// SPDX-License-Identifier: MIT
+
+/**
+ * \file infineon/ifx-t1prime-virtual.h
+ * \brief Virtual Global Platform T=1' secure element for testing and
+ * benchmarking without hardware.
+ *
+ * \details The virtual secure element is a physical layer (driver) protocol
+ * stack that can be used as base layer of ifx_t1prime_initialize(). It
+ * emulates the secure element side of the T=1' protocol in-process using the
+ * framing of the interface the library has been built for (I2C or SPI).
+ */
+#ifndef IFX_T1PRIME_VIRTUAL_H
+#define IFX_T1PRIME_VIRTUAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "infineon/ifx-error.h"
+#include "infineon/ifx-protocol.h"
+#include "infineon/ifx-t1prime-lib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_virtual_initialize().
+ */
+#define IFX_T1PRIME_VIRTUAL_INITIALIZE          0x1Bu
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_virtual_set_apdu_handler().
+ */
+#define IFX_T1PRIME_VIRTUAL_SET_APDU_HANDLER    0x1Cu
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_virtual_set_link_parameters().
+ */
+#define IFX_T1PRIME_VIRTUAL_SET_LINK_PARAMETERS 0x1Du
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_virtual_set_timing().
+ */
+#define IFX_T1PRIME_VIRTUAL_SET_TIMING          0x1Eu
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_virtual_inject_faults().
+ */
+#define IFX_T1PRIME_VIRTUAL_INJECT_FAULTS       0x1Fu
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_virtual_get_statistics().
+ */
+#define IFX_T1PRIME_VIRTUAL_GET_STATISTICS      0x20u
+
+/**
+ * \brief Error reason if virtual secure element does not acknowledge an I2C
+ * read because no response is ready yet.
+ *
+ * \details Used in combination with \ref LIB_T1PRIME and \ref
+ * IFX_PROTOCOL_RECEIVE.
+ */
+#define IFX_T1PRIME_VIRTUAL_NACK                0x01u
+
+/**
+ * \brief Callback executing a command APDU on the virtual secure element.
+ *
+ * \param[in] context Context given to ifx_t1prime_virtual_set_apdu_handler().
+ * \param[in] apdu Received command APDU.
+ * \param[in] apdu_len Number of bytes in \p apdu.
+ * \param[out] response Buffer to store response APDU in (allocated with
+ * malloc(), freed by the virtual secure element).
+ * \param[out] response_len Buffer to store number of bytes in \p response in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other value makes the
+ * virtual secure element answer with status word 6F00.
+ */
+typedef ifx_status_t (*ifx_t1prime_virtual_apdu_handler_t)(
+    void *context, const uint8_t *apdu, size_t apdu_len, uint8_t **response,
+    size_t *response_len);
+
+/** \struct ifx_t1prime_virtual_timing_t
+ * \brief Latencies modelled by virtual secure element.
+ *
+ * \details All latencies are waited for using hsw-timer, so they take real
+ * time with a real timer implementation and none with a mock. In both cases
+ * they are added up in ifx_t1prime_virtual_statistics_t.time_us.
+ */
+typedef struct
+{
+    /**
+     * \brief Fixed cost of every bus transaction (read or write) in [us].
+     */
+    uint32_t transaction_us;
+
+    /**
+     * \brief Cost of every byte transferred on the bus in [ns].
+     */
+    uint32_t byte_ns;
+
+    /**
+     * \brief Time in [us] until any block is answered.
+     */
+    uint32_t turnaround_us;
+
+    /**
+     * \brief Additional time in [us] to execute a command APDU.
+     */
+    uint32_t processing_us;
+} ifx_t1prime_virtual_timing_t;
+
+/** \struct ifx_t1prime_virtual_faults_t
+ * \brief Faults to be injected by virtual secure element.
+ *
+ * \details Counters are decremented whenever the respective fault has been
+ * injected.
+ */
+typedef struct
+{
+    /**
+     * \brief Number of S(WTX request)s sent before the next response.
+     */
+    uint8_t wtx_requests;
+
+    /**
+     * \brief Multiplier of BWT requested by S(WTX request).
+     */
+    uint8_t wtx_multiplier;
+
+    /**
+     * \brief IFSC to be announced by S(IFS request) instead of accepting the
+     * next I block (\c 0 for none).
+     *
+     * \details Only the IFSC announced in CIP is enforced.
+     */
+    size_t ifs_request;
+
+    /**
+     * \brief Number of blocks sent with invalid CRC.
+     */
+    uint32_t crc_errors;
+
+    /**
+     * \brief Probability in [1/1000000] of any block to be sent with invalid
+     * CRC.
+     */
+    uint32_t crc_error_rate_ppm;
+
+    /**
+     * \brief Seed of pseudo random number generator used for \ref
+     * crc_error_rate_ppm (reproducible for same seed).
+     */
+    uint32_t seed;
+
+    /**
+     * \brief Number of received blocks silently ignored.
+     */
+    uint32_t mute_blocks;
+
+    /**
+     * \brief Number of reads answered as if no response is ready yet.
+     */
+    uint32_t busy_reads;
+} ifx_t1prime_virtual_faults_t;
+
+/** \struct ifx_t1prime_virtual_statistics_t
+ * \brief Traffic counted by virtual secure element.
+ */
+typedef struct
+{
+    /**
+     * \brief Number of bus transactions (reads and writes).
+     */
+    uint32_t transactions;
+
+    /**
+     * \brief Number of bytes written by host.
+     */
+    uint64_t bytes_written;
+
+    /**
+     * \brief Number of bytes read by host.
+     */
+    uint64_t bytes_read;
+
+    /**
+     * \brief Number of reads while no response was ready.
+     */
+    uint32_t busy_reads;
+
+    /**
+     * \brief Number of blocks received from host.
+     */
+    uint32_t blocks_received;
+
+    /**
+     * \brief Number of blocks sent to host (including retransmissions).
+     */
+    uint32_t blocks_sent;
+
+    /**
+     * \brief Number of blocks retransmitted on host's request.
+     */
+    uint32_t retransmissions;
+
+    /**
+     * \brief Number of blocks sent with invalid CRC.
+     */
+    uint32_t crc_errors;
+
+    /**
+     * \brief Number of executed command APDUs.
+     */
+    uint32_t apdus;
+
+    /**
+     * \brief Modelled time in [us] spent on bus and in secure element.
+     */
+    uint64_t time_us;
+} ifx_t1prime_virtual_statistics_t;
+
+/**
+ * \brief Initializes protocol stack as virtual T=1' secure element.
+ *
+ * \details Without further configuration the secure element echoes every
+ * command APDU followed by status word 9000, answers immediately and injects
+ * no faults.
+ *
+ * \code
+ *      ifx_protocol_t driver;
+ *      ifx_t1prime_virtual_initialize(&driver);
+ *      ifx_protocol_t protocol;
+ *      ifx_t1prime_initialize(&protocol, &driver);
+ *      ifx_protocol_activate(&protocol, NULL, NULL);
+ * \endcode
+ *
+ * \param[in] self Protocol stack to be initialized.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_virtual_initialize(ifx_protocol_t *self);
+
+/**
+ * \brief Sets callback executing command APDUs.
+ *
+ * \param[in] self Virtual secure element.
+ * \param[in] handler Callback executing command APDUs (\c NULL for echo).
+ * \param[in] context Context passed to \p handler.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_virtual_set_apdu_handler(
+    ifx_protocol_t *self, ifx_t1prime_virtual_apdu_handler_t handler,
+    void *context);
+
+/**
+ * \brief Sets data-link layer parameters announced in CIP.
+ *
+ * \details \p ifsd is the largest information field the secure element sends.
+ * Larger IFSD requested via S(IFS request) is answered with this value.
+ *
+ * \param[in] self Virtual secure element.
+ * \param[in] ifsc Maximum information field size of the secure element.
+ * \param[in] ifsd Maximum information field size sent by the secure element.
+ * \param[in] bwt_ms Block waiting time in [ms].
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_virtual_set_link_parameters(ifx_protocol_t *self,
+                                                     size_t ifsc, size_t ifsd,
+                                                     uint16_t bwt_ms);
+
+/**
+ * \brief Sets latencies modelled by virtual secure element.
+ *
+ * \param[in] self Virtual secure element.
+ * \param[in] timing Latencies to be modelled.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t
+ifx_t1prime_virtual_set_timing(ifx_protocol_t *self,
+                               const ifx_t1prime_virtual_timing_t *timing);
+
+/**
+ * \brief Sets faults to be injected by virtual secure element.
+ *
+ * \details Replaces all previously set faults (including those not yet
+ * injected).
+ *
+ * \param[in] self Virtual secure element.
+ * \param[in] faults Faults to be injected.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t
+ifx_t1prime_virtual_inject_faults(ifx_protocol_t *self,
+                                  const ifx_t1prime_virtual_faults_t *faults);
+
+/**
+ * \brief Returns traffic counted by virtual secure element.
+ *
+ * \param[in] self Virtual secure element.
+ * \param[out] statistics Buffer to store counters in.
+ * \param[in] reset Whether to reset counters afterwards.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t
+ifx_t1prime_virtual_get_statistics(ifx_protocol_t *self,
+                                   ifx_t1prime_virtual_statistics_t *statistics,
+                                   bool reset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IFX_T1PRIME_VIRTUAL_H
@@ -9,6 +9,7 @@
 #ifndef IFX_T1PRIME_H
 #define IFX_T1PRIME_H
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -79,19 +80,37 @@ extern "C" {
 /**
  * \brief Return code for successful calls to \ref ifx_t1prime_irq_handler_t.
  */
-#define IFX_T1PRIME_IRQ_TRIGGERED     IFX_SUCCESS
+#define IFX_T1PRIME_IRQ_TRIGGERED      IFX_SUCCESS
 
 /**
  * \brief IFX error encoding function identifier for \ref
  * ifx_t1prime_irq_handler_t.
  */
-#define IFX_T1PRIME_IRQ               0x09u
+#define IFX_T1PRIME_IRQ                0x09u
 
 /**
  * \brief Error reason if interrupt did not trigger in time during
  * ifx_t1prime_irq_handler_t.
  */
-#define IFX_T1PRIME_IRQ_NOT_TRIGGERED 0x01u
+#define IFX_T1PRIME_IRQ_NOT_TRIGGERED  0x01u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_transceive_into().
+ */
+#define IFX_T1PRIME_TRANSCEIVE_INTO    0x10u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_transceive_to_sink().
+ */
+#define IFX_T1PRIME_TRANSCEIVE_TO_SINK 0x2Au
+
+/**
+ * \brief Error reason if caller provided response buffer is too small in
+ * ifx_t1prime_transceive_into().
+ */
+#define IFX_T1PRIME_BUFFER_TOO_SMALL   0x01u
 
 /**
  * \brief Initializes Protocol object for Global Platform T=1' protocol.
@@ -120,6 +139,165 @@ ifx_status_t ifx_t1prime_initialize(ifx_protocol_t *self,
  */
 ifx_status_t ifx_t1prime_set_ifsd(ifx_protocol_t *self, size_t ifsd);
 
+/**
+ * \brief Returns maximum information field size of the host device (IFSD).
+ *
+ * \param[in] self T=1' protocol stack to get IFSD for.
+ * \param[out] ifsd_buffer Buffer to store IFSD value in (\c 0 if IFSD has not
+ * been negotiated and the secure element's default applies).
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_get_ifsd(ifx_protocol_t *self, size_t *ifsd_buffer);
+
+/**
+ * \brief Enables or disables max-throughput activation.
+ *
+ * \details If enabled, ifx_protocol_activate() negotiates the largest IFSD
+ * (up to 0xff9 bytes) the secure element accepts so that long responses are
+ * received in as few chained I blocks as possible. If the secure element
+ * rejects all proposed values its default IFSD is kept. Disabled by default.
+ *
+ * \param[in] self T=1' protocol stack to configure.
+ * \param[in] enable \c true to negotiate maximum IFSD during activation.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_set_max_throughput(ifx_protocol_t *self, bool enable);
+
+/**
+ * \brief Returns number of I blocks used for the last exchange.
+ *
+ * \details Can be used to check how many round trips a response took, e.g.
+ * before and after enabling ifx_t1prime_set_max_throughput().
+ *
+ * \param[in] self T=1' protocol stack to get block counts for.
+ * \param[out] request_blocks Buffer to store number of I blocks sent for last
+ * request in (might be \c NULL).
+ * \param[out] response_blocks Buffer to store number of I blocks received for
+ * last response in (might be \c NULL).
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_get_block_counts(ifx_protocol_t *self,
+                                          size_t *request_blocks,
+                                          size_t *response_blocks);
+
+/**
+ * \brief Enables or disables speculative single-transaction block receive.
+ *
+ * \details By default every block is read in two transactions: prologue first,
+ * then the remaining information field. If enabled, the expected information
+ * field is read together with the prologue. The expected size is the size of
+ * the previous block within a response chain or the hint given via
+ * ifx_t1prime_set_receive_hint(). If less data has been read than the block
+ * contains, the remainder is read in a second transaction; surplus data is
+ * discarded. Only supported for the I2C interface and disabled by default.
+ *
+ * \param[in] self T=1' protocol stack to configure.
+ * \param[in] enable \c true to enable speculative receive.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_set_speculative_receive(ifx_protocol_t *self,
+                                                 bool enable);
+
+/**
+ * \brief Sets expected information field size of next response.
+ *
+ * \details Per-command hint used by speculative receive (see
+ * ifx_t1prime_set_speculative_receive()). The hint is cleared once the last I
+ * block of the response has been received.
+ *
+ * \param[in] self T=1' protocol stack to configure.
+ * \param[in] information_size Expected number of bytes in information field of
+ * first response block (e.g. expected response APDU length).
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_set_receive_hint(ifx_protocol_t *self,
+                                          size_t information_size);
+
+/**
+ * \brief Strategies for scheduling polls while waiting for the secure
+ * element.
+ */
+typedef enum
+{
+    /**
+     * \brief Polls every minimum polling time (default).
+     */
+    IFX_T1PRIME_POLLING_FIXED = 0,
+
+    /**
+     * \brief Doubles the polling interval after every unsuccessful poll.
+     */
+    IFX_T1PRIME_POLLING_BACKOFF,
+
+    /**
+     * \brief Delays the first poll by the estimated response latency of the
+     * command's INS class and polls every minimum polling time afterwards.
+     */
+    IFX_T1PRIME_POLLING_ADAPTIVE
+} ifx_t1prime_polling_strategy_t;
+
+/**
+ * \brief Sets strategy used to schedule polls while waiting for the secure
+ * element.
+ *
+ * \details Applies to NACKed I2C writes and to polling for responses (unless
+ * an interrupt handler is set). Polls are never scheduled earlier than the
+ * minimum polling time. \ref IFX_T1PRIME_POLLING_ADAPTIVE keeps a moving
+ * estimate of the response latency per INS class (upper nibble of the second
+ * request byte), so short commands are polled shortly after being sent while
+ * long running ones do not keep the bus busy. Resets the counters returned by
+ * ifx_t1prime_get_polling_counters().
+ *
+ * \param[in] self T=1' protocol stack to configure.
+ * \param[in] strategy Polling strategy to be used.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t
+ifx_t1prime_set_polling_strategy(ifx_protocol_t *self,
+                                 ifx_t1prime_polling_strategy_t strategy);
+
+/**
+ * \brief Returns number of polls since the polling strategy has been set.
+ *
+ * \param[in] self T=1' protocol stack to get polling counters for.
+ * \param[out] polls Buffer to store total number of polls in (might be
+ * \c NULL).
+ * \param[out] wasted_polls Buffer to store number of polls that did not return
+ * any data in (might be \c NULL).
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_get_polling_counters(ifx_protocol_t *self,
+                                              size_t *polls,
+                                              size_t *wasted_polls);
+
 /**
  * \brief Returns current block waiting time (BWT) in [ms].
  *
@@ -191,6 +369,329 @@ ifx_status_t ifx_t1prime_set_irq_handler(ifx_protocol_t *self,
 ifx_status_t ifx_t1prime_get_irq_handler(ifx_protocol_t *self,
                                          ifx_t1prime_irq_handler_t *irq_buffer);
 
+/**
+ * \brief Sets context available to T=1' interrupt handler function.
+ *
+ * \details The interrupt handler only receives the protocol stack. State
+ * needed to wait for the interrupt (e.g. the GPIO to be watched) can be stored
+ * here and queried using ifx_t1prime_get_irq_context().
+ *
+ * \param[in] self T=1' protocol stack to set interrupt context for.
+ * \param[in] context Context of interrupt handler (\c NULL for none).
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_set_irq_context(ifx_protocol_t *self, void *context);
+
+/**
+ * \brief Getter for context of T=1' interrupt handler function.
+ *
+ * \param[in] self T=1' protocol stack to get interrupt context for.
+ * \param[out] context_buffer Buffer to store interrupt context in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_get_irq_context(ifx_protocol_t *self,
+                                         void **context_buffer);
+
+/**
+ * \brief Custom function type notified whenever the secure element is reset.
+ *
+ * \details Called before the secure element is (re)activated, reset via
+ * ifx_t1prime_s_swr() or ifx_t1prime_s_por() and when an exchange recovers
+ * via S(SWR), so that state kept by upper layers about the secure element
+ * (e.g. the selected application) can be dropped. Called with the lock of the
+ * protocol stack held, so it must not use the protocol stack.
+ *
+ * \param[in] context Custom context given to ifx_t1prime_set_reset_listener().
+ */
+typedef void (*ifx_t1prime_reset_listener_t)(void *context);
+
+/**
+ * \brief Sets listener notified whenever the secure element is reset.
+ *
+ * \param[in] self T=1' protocol stack to set reset listener for.
+ * \param[in] listener Listener to be notified (\c NULL for none).
+ * \param[in] context Custom context passed to \p listener.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_set_reset_listener(
+    ifx_protocol_t *self, ifx_t1prime_reset_listener_t listener, void *context);
+
+/**
+ * \brief Custom function type receiving response data block by block.
+ *
+ * \details Called by ifx_t1prime_transceive_to_sink() with the information
+ * field of every (non-empty) response I block in order. The data is only valid
+ * for the duration of the call.
+ *
+ * \param[in] context Custom context given to ifx_t1prime_transceive_to_sink().
+ * \param[in] data Information field of received I block.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other value in case
+ * of error (remaining blocks are still acknowledged but not passed on).
+ */
+typedef ifx_status_t (*ifx_t1prime_response_sink_t)(void *context,
+                                                    const uint8_t *data,
+                                                    size_t data_len);
+
+/**
+ * \brief Sends data via Global Platform T=1' protocol and reads back response
+ * into caller provided buffer.
+ *
+ * \details The information field of each response I block is copied straight
+ * to its final place in \p response without any intermediate reassembly
+ * buffer. If \p response is too small, the response chain is still read
+ * completely (but discarded) and the required buffer size is reported in
+ * \p response_len.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] data Data to be send via protocol.
+ * \param[in] data_len Number of bytes in \p data.
+ * \param[out] response Caller provided buffer to store response in.
+ * \param[in,out] response_len Number of bytes available in \p response as
+ * input, number of bytes in response as output.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, \c
+ * IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_INTO,
+ * IFX_T1PRIME_BUFFER_TOO_SMALL) if \p response is too small, any other value
+ * in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_transceive_into(ifx_protocol_t *self,
+                                         const uint8_t *data, size_t data_len,
+                                         uint8_t *response,
+                                         size_t *response_len);
+
+/**
+ * \brief Sends data via Global Platform T=1' protocol and passes response to
+ * sink block by block.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] data Data to be send via protocol.
+ * \param[in] data_len Number of bytes in \p data.
+ * \param[in] sink Sink called with information field of every response I
+ * block.
+ * \param[in] context Custom context passed to \p sink.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_transceive_to_sink(ifx_protocol_t *self,
+                                            const uint8_t *data,
+                                            size_t data_len,
+                                            ifx_t1prime_response_sink_t sink,
+                                            void *context);
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_transceive_begin().
+ */
+#define IFX_T1PRIME_TRANSCEIVE_BEGIN    0x18u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_transceive_poll().
+ */
+#define IFX_T1PRIME_TRANSCEIVE_POLL     0x19u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_transceive_complete().
+ */
+#define IFX_T1PRIME_TRANSCEIVE_COMPLETE 0x1Au
+
+/**
+ * \brief Error reason if exchange is still in progress in
+ * ifx_t1prime_transceive_poll().
+ *
+ * \details Used in combination with \ref LIB_T1PRIME and \ref
+ * IFX_T1PRIME_TRANSCEIVE_POLL so the full result code will always be \c
+ * IFX_ERROR(LIB_T1PRIME,IFX_T1PRIME_TRANSCEIVE_POLL,IFX_T1PRIME_PENDING).
+ */
+#define IFX_T1PRIME_PENDING             0x01u
+
+/** \struct ifx_t1prime_wait_t
+ * \brief Information when a pending exchange needs to be polled again.
+ *
+ * \details Filled by ifx_t1prime_transceive_poll() so that the exchange can be
+ * plugged into external event loops (e.g. as timer and interrupt line file
+ * descriptor).
+ */
+typedef struct
+{
+    /**
+     * \brief Time in [us] after which ifx_t1prime_transceive_poll() shall be
+     * called again.
+     */
+    uint32_t timeout_us;
+
+    /**
+     * \brief Whether the T=1' data interrupt signals that the exchange can
+     * continue earlier (only in IRQ mode while waiting for a response).
+     */
+    bool irq;
+} ifx_t1prime_wait_t;
+
+/**
+ * \brief Starts non-blocking exchange of data via Global Platform T=1'
+ * protocol.
+ *
+ * \details Same as ifx_protocol_transceive() but returns after the first
+ * block has been sent. The exchange is driven by ifx_t1prime_transceive_poll()
+ * and its result collected by ifx_t1prime_transceive_complete(). Only one
+ * exchange can be in progress per protocol stack, other operations on the
+ * stack fail until the exchange has been completed. One thread can drive many
+ * protocol stacks this way.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] data Data to be send via protocol (must stay valid until
+ * ifx_t1prime_transceive_complete() has been called).
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if exchange has been started, any other
+ * value in case of error (no exchange in progress).
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_transceive_begin(ifx_protocol_t *self,
+                                          const uint8_t *data, size_t data_len);
+
+/**
+ * \brief Drives non-blocking exchange started by
+ * ifx_t1prime_transceive_begin().
+ *
+ * \details Performs at most one bus transaction and only if its waiting time
+ * has passed, so this function never blocks and can be called at any time.
+ * In IRQ mode the interrupt handler is not called; instead the event loop
+ * watches the data interrupt as indicated by ifx_t1prime_wait_t.irq.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[out] wait Buffer to store when to call this function again in (might
+ * be \c NULL).
+ * \return ifx_status_t \c IFX_SUCCESS if exchange is done, \c
+ * IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_POLL, IFX_T1PRIME_PENDING) if
+ * it is still in progress, any other value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_transceive_poll(ifx_protocol_t *self,
+                                         ifx_t1prime_wait_t *wait);
+
+/**
+ * \brief Collects result of exchange started by
+ * ifx_t1prime_transceive_begin().
+ *
+ * \details Must only be called once ifx_t1prime_transceive_poll() returned
+ * \c IFX_SUCCESS. Afterwards a new exchange can be started.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[out] response Buffer to store response in (must be freed by caller).
+ * \param[out] response_len Buffer to store number of received bytes in.
+ * \return ifx_status_t Result of exchange (\c IFX_SUCCESS if successful).
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_transceive_complete(ifx_protocol_t *self,
+                                             uint8_t **response,
+                                             size_t *response_len);
+
+/**
+ * \brief Number of bytes in session parameters exported by
+ * ifx_t1prime_export_session().
+ */
+#define IFX_T1PRIME_SESSION_LEN           18u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_export_session().
+ */
+#define IFX_T1PRIME_EXPORT_SESSION        0x21u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_activate_from_session().
+ */
+#define IFX_T1PRIME_ACTIVATE_FROM_SESSION 0x22u
+
+/**
+ * \brief Error reason if protocol has not been activated yet in
+ * ifx_t1prime_export_session().
+ */
+#define IFX_T1PRIME_NO_SESSION            0x02u
+
+/**
+ * \brief Exports session parameters of last activation.
+ *
+ * \details The parameters are derived from the validated CIP (BWT, IFSC,
+ * minimum polling time, power wake-up time and physical layer timings) and
+ * encoded as versioned blob of \ref IFX_T1PRIME_SESSION_LEN bytes protected by
+ * a checksum. Passing the blob to ifx_t1prime_activate_from_session() on the
+ * next start skips reading and decoding the CIP. The blob is only meaningful
+ * for the same secure element.
+ *
+ * \param[in] self Protocol stack to export session parameters of.
+ * \param[out] buffer Buffer to store session parameters in.
+ * \param[in,out] buffer_len Number of bytes available in \p buffer as input,
+ * number of bytes in session parameters as output.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, \c
+ * IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_EXPORT_SESSION, IFX_T1PRIME_NO_SESSION)
+ * if the protocol has not been activated, any other value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_export_session(ifx_protocol_t *self, uint8_t *buffer,
+                                        size_t *buffer_len);
+
+/**
+ * \brief Activates protocol using session parameters exported by
+ * ifx_t1prime_export_session().
+ *
+ * \details Applies the stored parameters instead of reading the CIP and only
+ * resynchronizes with the secure element (negotiating IFSD if enabled via
+ * ifx_t1prime_set_max_throughput()). If the parameters are malformed, belong
+ * to another interface or the secure element does not answer S(RESYNCH), a
+ * full activation is performed instead.
+ *
+ * \code
+ *      uint8_t session[IFX_T1PRIME_SESSION_LEN];
+ *      size_t session_len = load_session(session, sizeof(session));
+ *      ifx_t1prime_activate_from_session(&protocol, session, session_len);
+ *      session_len = sizeof(session);
+ *      ifx_t1prime_export_session(&protocol, session, &session_len);
+ *      store_session(session, session_len);
+ * \endcode
+ *
+ * \param[in] self Protocol stack to be activated.
+ * \param[in] session Session parameters (might be \c NULL to force full
+ * activation).
+ * \param[in] session_len Number of bytes in \p session.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_activate_from_session(ifx_protocol_t *self,
+                                               const uint8_t *session,
+                                               size_t session_len);
+
 /**
  * \brief Performs Global Platform T=1' power on reset (POR).
  *
@@ -0,0 +1,354 @@
+// SPDX-FileCopyrightText: 2024 Infineon Technologies AG
+//
+// SPDX-License-Identifier: MIT
+
+/**
+ * \file ifx-t1prime-irq-fd.c
+ * \brief Global Platform T=1' interrupt handler waiting on a file descriptor.
+ *
+ * \details Time is measured with \c CLOCK_MONOTONIC directly (not hsw-timer),
+ * so timeouts and latencies are real even if a mock timer is linked. GPIO
+ * line events carry their own \c CLOCK_MONOTONIC timestamp, which is used to
+ * measure the wake-up latency after the interrupt edge.
+ */
+#define _POSIX_C_SOURCE 200112L
+
+#include "infineon/ifx-t1prime-irq-fd.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/gpio.h>
+#endif
+
+#include "infineon/ifx-t1prime.h"
+
+#ifdef GPIO_V2_LINES_MAX
+/**
+ * \brief Defined if GPIO line events of the version 2 GPIO character device ABI
+ * can be decoded to measure the wake-up latency.
+ */
+#define IFX_T1PRIME_IRQ_FD_GPIO_V2
+#endif
+
+/**
+ * \brief Maximum number of bytes consumed per triggered interrupt.
+ *
+ * \details Large enough for one eventfd counter and one GPIO line event of
+ * both versions of the GPIO character device ABI.
+ */
+#define IFX_T1PRIME_IRQ_FD_DRAIN_LEN 64u
+
+/**
+ * \brief Number of microseconds per second.
+ */
+#define IFX_T1PRIME_IRQ_FD_US_PER_S  1000000u
+
+/**
+ * \brief Number of microseconds per millisecond.
+ */
+#define IFX_T1PRIME_IRQ_FD_US_PER_MS 1000u
+
+/**
+ * \brief Reads current time of monotonic clock.
+ *
+ * \param[out] now_us Buffer to store current time in [us] in.
+ * \return bool \c true if successful.
+ */
+static bool ifx_t1prime_irq_fd_now(uint64_t *now_us)
+{
+    struct timespec now;
+    if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+    {
+        return false;
+    }
+    *now_us = ((uint64_t) now.tv_sec * IFX_T1PRIME_IRQ_FD_US_PER_S) +
+              ((uint64_t) now.tv_nsec / 1000U);
+    return true;
+}
+
+/**
+ * \brief Adds wait time of triggered wait to statistics.
+ *
+ * \param[in] statistics Statistics to be updated.
+ * \param[in] wait_us Time from start of wait until interrupt was consumed in
+ * [us].
+ */
+static void
+ifx_t1prime_irq_fd_count_wait(ifx_t1prime_irq_fd_statistics_t *statistics,
+                              uint64_t wait_us)
+{
+    uint32_t wait = (wait_us > UINT32_MAX) ? UINT32_MAX : (uint32_t) wait_us;
+    if ((statistics->triggered == 0U) || (wait < statistics->wait_min_us))
+    {
+        statistics->wait_min_us = wait;
+    }
+    if (wait > statistics->wait_max_us)
+    {
+        statistics->wait_max_us = wait;
+    }
+    statistics->wait_total_us += wait_us;
+    statistics->triggered++;
+}
+
+#ifdef IFX_T1PRIME_IRQ_FD_GPIO_V2
+/**
+ * \brief Adds wake-up latency of GPIO line event to statistics.
+ *
+ * \details Only line events of the version 2 GPIO character device ABI with
+ * a \c CLOCK_MONOTONIC timestamp (the default event clock) are counted.
+ *
+ * \param[in] statistics Statistics to be updated.
+ * \param[in] drain Data consumed from file descriptor.
+ * \param[in] drained Number of bytes in \p drain.
+ * \param[in] end_us Time the interrupt handler returns in [us].
+ */
+static void
+ifx_t1prime_irq_fd_count_latency(ifx_t1prime_irq_fd_statistics_t *statistics,
+                                 const uint8_t *drain, ssize_t drained,
+                                 uint64_t end_us)
+{
+    if (drained != (ssize_t) sizeof(struct gpio_v2_line_event))
+    {
+        return;
+    }
+    struct gpio_v2_line_event event;
+    memcpy(&event, drain, sizeof(event));
+    uint64_t edge_us = event.timestamp_ns / 1000U;
+
+    // Timestamps of other clocks cannot be compared
+    if ((edge_us == 0U) || (edge_us > end_us))
+    {
+        return;
+    }
+    uint64_t latency_us = end_us - edge_us;
+    uint32_t latency =
+        (latency_us > UINT32_MAX) ? UINT32_MAX : (uint32_t) latency_us;
+    if ((statistics->latencies == 0U) || (latency < statistics->latency_min_us))
+    {
+        statistics->latency_min_us = latency;
+    }
+    if (latency > statistics->latency_max_us)
+    {
+        statistics->latency_max_us = latency;
+    }
+    statistics->latency_total_us += latency_us;
+    statistics->latencies++;
+}
+#endif
+
+/**
+ * \brief Waits until file descriptor is readable.
+ *
+ * \param[in] fd File descriptor to be watched.
+ * \param[in] deadline_us Absolute time of monotonic clock in [us] until file
+ * descriptor has to have become readable.
+ * \return ifx_status_t \c IFX_T1PRIME_IRQ_TRIGGERED if readable, any other
+ * value on timeout or in case of error.
+ */
+static ifx_status_t ifx_t1prime_irq_fd_poll(int fd, uint64_t deadline_us)
+{
+    struct pollfd watched;
+    watched.fd = fd;
+    watched.events = POLLIN;
+    while (true)
+    {
+        uint64_t now_us;
+        if (!ifx_t1prime_irq_fd_now(&now_us))
+        {
+            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IRQ,
+                             IFX_UNSPECIFIED_ERROR);
+        }
+
+        // Round up so that poll() never returns before the deadline
+        uint64_t timeout_ms = 0U;
+        if (deadline_us > now_us)
+        {
+            timeout_ms = ((deadline_us - now_us) +
+                          (IFX_T1PRIME_IRQ_FD_US_PER_MS - 1U)) /
+                         IFX_T1PRIME_IRQ_FD_US_PER_MS;
+        }
+        if (timeout_ms > INT32_MAX)
+        {
+            timeout_ms = INT32_MAX;
+        }
+
+        watched.revents = 0;
+        int ready = poll(&watched, 1U, (int) timeout_ms);
+        if (ready > 0)
+        {
+            // Pending data is consumed even if writer has hung up
+            if ((watched.revents & POLLIN) != 0)
+            {
+                return IFX_T1PRIME_IRQ_TRIGGERED;
+            }
+            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IRQ,
+                             IFX_T1PRIME_IRQ_FD_HANGUP);
+        }
+        if (0 == ready)
+        {
+            if (timeout_ms == 0U)
+            {
+                return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IRQ,
+                                 IFX_T1PRIME_IRQ_NOT_TRIGGERED);
+            }
+            // Deadline may not have been reached if poll() was capped
+            continue;
+        }
+        if (errno != EINTR)
+        {
+            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IRQ,
+                             IFX_UNSPECIFIED_ERROR);
+        }
+    }
+}
+
+/**
+ * \brief Initializes file descriptor interrupt source.
+ *
+ * \param[out] irq File descriptor interrupt source to be initialized.
+ * \param[in] fd File descriptor becoming readable on data interrupt.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_irq_fd_initialize(ifx_t1prime_irq_fd_t *irq, int fd)
+{
+    if ((irq == NULL) || (fd < 0))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IRQ_FD_INITIALIZE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    irq->_fd = fd;
+    memset(&irq->_statistics, 0, sizeof(irq->_statistics));
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Enables IRQ mode waiting for the data interrupt on a file descriptor.
+ *
+ * \param[in] self T=1' protocol stack to enable IRQ mode for.
+ * \param[in] irq File descriptor interrupt source (\c NULL to switch back to
+ * polling mode).
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_set_irq_fd(ifx_protocol_t *self,
+                                    ifx_t1prime_irq_fd_t *irq)
+{
+    if (self == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_SET_IRQ_FD,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    // Set context first so that handler never runs without it
+    ifx_status_t status = ifx_t1prime_set_irq_context(self, irq);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    return ifx_t1prime_set_irq_handler(
+        self, (irq != NULL) ? ifx_t1prime_irq_fd_handler : NULL);
+}
+
+/**
+ * \brief \ref ifx_t1prime_irq_handler_t waiting on the file descriptor set
+ * via ifx_t1prime_set_irq_fd().
+ *
+ * \param[in] self T=1' protocol stack waiting for data interrupt.
+ * \param[in] timeout_us Timeout until interrupt has to have triggered (in
+ * [us]).
+ * \return ifx_status_t \c IFX_T1PRIME_IRQ_TRIGGERED if successful, \c
+ * IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IRQ, IFX_T1PRIME_IRQ_NOT_TRIGGERED) on
+ * timeout, any other value in case of error.
+ */
+ifx_status_t ifx_t1prime_irq_fd_handler(ifx_protocol_t *self,
+                                        uint32_t timeout_us)
+{
+    void *context = NULL;
+    ifx_status_t status = ifx_t1prime_get_irq_context(self, &context);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    if (context == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IRQ, IFX_ILLEGAL_ARGUMENT);
+    }
+    ifx_t1prime_irq_fd_t *irq = (ifx_t1prime_irq_fd_t *) context;
+    ifx_t1prime_irq_fd_statistics_t *statistics = &irq->_statistics;
+    statistics->waits++;
+
+    uint64_t start_us;
+    if (!ifx_t1prime_irq_fd_now(&start_us))
+    {
+        statistics->errors++;
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IRQ, IFX_UNSPECIFIED_ERROR);
+    }
+    status = ifx_t1prime_irq_fd_poll(irq->_fd, start_us + timeout_us);
+    switch (status)
+    {
+    case IFX_T1PRIME_IRQ_TRIGGERED:
+        break;
+    case IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IRQ, IFX_T1PRIME_IRQ_NOT_TRIGGERED):
+        statistics->timeouts++;
+        return status;
+    default:
+        statistics->errors++;
+        return status;
+    }
+
+    // Consume event so that it does not trigger the next wait again
+    uint8_t drain[IFX_T1PRIME_IRQ_FD_DRAIN_LEN];
+    ssize_t drained = read(irq->_fd, drain, sizeof(drain));
+    if ((drained < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK) &&
+        (errno != EINTR))
+    {
+        statistics->errors++;
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IRQ, IFX_UNSPECIFIED_ERROR);
+    }
+
+    uint64_t end_us;
+    if (!ifx_t1prime_irq_fd_now(&end_us))
+    {
+        end_us = start_us;
+    }
+    ifx_t1prime_irq_fd_count_wait(statistics, end_us - start_us);
+#ifdef IFX_T1PRIME_IRQ_FD_GPIO_V2
+    ifx_t1prime_irq_fd_count_latency(statistics, drain, drained, end_us);
+#endif
+    return IFX_T1PRIME_IRQ_TRIGGERED;
+}
+
+/**
+ * \brief Returns waits counted by file descriptor interrupt handler.
+ *
+ * \param[in] irq File descriptor interrupt source.
+ * \param[out] statistics Buffer to store counters in.
+ * \param[in] reset Whether to reset counters afterwards.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t
+ifx_t1prime_irq_fd_get_statistics(ifx_t1prime_irq_fd_t *irq,
+                                  ifx_t1prime_irq_fd_statistics_t *statistics,
+                                  bool reset)
+{
+    if ((irq == NULL) || (statistics == NULL))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IRQ_FD_GET_STATISTICS,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    *statistics = irq->_statistics;
+    if (reset)
+    {
+        memset(&irq->_statistics, 0, sizeof(irq->_statistics));
+    }
+    return IFX_SUCCESS;
+}
@@ -0,0 +1,1290 @@
+// SPDX-FileCopyrightText: 2024 Infineon Technologies AG
+//
+// SPDX-License-Identifier: MIT
+
+/**
+ * \file ifx-t1prime-virtual.c
+ * \brief Virtual Global Platform T=1' secure element.
+ */
+#include "infineon/ifx-t1prime-virtual.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "infineon/ifx-t1prime.h"
+#include "ifx-t1prime.h"
+#include "infineon/ifx-crc.h"
+#include "infineon/ifx-timer.h"
+
+/**
+ * \brief Protocol Layer ID for virtual Global Platform T=1' secure element.
+ *
+ * \details Used to verify that correct protocol layer has called member
+ * functionality.
+ */
+#define IFX_T1PRIME_VIRTUAL_PROTOCOL_LAYER_ID 0x02u
+
+/**
+ * \brief Node address byte (NAD) for transmission from secure element to host
+ * device.
+ */
+#define IFX_NAD_SE_TO_HD                      0x12u
+
+/**
+ * \brief Default information field sizes of virtual secure element.
+ */
+#define IFX_T1PRIME_VIRTUAL_DEFAULT_IFS       0xfeu
+
+/**
+ * \brief Byte sent by virtual secure element if it has nothing to send.
+ */
+#define IFX_T1PRIME_VIRTUAL_FILLER            0xffu
+
+/**
+ * \brief Size of buffer holding the block currently sent by virtual secure
+ * element.
+ */
+#define IFX_T1PRIME_VIRTUAL_FRAME_SIZE                                         \
+    (IFX_BLOCK_PROLOGUE_LEN + IFX_T1PRIME_MAX_IFS + IFX_BLOCK_EPILOGUE_LEN)
+
+/**
+ * \brief Answer of virtual secure element postponed by injected S(WTX
+ * request) or S(IFS request).
+ */
+typedef enum
+{
+    /**
+     * \brief No answer postponed.
+     */
+    IFX_T1PRIME_VIRTUAL_ANSWER_NONE = 0,
+
+    /**
+     * \brief R(ACK) for chained I block of host.
+     */
+    IFX_T1PRIME_VIRTUAL_ANSWER_ACK,
+
+    /**
+     * \brief R block requesting retransmission of rejected I block of host.
+     */
+    IFX_T1PRIME_VIRTUAL_ANSWER_RETRANSMIT,
+
+    /**
+     * \brief First I block of response APDU.
+     */
+    IFX_T1PRIME_VIRTUAL_ANSWER_RESPONSE
+} ifx_t1prime_virtual_answer_t;
+
+/**
+ * \brief State of virtual Global Platform T=1' secure element.
+ */
+typedef struct
+{
+    /**
+     * \brief Callback executing command APDUs (\c NULL for echo).
+     */
+    ifx_t1prime_virtual_apdu_handler_t apdu_handler;
+
+    /**
+     * \brief Context passed to apdu_handler.
+     */
+    void *apdu_handler_context;
+
+    /**
+     * \brief Configured maximum information field size of the secure element.
+     */
+    size_t default_ifsc;
+
+    /**
+     * \brief Configured maximum information field size sent by the secure
+     * element.
+     */
+    size_t max_ifsd;
+
+    /**
+     * \brief Current maximum information field size of the secure element.
+     */
+    size_t ifsc;
+
+    /**
+     * \brief Current maximum information field size sent by the secure
+     * element.
+     */
+    size_t ifsd;
+
+    /**
+     * \brief Block waiting time announced in CIP in [ms].
+     */
+    uint16_t bwt_ms;
+
+    /**
+     * \brief Modelled latencies.
+     */
+    ifx_t1prime_virtual_timing_t timing;
+
+    /**
+     * \brief Faults still to be injected.
+     */
+    ifx_t1prime_virtual_faults_t faults;
+
+    /**
+     * \brief State of pseudo random number generator for CRC errors.
+     */
+    uint32_t random;
+
+    /**
+     * \brief Counted traffic.
+     */
+    ifx_t1prime_virtual_statistics_t statistics;
+
+    /**
+     * \brief Expected send sequence counter of next I block from host.
+     */
+    uint8_t receive_counter;
+
+    /**
+     * \brief Send sequence counter of next I block to host.
+     */
+    uint8_t send_counter;
+
+    /**
+     * \brief Command APDU received so far.
+     */
+    uint8_t *command;
+
+    /**
+     * \brief Number of bytes in command.
+     */
+    size_t command_len;
+
+    /**
+     * \brief Number of bytes allocated for command.
+     */
+    size_t command_size;
+
+    /**
+     * \brief Response APDU being sent.
+     */
+    uint8_t *response;
+
+    /**
+     * \brief Number of bytes in response.
+     */
+    size_t response_len;
+
+    /**
+     * \brief Offset of information field of current I block in response.
+     */
+    size_t response_offset;
+
+    /**
+     * \brief Number of response bytes in current I block.
+     */
+    size_t chunk_len;
+
+    /**
+     * \brief Whether current I block is chained and waits for R(ACK).
+     */
+    bool response_more;
+
+    /**
+     * \brief Answer postponed by injected S(WTX request) or S(IFS request).
+     */
+    ifx_t1prime_virtual_answer_t deferred;
+
+    /**
+     * \brief Block currently sent (kept for retransmissions).
+     */
+    uint8_t frame[IFX_T1PRIME_VIRTUAL_FRAME_SIZE];
+
+    /**
+     * \brief Number of bytes in frame.
+     */
+    size_t frame_len;
+
+    /**
+     * \brief Number of bytes of frame already read by host.
+     */
+    size_t frame_offset;
+
+    /**
+     * \brief Whether frame is waiting to be read by host.
+     */
+    bool frame_pending;
+
+    /**
+     * \brief Whether CRC of current transmission of frame is corrupted.
+     */
+    bool frame_corrupt;
+
+    /**
+     * \brief Timer until frame is ready to be read.
+     */
+    ifx_timer_t ready;
+
+    /**
+     * \brief Whether ready timer has been set.
+     */
+    bool ready_set;
+} ifx_t1prime_virtual_state_t;
+
+/**
+ * \brief Returns state of virtual secure element.
+ *
+ * \param[in] self Virtual secure element.
+ * \param[in] function IFX error encoding function identifier of caller.
+ * \param[out] state Buffer to store state in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t
+ifx_t1prime_virtual_get_state(const ifx_protocol_t *self, uint8_t function,
+                              ifx_t1prime_virtual_state_t **state)
+{
+    if ((self == NULL) ||
+        (self->_layer_id != IFX_T1PRIME_VIRTUAL_PROTOCOL_LAYER_ID) ||
+        (self->_properties == NULL))
+    {
+        return IFX_ERROR(LIB_T1PRIME, function, IFX_ILLEGAL_ARGUMENT);
+    }
+    *state = (ifx_t1prime_virtual_state_t *) self->_properties;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Spends modelled time.
+ *
+ * \param[in] state Virtual secure element.
+ * \param[in] time_us Time to be spent in [us].
+ */
+static void ifx_t1prime_virtual_spend(ifx_t1prime_virtual_state_t *state,
+                                      uint64_t time_us)
+{
+    if (time_us == 0U)
+    {
+        return;
+    }
+    state->statistics.time_us += time_us;
+    ifx_timer_t timer;
+    if (ifx_timer_set(&timer, time_us) == IFX_SUCCESS)
+    {
+        ifx_timer_join(&timer);
+        ifx_timer_destroy(&timer);
+    }
+}
+
+/**
+ * \brief Models bus transaction.
+ *
+ * \param[in] state Virtual secure element.
+ * \param[in] data_len Number of bytes transferred.
+ */
+static void ifx_t1prime_virtual_bus(ifx_t1prime_virtual_state_t *state,
+                                    size_t data_len)
+{
+    state->statistics.transactions++;
+    ifx_t1prime_virtual_spend(
+        state, state->timing.transaction_us +
+                   (((uint64_t) data_len * state->timing.byte_ns) / 1000U));
+}
+
+/**
+ * \brief Decides if next transmission shall have an invalid CRC.
+ *
+ * \param[in] state Virtual secure element.
+ * \return bool \c true if CRC shall be corrupted.
+ */
+static bool ifx_t1prime_virtual_crc_fault(ifx_t1prime_virtual_state_t *state)
+{
+    if (state->faults.crc_errors > 0U)
+    {
+        state->faults.crc_errors--;
+        return true;
+    }
+    if (state->faults.crc_error_rate_ppm == 0U)
+    {
+        return false;
+    }
+
+    // xorshift32
+    state->random ^= state->random << 13;
+    state->random ^= state->random >> 17;
+    state->random ^= state->random << 5;
+    return (state->random % 1000000U) < state->faults.crc_error_rate_ppm;
+}
+
+/**
+ * \brief (Re)starts transmission of current frame.
+ *
+ * \param[in] state Virtual secure element.
+ * \param[in] delay_us Time until frame is ready in [us].
+ */
+static void ifx_t1prime_virtual_queue(ifx_t1prime_virtual_state_t *state,
+                                      uint32_t delay_us)
+{
+    state->frame_offset = 0U;
+    state->frame_pending = true;
+    state->frame_corrupt = ifx_t1prime_virtual_crc_fault(state);
+    state->statistics.blocks_sent++;
+    if (state->frame_corrupt)
+    {
+        state->statistics.crc_errors++;
+    }
+
+    // Secure element is busy until frame is ready
+    state->statistics.time_us += delay_us;
+    if (state->ready_set)
+    {
+        ifx_timer_destroy(&state->ready);
+    }
+    state->ready_set =
+        ifx_timer_set(&state->ready, (uint64_t) delay_us) == IFX_SUCCESS;
+}
+
+/**
+ * \brief Sends block to host.
+ *
+ * \param[in] state Virtual secure element.
+ * \param[in] pcb Protocol control byte of block.
+ * \param[in] information Information field of block.
+ * \param[in] information_size Number of bytes in \p information.
+ * \param[in] delay_us Time until block is ready in [us].
+ */
+static void ifx_t1prime_virtual_send(ifx_t1prime_virtual_state_t *state,
+                                     uint8_t pcb, uint8_t *information,
+                                     size_t information_size, uint32_t delay_us)
+{
+    ifx_t1prime_block_t block;
+    block.nad = IFX_NAD_SE_TO_HD;
+    block.pcb = pcb;
+    block.information = information;
+    block.information_size = information_size;
+    if (ifx_t1prime_block_encode_into(&block, state->frame, sizeof(state->frame),
+                                      &state->frame_len) != IFX_SUCCESS)
+    {
+        state->frame_pending = false;
+        return;
+    }
+    ifx_t1prime_virtual_queue(state, delay_us);
+}
+
+/**
+ * \brief Sends R block to host.
+ *
+ * \param[in] state Virtual secure element.
+ * \param[in] type Type of R block (\c 0x00 for acknowledgement).
+ */
+static void ifx_t1prime_virtual_send_r(ifx_t1prime_virtual_state_t *state,
+                                       uint8_t type)
+{
+    ifx_t1prime_virtual_send(state,
+                             IFX_T1PRIME_PCB_R(state->receive_counter, type),
+                             NULL, 0U, state->timing.turnaround_us);
+}
+
+/**
+ * \brief Sends current frame again on host's request.
+ *
+ * \param[in] state Virtual secure element.
+ */
+static void ifx_t1prime_virtual_retransmit(ifx_t1prime_virtual_state_t *state)
+{
+    if (state->frame_len == 0U)
+    {
+        ifx_t1prime_virtual_send_r(state, 0x02U);
+        return;
+    }
+    state->statistics.retransmissions++;
+    ifx_t1prime_virtual_queue(state, state->timing.turnaround_us);
+}
+
+/**
+ * \brief Sends I block with next part of response APDU.
+ *
+ * \param[in] state Virtual secure element.
+ * \param[in] delay_us Time until block is ready in [us].
+ */
+static void
+ifx_t1prime_virtual_send_response(ifx_t1prime_virtual_state_t *state,
+                                  uint32_t delay_us)
+{
+    size_t remaining = state->response_len - state->response_offset;
+    state->chunk_len = (remaining > state->ifsd) ? state->ifsd : remaining;
+    state->response_more = state->chunk_len < remaining;
+    uint8_t pcb = IFX_T1PRIME_PCB_I(state->send_counter, state->response_more);
+    state->send_counter ^= 1U;
+    ifx_t1prime_virtual_send(
+        state, pcb,
+        (state->response == NULL) ? NULL
+                                  : state->response + state->response_offset,
+        state->chunk_len, delay_us);
+}
+
+/**
+ * \brief Encodes information field size.
+ *
+ * \param[in] ifs Information field size to be encoded.
+ * \param[out] buffer Buffer to store encoded value in (at least 2 bytes).
+ * \return size_t Number of bytes written to \p buffer.
+ */
+static size_t ifx_t1prime_virtual_ifs_encode(size_t ifs, uint8_t *buffer)
+{
+    if (ifs <= 0xfeU)
+    {
+        buffer[0] = ifs & 0xffU;
+        return 1U;
+    }
+    buffer[0] = (ifs & 0x0f00U) >> 8;
+    buffer[1] = ifs & 0x00ffU;
+    return 2U;
+}
+
+/**
+ * \brief Answers block of host, optionally preceded by S(WTX request).
+ *
+ * \param[in] state Virtual secure element.
+ * \param[in] answer Answer to be sent.
+ */
+static void ifx_t1prime_virtual_answer(ifx_t1prime_virtual_state_t *state,
+                                       ifx_t1prime_virtual_answer_t answer)
+{
+    // Request more time before response
+    if ((answer == IFX_T1PRIME_VIRTUAL_ANSWER_RESPONSE) &&
+        (state->faults.wtx_requests > 0U))
+    {
+        state->faults.wtx_requests--;
+        state->deferred = answer;
+        ifx_t1prime_virtual_send(state, IFX_T1PRIME_PCB_S_WTX_REQ,
+                                 &state->faults.wtx_multiplier, 1U,
+                                 state->timing.turnaround_us);
+        return;
+    }
+
+    state->deferred = IFX_T1PRIME_VIRTUAL_ANSWER_NONE;
+    if (answer != IFX_T1PRIME_VIRTUAL_ANSWER_RESPONSE)
+    {
+        ifx_t1prime_virtual_send_r(state, 0x00U);
+    }
+    else
+    {
+        ifx_t1prime_virtual_send_response(state, state->timing.turnaround_us +
+                                                     state->timing.processing_us);
+    }
+}
+
+/**
+ * \brief Default APDU handler echoing command followed by status word 9000.
+ *
+ * \see ifx_t1prime_virtual_apdu_handler_t
+ */
+static ifx_status_t ifx_t1prime_virtual_echo(void *context, const uint8_t *apdu,
+                                             size_t apdu_len,
+                                             uint8_t **response,
+                                             size_t *response_len)
+{
+    // Ignore unused parameter
+    (void) context;
+
+    *response = (uint8_t *) malloc(apdu_len + 2U);
+    if (*response == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSMIT,
+                         IFX_OUT_OF_MEMORY);
+    }
+    if (apdu_len > 0U)
+    {
+        // clang-format off
+        memcpy(*response, apdu, apdu_len); // Flawfinder: ignore
+        // clang-format on
+    }
+    (*response)[apdu_len] = 0x90U;
+    (*response)[apdu_len + 1U] = 0x00U;
+    *response_len = apdu_len + 2U;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Executes received command APDU and prepares response.
+ *
+ * \param[in] state Virtual secure element.
+ */
+static void ifx_t1prime_virtual_execute(ifx_t1prime_virtual_state_t *state)
+{
+    if (state->response != NULL)
+    {
+        free(state->response);
+        state->response = NULL;
+    }
+    state->response_len = 0U;
+    state->response_offset = 0U;
+
+    uint8_t *response = NULL;
+    size_t response_len = 0U;
+    ifx_status_t status;
+    if (state->apdu_handler != NULL)
+    {
+        status =
+            state->apdu_handler(state->apdu_handler_context, state->command,
+                                state->command_len, &response, &response_len);
+    }
+    else
+    {
+        status = ifx_t1prime_virtual_echo(NULL, state->command,
+                                          state->command_len, &response,
+                                          &response_len);
+    }
+    state->command_len = 0U;
+    state->statistics.apdus++;
+
+    // Answer with "no precise diagnosis" if command failed
+    if (status != IFX_SUCCESS)
+    {
+        if (response != NULL)
+        {
+            free(response);
+        }
+        response_len = 0U;
+        response = (uint8_t *) malloc(2U);
+        if (response != NULL)
+        {
+            response[0] = 0x6fU;
+            response[1] = 0x00U;
+            response_len = 2U;
+        }
+    }
+    state->response = response;
+    state->response_len = response_len;
+}
+
+/**
+ * \brief Resets data-link layer state (RESYNCH, SWR, POR).
+ *
+ * \param[in] state Virtual secure element.
+ */
+static void ifx_t1prime_virtual_reset(ifx_t1prime_virtual_state_t *state)
+{
+    state->receive_counter = 0U;
+    state->send_counter = 0U;
+    state->command_len = 0U;
+    if (state->response != NULL)
+    {
+        free(state->response);
+        state->response = NULL;
+    }
+    state->response_len = 0U;
+    state->response_offset = 0U;
+    state->chunk_len = 0U;
+    state->response_more = false;
+    state->deferred = IFX_T1PRIME_VIRTUAL_ANSWER_NONE;
+    state->ifsc = state->default_ifsc;
+    state->ifsd = state->max_ifsd;
+    state->frame_pending = false;
+}
+
+/**
+ * \brief Handles I block received from host.
+ *
+ * \param[in] state Virtual secure element.
+ * \param[in] pcb Protocol control byte of block.
+ * \param[in] information Information field of block.
+ * \param[in] information_size Number of bytes in \p information.
+ */
+static void ifx_t1prime_virtual_handle_i(ifx_t1prime_virtual_state_t *state,
+                                         uint8_t pcb,
+                                         const uint8_t *information,
+                                         size_t information_size)
+{
+    if (information_size > state->default_ifsc)
+    {
+        ifx_t1prime_virtual_send_r(state, 0x02U);
+        return;
+    }
+
+    // Repeated block means that answer got lost
+    if (IFX_T1PRIME_PCB_I_GET_NS(pcb) != state->receive_counter)
+    {
+        ifx_t1prime_virtual_retransmit(state);
+        return;
+    }
+
+    // New block implicitly acknowledges previous response
+    state->response_more = false;
+    state->deferred = IFX_T1PRIME_VIRTUAL_ANSWER_NONE;
+
+    // Reject block and announce new IFSC so that host sends it again
+    if (state->faults.ifs_request != 0U)
+    {
+        uint8_t ifs[2];
+        size_t ifs_len =
+            ifx_t1prime_virtual_ifs_encode(state->faults.ifs_request, ifs);
+        state->ifsc = state->faults.ifs_request;
+        state->faults.ifs_request = 0U;
+        state->deferred = IFX_T1PRIME_VIRTUAL_ANSWER_RETRANSMIT;
+        ifx_t1prime_virtual_send(state, IFX_T1PRIME_PCB_S_IFS_REQ, ifs, ifs_len,
+                                 state->timing.turnaround_us);
+        return;
+    }
+
+    // Collect command APDU
+    if ((state->command_len + information_size) > state->command_size)
+    {
+        size_t size = (state->command_size == 0U) ? state->default_ifsc
+                                                   : state->command_size;
+        while (size < (state->command_len + information_size))
+        {
+            size *= 2U;
+        }
+        uint8_t *command = (uint8_t *) realloc(state->command, size);
+        if (command == NULL)
+        {
+            ifx_t1prime_virtual_send_r(state, 0x02U);
+            return;
+        }
+        state->command = command;
+        state->command_size = size;
+    }
+    if (information_size > 0U)
+    {
+        // clang-format off
+        memcpy(state->command + state->command_len, information, information_size); // Flawfinder: ignore
+        // clang-format on
+        state->command_len += information_size;
+    }
+    state->receive_counter ^= 1U;
+
+    if (IFX_T1PRIME_PCB_I_HAS_MORE(pcb))
+    {
+        ifx_t1prime_virtual_answer(state, IFX_T1PRIME_VIRTUAL_ANSWER_ACK);
+    }
+    else
+    {
+        ifx_t1prime_virtual_execute(state);
+        ifx_t1prime_virtual_answer(state, IFX_T1PRIME_VIRTUAL_ANSWER_RESPONSE);
+    }
+}
+
+/**
+ * \brief Handles R block received from host.
+ *
+ * \param[in] state Virtual secure element.
+ * \param[in] pcb Protocol control byte of block.
+ */
+static void ifx_t1prime_virtual_handle_r(ifx_t1prime_virtual_state_t *state,
+                                         uint8_t pcb)
+{
+    // Acknowledgement of chained response block requests next one
+    if (state->response_more && ((pcb & 0x0fU) == 0x00U) &&
+        (IFX_T1PRIME_PCB_R_GET_NR(pcb) == state->send_counter))
+    {
+        state->response_offset += state->chunk_len;
+        ifx_t1prime_virtual_send_response(state, state->timing.turnaround_us);
+        return;
+    }
+
+    // Last I block of host got lost
+    if ((state->frame_len == 0U) ||
+        (IFX_T1PRIME_PCB_IS_I(state->frame[1]) &&
+         (IFX_T1PRIME_PCB_R_GET_NR(pcb) !=
+          IFX_T1PRIME_PCB_I_GET_NS(state->frame[1]))))
+    {
+        ifx_t1prime_virtual_send_r(state, 0x00U);
+        return;
+    }
+
+    // Anything else requests retransmission
+    ifx_t1prime_virtual_retransmit(state);
+}
+
+/**
+ * \brief Encodes communication interface parameters (CIP).
+ *
+ * \param[in] state Virtual secure element.
+ * \param[out] buffer Buffer to store encoded CIP in (at least 32 bytes).
+ * \return size_t Number of bytes written to \p buffer.
+ */
+static size_t ifx_t1prime_virtual_cip_encode(ifx_t1prime_virtual_state_t *state,
+                                             uint8_t *buffer)
+{
+    size_t offset = 0U;
+
+    // Version and issuer identification number
+    buffer[offset++] = 0x01U;
+    buffer[offset++] = 3U;
+    buffer[offset++] = 0x00U;
+    buffer[offset++] = 0x00U;
+    buffer[offset++] = 0x00U;
+
+    // Physical layer parameters
+#ifdef IFX_T1PRIME_INTERFACE_I2C
+    uint16_t mcf = IFX_T1PRIME_DEFAULT_I2C_CLOCK_FREQUENCY_HZ / 1000U;
+    buffer[offset++] = IFX_T1PRIME_PLID_I2C;
+    buffer[offset++] = 1U + 1U + 2U + 1U + 1U + 2U;
+    buffer[offset++] = 0x00U;
+    buffer[offset++] = IFX_T1PRIME_DEFAULT_PWT_MS;
+    buffer[offset++] = (mcf & 0xff00U) >> 8;
+    buffer[offset++] = mcf & 0x00ffU;
+    buffer[offset++] = 0x00U;
+    buffer[offset++] = IFX_T1PRIME_DEFAULT_I2C_MPOT_100US;
+    buffer[offset++] = (IFX_T1PRIME_DEFAULT_I2C_RWGT_US & 0xff00U) >> 8;
+    buffer[offset++] = IFX_T1PRIME_DEFAULT_I2C_RWGT_US & 0x00ffU;
+#else
+    uint16_t mcf = IFX_T1PRIME_DEFAULT_SPI_CLOCK_FREQUENCY_HZ / 1000U;
+    buffer[offset++] = IFX_T1PRIME_PLID_SPI;
+    buffer[offset++] = 1U + 1U + 2U + 1U + 1U + 2U + 2U + 2U;
+    buffer[offset++] = 0x00U;
+    buffer[offset++] = IFX_T1PRIME_DEFAULT_PWT_MS;
+    buffer[offset++] = (mcf & 0xff00U) >> 8;
+    buffer[offset++] = mcf & 0x00ffU;
+    buffer[offset++] = 0x00U;
+    buffer[offset++] = IFX_T1PRIME_DEFAULT_SPI_MPOT_100US;
+    buffer[offset++] = (IFX_T1PRIME_DEFAULT_SPI_SEGT_US & 0xff00U) >> 8;
+    buffer[offset++] = IFX_T1PRIME_DEFAULT_SPI_SEGT_US & 0x00ffU;
+    buffer[offset++] = (IFX_T1PRIME_DEFAULT_SPI_SEAL & 0xff00U) >> 8;
+    buffer[offset++] = IFX_T1PRIME_DEFAULT_SPI_SEAL & 0x00ffU;
+    buffer[offset++] = 0x00U;
+    buffer[offset++] = 0x00U;
+#endif
+
+    // Data-link layer parameters
+    buffer[offset++] = 2U + 2U;
+    buffer[offset++] = (state->bwt_ms & 0xff00U) >> 8;
+    buffer[offset++] = state->bwt_ms & 0x00ffU;
+    buffer[offset++] = (state->ifsc & 0xff00U) >> 8;
+    buffer[offset++] = state->ifsc & 0x00ffU;
+
+    // No historical bytes
+    buffer[offset++] = 0U;
+    return offset;
+}
+
+/**
+ * \brief Handles S(IFS request) received from host.
+ *
+ * \param[in] state Virtual secure element.
+ * \param[in] information Information field of block.
+ * \param[in] information_size Number of bytes in \p information.
+ */
+static void ifx_t1prime_virtual_handle_ifs(ifx_t1prime_virtual_state_t *state,
+                                           const uint8_t *information,
+                                           size_t information_size)
+{
+    size_t ifs;
+    if ((ifx_t1prime_ifs_decode(&ifs, information, information_size) !=
+         IFX_SUCCESS) ||
+        (ifs == 0U) || (ifs > IFX_T1PRIME_MAX_IFS))
+    {
+        ifx_t1prime_virtual_send_r(state, 0x02U);
+        return;
+    }
+
+    // Counter propose largest supported IFSD
+    if (ifs > state->max_ifsd)
+    {
+        ifs = state->max_ifsd;
+    }
+    else
+    {
+        state->ifsd = ifs;
+    }
+    uint8_t encoded[2];
+    size_t encoded_len = ifx_t1prime_virtual_ifs_encode(ifs, encoded);
+    ifx_t1prime_virtual_send(state, IFX_T1PRIME_PCB_S_IFS_RESP, encoded,
+                             encoded_len, state->timing.turnaround_us);
+}
+
+/**
+ * \brief Handles S block received from host.
+ *
+ * \param[in] state Virtual secure element.
+ * \param[in] pcb Protocol control byte of block.
+ * \param[in] information Information field of block.
+ * \param[in] information_size Number of bytes in \p information.
+ */
+static void ifx_t1prime_virtual_handle_s(ifx_t1prime_virtual_state_t *state,
+                                         uint8_t pcb,
+                                         const uint8_t *information,
+                                         size_t information_size)
+{
+    uint8_t encoded[32];
+    size_t encoded_len;
+    uint32_t delay_us = state->timing.turnaround_us;
+    switch (pcb)
+    {
+    case IFX_T1PRIME_PCB_S_RESYNCH_REQ:
+        ifx_t1prime_virtual_reset(state);
+        ifx_t1prime_virtual_send(state, IFX_T1PRIME_PCB_S_RESYNCH_RESP, NULL,
+                                 0U, delay_us);
+        break;
+    case IFX_T1PRIME_PCB_S_IFS_REQ:
+        ifx_t1prime_virtual_handle_ifs(state, information, information_size);
+        break;
+    case IFX_T1PRIME_PCB_S_ABORT_REQ:
+        state->command_len = 0U;
+        state->response_more = false;
+        state->deferred = IFX_T1PRIME_VIRTUAL_ANSWER_NONE;
+        ifx_t1prime_virtual_send(state, IFX_T1PRIME_PCB_S_ABORT_RESP, NULL, 0U,
+                                 delay_us);
+        break;
+    case IFX_T1PRIME_PCB_S_CIP_REQ:
+        encoded_len = ifx_t1prime_virtual_cip_encode(state, encoded);
+        ifx_t1prime_virtual_send(state, IFX_T1PRIME_PCB_S_CIP_RESP, encoded,
+                                 encoded_len, delay_us);
+        break;
+    case IFX_T1PRIME_PCB_S_RELEASE_REQ:
+        ifx_t1prime_virtual_send(state, IFX_T1PRIME_PCB_S_RELEASE_RESP, NULL,
+                                 0U, delay_us);
+        break;
+    case IFX_T1PRIME_PCB_S_SWR_REQ:
+        ifx_t1prime_virtual_reset(state);
+        ifx_t1prime_virtual_send(state, IFX_T1PRIME_PCB_S_SWR_RESP, NULL, 0U,
+                                 delay_us);
+        break;
+    case IFX_T1PRIME_PCB_S_POR_REQ:
+        // Power on reset is not answered
+        ifx_t1prime_virtual_reset(state);
+        break;
+    case IFX_T1PRIME_PCB_S_WTX_RESP:
+    case IFX_T1PRIME_PCB_S_IFS_RESP:
+        // Continue with answer postponed by injected request
+        if (state->deferred != IFX_T1PRIME_VIRTUAL_ANSWER_NONE)
+        {
+            ifx_t1prime_virtual_answer(state, state->deferred);
+        }
+        else
+        {
+            ifx_t1prime_virtual_send_r(state, 0x02U);
+        }
+        break;
+    default:
+        ifx_t1prime_virtual_send_r(state, 0x02U);
+        break;
+    }
+}
+
+/**
+ * \brief ifx_protocol_transmit_callback_t for virtual Global Platform T=1'
+ * secure element.
+ *
+ * \details Receives one complete block from the host and prepares the answer.
+ *
+ * \see ifx_protocol_transmit_callback_t
+ */
+static ifx_status_t ifx_t1prime_virtual_transmit(ifx_protocol_t *self,
+                                                 const uint8_t *data,
+                                                 size_t data_len)
+{
+    ifx_t1prime_virtual_state_t *state;
+    ifx_status_t status =
+        ifx_t1prime_virtual_get_state(self, IFX_PROTOCOL_TRANSMIT, &state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    if ((data == NULL) && (data_len > 0U))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSMIT,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    ifx_t1prime_virtual_bus(state, data_len);
+    state->statistics.bytes_written += data_len;
+
+    // Any new block from host aborts reading of previous answer
+    state->frame_pending = false;
+
+    // Ignore data not addressed to secure element
+    if ((data_len < (IFX_BLOCK_PROLOGUE_LEN + IFX_BLOCK_EPILOGUE_LEN)) ||
+        (data[0] != IFX_NAD_HD_TO_SE))
+    {
+        return IFX_SUCCESS;
+    }
+    state->statistics.blocks_received++;
+    if (state->faults.mute_blocks > 0U)
+    {
+        state->faults.mute_blocks--;
+        return IFX_SUCCESS;
+    }
+
+    // Validate prologue and epilogue
+    uint8_t pcb = data[1];
+    size_t information_size = (data[2] << 8) | data[3];
+    if (data_len !=
+        (IFX_BLOCK_PROLOGUE_LEN + information_size + IFX_BLOCK_EPILOGUE_LEN))
+    {
+        ifx_t1prime_virtual_send_r(state, 0x02U);
+        return IFX_SUCCESS;
+    }
+    uint16_t crc = ifx_crc16_ccitt_x25(data, data_len - 2U);
+    if ((data[data_len - 2U] != ((crc & 0xff00U) >> 8)) ||
+        (data[data_len - 1U] != (crc & 0x00ffU)))
+    {
+        ifx_t1prime_virtual_send_r(state, 0x01U);
+        return IFX_SUCCESS;
+    }
+
+    const uint8_t *information = data + IFX_BLOCK_PROLOGUE_LEN;
+    if (IFX_T1PRIME_PCB_IS_I(pcb))
+    {
+        ifx_t1prime_virtual_handle_i(state, pcb, information, information_size);
+    }
+    else if (IFX_T1PRIME_PCB_IS_R(pcb))
+    {
+        ifx_t1prime_virtual_handle_r(state, pcb);
+    }
+    else
+    {
+        ifx_t1prime_virtual_handle_s(state, pcb, information,
+                                     information_size);
+    }
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Checks if host can read (further) bytes of current frame.
+ *
+ * \param[in] state Virtual secure element.
+ * \return bool \c true if frame is ready.
+ */
+static bool ifx_t1prime_virtual_ready(ifx_t1prime_virtual_state_t *state)
+{
+    if (state->frame_pending)
+    {
+        // Frame already started
+        if (state->frame_offset > 0U)
+        {
+            return true;
+        }
+        if (state->faults.busy_reads > 0U)
+        {
+            state->faults.busy_reads--;
+        }
+        else if (!state->ready_set || ifx_timer_has_elapsed(&state->ready))
+        {
+            return true;
+        }
+    }
+    state->statistics.busy_reads++;
+    return false;
+}
+
+/**
+ * \brief Returns next byte of current frame.
+ *
+ * \param[in] state Virtual secure element.
+ * \return uint8_t Next byte of frame.
+ */
+static uint8_t ifx_t1prime_virtual_frame_byte(ifx_t1prime_virtual_state_t *state)
+{
+    uint8_t value = state->frame[state->frame_offset++];
+    if (state->frame_offset == state->frame_len)
+    {
+        if (state->frame_corrupt)
+        {
+            value ^= 0xffU;
+        }
+        state->frame_pending = false;
+    }
+    return value;
+}
+
+/**
+ * \brief ifx_protocol_receive_callback_t for virtual Global Platform T=1'
+ * secure element.
+ *
+ * \details I2C reads are not acknowledged until an answer is ready, SPI reads
+ * return filler bytes instead. Once started, each read continues the current
+ * frame.
+ *
+ * \see ifx_protocol_receive_callback_t
+ */
+static ifx_status_t ifx_t1prime_virtual_receive(ifx_protocol_t *self,
+                                                size_t expected_len,
+                                                uint8_t **response,
+                                                size_t *response_len)
+{
+    ifx_t1prime_virtual_state_t *state;
+    ifx_status_t status =
+        ifx_t1prime_virtual_get_state(self, IFX_PROTOCOL_RECEIVE, &state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    if ((response == NULL) || (response_len == NULL) || (expected_len == 0U) ||
+        (expected_len == IFX_PROTOCOL_RECEIVE_LEN_UNKOWN))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    bool ready = ifx_t1prime_virtual_ready(state);
+#ifdef IFX_T1PRIME_INTERFACE_I2C
+    if (!ready)
+    {
+        ifx_t1prime_virtual_bus(state, 0U);
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                         IFX_T1PRIME_VIRTUAL_NACK);
+    }
+#endif
+
+    *response = (uint8_t *) malloc(expected_len);
+    if (*response == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE, IFX_OUT_OF_MEMORY);
+    }
+    for (size_t i = 0U; i < expected_len; i++)
+    {
+#ifdef IFX_T1PRIME_INTERFACE_I2C
+        bool send = state->frame_pending;
+#else
+        // Frame never starts with first byte of SPI read
+        bool send = state->frame_pending &&
+                    ((state->frame_offset > 0U) || (ready && (i > 0U)));
+#endif
+        (*response)[i] = send ? ifx_t1prime_virtual_frame_byte(state)
+                              : IFX_T1PRIME_VIRTUAL_FILLER;
+    }
+    *response_len = expected_len;
+    ifx_t1prime_virtual_bus(state, expected_len);
+    state->statistics.bytes_read += expected_len;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief ifx_protocol_destroy_callback_t for virtual Global Platform T=1'
+ * secure element.
+ *
+ * \see ifx_protocol_destroy_callback_t
+ */
+static void ifx_t1prime_virtual_destroy(ifx_protocol_t *self)
+{
+    if ((self != NULL) && (self->_properties != NULL))
+    {
+        ifx_t1prime_virtual_state_t *state =
+            (ifx_t1prime_virtual_state_t *) self->_properties;
+        if (state->command != NULL)
+        {
+            free(state->command);
+        }
+        if (state->response != NULL)
+        {
+            free(state->response);
+        }
+        if (state->ready_set)
+        {
+            ifx_timer_destroy(&state->ready);
+        }
+        free(self->_properties);
+        self->_properties = NULL;
+    }
+}
+
+/**
+ * \brief Initializes protocol stack as virtual T=1' secure element.
+ *
+ * \param[in] self Protocol stack to be initialized.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_virtual_initialize(ifx_protocol_t *self)
+{
+    if (self == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_VIRTUAL_INITIALIZE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    ifx_status_t status = ifx_protocol_layer_initialize(self);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+
+    ifx_t1prime_virtual_state_t *state = (ifx_t1prime_virtual_state_t *) malloc(
+        sizeof(ifx_t1prime_virtual_state_t));
+    if (state == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_VIRTUAL_INITIALIZE,
+                         IFX_OUT_OF_MEMORY);
+    }
+    memset(state, 0, sizeof(ifx_t1prime_virtual_state_t));
+    state->default_ifsc = IFX_T1PRIME_VIRTUAL_DEFAULT_IFS;
+    state->max_ifsd = IFX_T1PRIME_VIRTUAL_DEFAULT_IFS;
+    state->bwt_ms = IFX_T1PRIME_DEFAULT_BWT_MS;
+    state->random = 1U;
+    ifx_t1prime_virtual_reset(state);
+
+    self->_layer_id = IFX_T1PRIME_VIRTUAL_PROTOCOL_LAYER_ID;
+    self->_transmit = ifx_t1prime_virtual_transmit;
+    self->_receive = ifx_t1prime_virtual_receive;
+    self->_destructor = ifx_t1prime_virtual_destroy;
+    self->_properties = state;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Sets callback executing command APDUs.
+ *
+ * \param[in] self Virtual secure element.
+ * \param[in] handler Callback executing command APDUs (\c NULL for echo).
+ * \param[in] context Context passed to \p handler.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_virtual_set_apdu_handler(
+    ifx_protocol_t *self, ifx_t1prime_virtual_apdu_handler_t handler,
+    void *context)
+{
+    ifx_t1prime_virtual_state_t *state;
+    ifx_status_t status = ifx_t1prime_virtual_get_state(
+        self, IFX_T1PRIME_VIRTUAL_SET_APDU_HANDLER, &state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    state->apdu_handler = handler;
+    state->apdu_handler_context = context;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Sets data-link layer parameters announced in CIP.
+ *
+ * \param[in] self Virtual secure element.
+ * \param[in] ifsc Maximum information field size of the secure element.
+ * \param[in] ifsd Maximum information field size sent by the secure element.
+ * \param[in] bwt_ms Block waiting time in [ms].
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t ifx_t1prime_virtual_set_link_parameters(ifx_protocol_t *self,
+                                                     size_t ifsc, size_t ifsd,
+                                                     uint16_t bwt_ms)
+{
+    ifx_t1prime_virtual_state_t *state;
+    ifx_status_t status = ifx_t1prime_virtual_get_state(
+        self, IFX_T1PRIME_VIRTUAL_SET_LINK_PARAMETERS, &state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    if ((ifsc == 0U) || (ifsc > IFX_T1PRIME_MAX_IFS) || (ifsd == 0U) ||
+        (ifsd > IFX_T1PRIME_MAX_IFS))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_VIRTUAL_SET_LINK_PARAMETERS,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    state->default_ifsc = ifsc;
+    state->ifsc = ifsc;
+    state->max_ifsd = ifsd;
+    state->ifsd = ifsd;
+    state->bwt_ms = bwt_ms;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Sets latencies modelled by virtual secure element.
+ *
+ * \param[in] self Virtual secure element.
+ * \param[in] timing Latencies to be modelled.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t
+ifx_t1prime_virtual_set_timing(ifx_protocol_t *self,
+                               const ifx_t1prime_virtual_timing_t *timing)
+{
+    ifx_t1prime_virtual_state_t *state;
+    ifx_status_t status = ifx_t1prime_virtual_get_state(
+        self, IFX_T1PRIME_VIRTUAL_SET_TIMING, &state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    if (timing == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_VIRTUAL_SET_TIMING,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    state->timing = *timing;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Sets faults to be injected by virtual secure element.
+ *
+ * \param[in] self Virtual secure element.
+ * \param[in] faults Faults to be injected.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t
+ifx_t1prime_virtual_inject_faults(ifx_protocol_t *self,
+                                  const ifx_t1prime_virtual_faults_t *faults)
+{
+    ifx_t1prime_virtual_state_t *state;
+    ifx_status_t status = ifx_t1prime_virtual_get_state(
+        self, IFX_T1PRIME_VIRTUAL_INJECT_FAULTS, &state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    if ((faults == NULL) || (faults->ifs_request > IFX_T1PRIME_MAX_IFS))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_VIRTUAL_INJECT_FAULTS,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    state->faults = *faults;
+    state->random = (faults->seed != 0U) ? faults->seed : 1U;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Returns traffic counted by virtual secure element.
+ *
+ * \param[in] self Virtual secure element.
+ * \param[out] statistics Buffer to store counters in.
+ * \param[in] reset Whether to reset counters afterwards.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ * \cond FULL_DOCUMENTATION_BUILD
+ * \relates ifx_protocol
+ * \endcond
+ */
+ifx_status_t
+ifx_t1prime_virtual_get_statistics(ifx_protocol_t *self,
+                                   ifx_t1prime_virtual_statistics_t *statistics,
+                                   bool reset)
+{
+    ifx_t1prime_virtual_state_t *state;
+    ifx_status_t status = ifx_t1prime_virtual_get_state(
+        self, IFX_T1PRIME_VIRTUAL_GET_STATISTICS, &state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    if (statistics == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_VIRTUAL_GET_STATISTICS,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    *statistics = state->statistics;
+    if (reset)
+    {
+        memset(&state->statistics, 0, sizeof(state->statistics));
+    }
+    return IFX_SUCCESS;
+}
@@ -30,6 +30,23 @@
  */
 #define IFX_LOG_TAG IFX_T1PRIME_LOG_TAG
 
+/**
+ * \brief Runs \p call while holding the lock of the protocol stack.
+ *
+ * \details Stores the status of ifx_protocol_lock() in \p status if the lock
+ * cannot be acquired, the return value of \p call otherwise.
+ */
+#define IFX_T1PRIME_LOCKED(self, status, call)                                 \
+    do                                                                         \
+    {                                                                          \
+        (status) = ifx_protocol_lock(self);                                    \
+        if (IFX_SUCCESS == (status))                                           \
+        {                                                                      \
+            (status) = (call);                                                 \
+            ifx_protocol_unlock(self);                                         \
+        }                                                                      \
+    } while (0)
+
 /**
  * \brief Initializes Protocol object for Global Platform T=1' protocol.
  *
@@ -70,6 +87,7 @@ ifx_status_t ifx_t1prime_initialize(ifx_protocol_t *self,
     self->_base = driver;
     self->_activate = ifx_t1prime_activate;
     self->_transceive = ifx_t1prime_transceive;
+    self->_get_request_buffer = ifx_t1prime_get_request_buffer;
     self->_destructor = ifx_t1prime_destroy;
 
 #ifndef IFX_T1PRIME_INTERFACE_I2C
@@ -91,40 +109,45 @@ ifx_status_t ifx_t1prime_initialize(ifx_protocol_t *self,
 }
 
 /**
- * \brief ifx_protocol_activate_callback_t for Global Platform T=1' protocol.
+ * \brief Notifies reset listener (if any) that the secure element is reset.
  *
- * \see ifx_protocol_activate_callback_t
+ * \param[in] protocol_state Protocol state holding reset listener.
  */
-ifx_status_t ifx_t1prime_activate(ifx_protocol_t *self, uint8_t **response,
-                                  size_t *response_len)
+static void
+ifx_t1prime_notify_reset(const ifx_t1prime_protocol_state_t *protocol_state)
 {
-    // Ignore unused parameters
-    (void) response;
-    (void) response_len;
-
-    // Validate parameters
-    if (self == NULL)
+    if (protocol_state->reset_listener != NULL)
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_ACTIVATE,
-                         IFX_ILLEGAL_ARGUMENT);
+        protocol_state->reset_listener(protocol_state->reset_listener_context);
     }
+}
 
-    IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_DEBUG,
-                    "Activating communication channel to secure element");
+/**
+ * \brief Resets protocol state and physical layer to default values before
+ * activation.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state to be reset.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t
+ifx_t1prime_activate_prepare(ifx_protocol_t *self,
+                             ifx_t1prime_protocol_state_t *protocol_state)
+{
+    ifx_t1prime_notify_reset(protocol_state);
 
     // Set default communication values in case SE changed
-    ifx_t1prime_protocol_state_t *protocol_state;
-    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
-    if (status != IFX_SUCCESS)
-    {
-        return status;
-    }
+    protocol_state->session_valid = false;
     protocol_state->ifsc = IFX_T1PRIME_DEFAULT_IFSC;
+    protocol_state->ifsd = 0U;
+    protocol_state->receive_hint = 0U;
+    protocol_state->chained_information_size = 0U;
     protocol_state->bwt = IFX_T1PRIME_DEFAULT_BWT_MS;
     protocol_state->pwt = IFX_T1PRIME_DEFAULT_PWT_MS;
 
 #ifdef IFX_T1PRIME_INTERFACE_I2C
-    status = ifx_i2c_set_clock_frequency(
+    ifx_status_t status = ifx_i2c_set_clock_frequency(
         self, IFX_T1PRIME_DEFAULT_I2C_CLOCK_FREQUENCY_HZ);
     if (status != IFX_SUCCESS)
     {
@@ -136,7 +159,7 @@ ifx_status_t ifx_t1prime_activate(ifx_protocol_t *self, uint8_t **response,
         return status;
     }
 #else
-    status = ifx_spi_set_clock_frequency(
+    ifx_status_t status = ifx_spi_set_clock_frequency(
         self, T1PRIME_DEFAULT_SPI_CLOCK_FREQUENCY_HZ);
     if (status != IFX_SUCCESS)
     {
@@ -172,29 +195,40 @@ ifx_status_t ifx_t1prime_activate(ifx_protocol_t *self, uint8_t **response,
             atpo = NULL;
         }
     }
+    return IFX_SUCCESS;
+}
 
-    // Read communication interface parameters to negotiate protocol parameters
-    ifx_cip_t cip;
-    status = ifx_t1prime_s_cip(self, &cip);
-    if (status != IFX_SUCCESS)
-    {
-        return status;
-    }
+/**
+ * \brief Derives session parameters from validated CIP.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] cip CIP read from secure element.
+ * \param[out] session Buffer to store session parameters in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t ifx_t1prime_session_from_cip(ifx_protocol_t *self,
+                                                 const ifx_cip_t *cip,
+                                                 ifx_t1prime_session_t *session)
+{
+    // Only used for logging
+    (void) self;
 
-    // Set data-link layer parameters
+    // Data-link layer parameters
     ifx_dllp_t dllp;
-    status = ifx_t1prime_dllp_decode(&dllp, cip.dllp, cip.dllp_len);
+    ifx_status_t status = ifx_t1prime_dllp_decode(&dllp, cip->dllp,
+                                                  cip->dllp_len);
     if (status != IFX_SUCCESS)
     {
-        ifx_t1prime_cip_destroy(&cip);
         return status;
     }
-    protocol_state->bwt = dllp.bwt;
-    protocol_state->ifsc = dllp.ifsc;
+    session->plid = cip->plid;
+    session->bwt = dllp.bwt;
+    session->ifsc = dllp.ifsc;
     ifx_t1prime_dllp_destroy(&dllp);
 
-    // Set physical layer parameters depending on interface
-    if (cip.plid == IFX_T1PRIME_PLID_I2C)
+    // Physical layer parameters depending on interface
+    if (cip->plid == IFX_T1PRIME_PLID_I2C)
     {
 #ifndef IFX_T1PRIME_INTERFACE_I2C
         // Should not occur
@@ -202,47 +236,25 @@ ifx_status_t ifx_t1prime_activate(ifx_protocol_t *self, uint8_t **response,
                         "CIP contains invalid physical layer ID. Should be "
                         "IFX_T1PRIME_PLID_I2C "
                         "(%d) but is %d",
-                        IFX_T1PRIME_PLID_I2C, cip.plid);
-        ifx_t1prime_cip_destroy(&cip);
+                        IFX_T1PRIME_PLID_I2C, cip->plid);
         return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_VALIDATE,
                          IFX_T1PRIME_INVALID_PLID);
 #else
         ifx_plp_t plp;
-        status = ifx_t1prime_plp_decode(&plp, cip.plp, cip.plp_len);
-        if (status != IFX_SUCCESS)
-        {
-            ifx_t1prime_cip_destroy(&cip);
-            return status;
-        }
-
-        // Set clock frequency
-        status = ifx_i2c_set_clock_frequency(self, plp.mcf * 1000U);
-        if (status != IFX_SUCCESS)
-        {
-            ifx_t1prime_plp_destroy(&plp);
-            ifx_t1prime_cip_destroy(&cip);
-            return status;
-        }
-
-        // Set guard time
-        status = ifx_i2c_set_guard_time(self, plp.rwgt);
+        status = ifx_t1prime_plp_decode(&plp, cip->plp, cip->plp_len);
         if (status != IFX_SUCCESS)
         {
-            ifx_t1prime_plp_destroy(&plp);
-            ifx_t1prime_cip_destroy(&cip);
             return status;
         }
-
-        // Set polling time
-        protocol_state->mpot = plp.mpot;
-
-        // Set power wake-up time
-        protocol_state->pwt = plp.pwt;
-
+        session->clock_frequency = plp.mcf * 1000U;
+        session->guard_time = plp.rwgt;
+        session->mpot = plp.mpot;
+        session->pwt = plp.pwt;
+        session->seal = 0U;
         ifx_t1prime_plp_destroy(&plp);
 #endif
     }
-    else if (cip.plid == IFX_T1PRIME_PLID_SPI)
+    else if (cip->plid == IFX_T1PRIME_PLID_SPI)
     {
 #ifdef IFX_T1PRIME_INTERFACE_I2C
         // Should not occur
@@ -250,49 +262,21 @@ ifx_status_t ifx_t1prime_activate(ifx_protocol_t *self, uint8_t **response,
                         "CIP contains invalid physical layer ID. Should be "
                         "IFX_T1PRIME_PLID_SPI "
                         "(%d) but is %d",
-                        IFX_T1PRIME_PLID_SPI, cip.plid);
-        ifx_t1prime_cip_destroy(&cip);
+                        IFX_T1PRIME_PLID_SPI, cip->plid);
         return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_VALIDATE,
                          IFX_T1PRIME_INVALID_PLID);
 #else
         ifx_plp_t plp;
-        status = ifx_t1prime_plp_decode(&plp, cip.plp, cip.plp_len);
-        if (status != IFX_SUCCESS)
-        {
-            ifx_t1prime_cip_destroy(&cip);
-            return status;
-        }
-
-        // Set clock frequency
-        status = ifx_spi_set_clock_frequency(self, plp.mcf * 1000u);
-        if (status != IFX_SUCCESS)
-        {
-            ifx_t1prime_plp_destroy(&plp);
-            ifx_t1prime_cip_destroy(&cip);
-            return status;
-        }
-
-        // Set polling time
-        protocol_state->mpot = plp.mpot;
-
-        // Set guard time
-        status = ifx_spi_set_guard_time(self, plp.segt);
-        if (status != IFX_SUCCESS)
-        {
-            ifx_t1prime_plp_destroy(&plp);
-            ifx_t1prime_cip_destroy(&cip);
-            return status;
-        }
-
-        // Set SPI buffer size
-        status = ifx_spi_set_buffer_size(self, plp.seal);
+        status = ifx_t1prime_plp_decode(&plp, cip->plp, cip->plp_len);
         if (status != IFX_SUCCESS)
         {
-            ifx_t1prime_plp_destroy(&plp);
-            ifx_t1prime_cip_destroy(&cip);
             return status;
         }
-
+        session->clock_frequency = plp.mcf * 1000u;
+        session->guard_time = plp.segt;
+        session->mpot = plp.mpot;
+        session->pwt = IFX_T1PRIME_DEFAULT_PWT_MS;
+        session->seal = plp.seal;
         ifx_t1prime_plp_destroy(&plp);
 #endif
     }
@@ -301,15 +285,174 @@ ifx_status_t ifx_t1prime_activate(ifx_protocol_t *self, uint8_t **response,
         // Should not occur
         IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
                         "CIP contains invalid physical layer ID (%d)",
-                        cip.plid);
-        ifx_t1prime_cip_destroy(&cip);
+                        cip->plid);
         return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_VALIDATE,
                          IFX_T1PRIME_INVALID_PLID);
     }
-    ifx_t1prime_cip_destroy(&cip);
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Applies session parameters to protocol state and physical layer.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state to be updated.
+ * \param[in] session Session parameters to be applied.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t
+ifx_t1prime_session_apply(ifx_protocol_t *self,
+                          ifx_t1prime_protocol_state_t *protocol_state,
+                          const ifx_t1prime_session_t *session)
+{
+    // Set data-link layer parameters
+    protocol_state->bwt = session->bwt;
+    protocol_state->ifsc = session->ifsc;
+
+    // Set polling and power wake-up time
+    protocol_state->mpot = session->mpot;
+    protocol_state->pwt = session->pwt;
+
+#ifdef IFX_T1PRIME_INTERFACE_I2C
+    // Set clock frequency and guard time
+    ifx_status_t status =
+        ifx_i2c_set_clock_frequency(self, session->clock_frequency);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    status = ifx_i2c_set_guard_time(self, session->guard_time);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+#else
+    // Set clock frequency, guard time and SPI buffer size
+    ifx_status_t status =
+        ifx_spi_set_clock_frequency(self, session->clock_frequency);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    status = ifx_spi_set_guard_time(self, session->guard_time);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    status = ifx_spi_set_buffer_size(self, session->seal);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+#endif
+    protocol_state->session = *session;
+    return IFX_SUCCESS;
+}
 
+/**
+ * \brief Finishes activation once session parameters have been applied.
+ *
+ * \details Resynchronizes sequence counters, optionally negotiates IFSD and
+ * sizes the frame buffer to IFSC and the receive buffer to IFSD.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state of \p self.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t
+ifx_t1prime_activate_finish(ifx_protocol_t *self,
+                            ifx_t1prime_protocol_state_t *protocol_state)
+{
     // Resynchronize sequence counters
-    status = ifx_t1prime_s_resynch(self);
+    ifx_status_t status = ifx_t1prime_s_resynch(self);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+
+    // Optionally negotiate largest possible IFSD to minimize round trips
+    if (protocol_state->max_throughput)
+    {
+        status = ifx_t1prime_negotiate_max_ifsd(self);
+        if (status != IFX_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    // Size buffers for negotiated information field sizes up front
+    status =
+        ifx_t1prime_reserve_frame_buffer(protocol_state, protocol_state->ifsc);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    status = ifx_t1prime_reserve_receive_buffer(protocol_state,
+                                                protocol_state->ifsd);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    protocol_state->session_valid = true;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief ifx_protocol_activate_callback_t for Global Platform T=1' protocol.
+ *
+ * \see ifx_protocol_activate_callback_t
+ */
+ifx_status_t ifx_t1prime_activate(ifx_protocol_t *self, uint8_t **response,
+                                  size_t *response_len)
+{
+    // Ignore unused parameters
+    (void) response;
+    (void) response_len;
+
+    // Validate parameters
+    if (self == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_ACTIVATE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_DEBUG,
+                    "Activating communication channel to secure element");
+
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    status = ifx_t1prime_activate_prepare(self, protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+
+    // Read communication interface parameters to negotiate protocol parameters
+    ifx_cip_t cip;
+    status = ifx_t1prime_s_cip(self, &cip);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    ifx_t1prime_session_t session;
+    status = ifx_t1prime_session_from_cip(self, &cip, &session);
+    ifx_t1prime_cip_destroy(&cip);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    status = ifx_t1prime_session_apply(self, protocol_state, &session);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    status = ifx_t1prime_activate_finish(self, protocol_state);
     if (status != IFX_SUCCESS)
     {
         return status;
@@ -329,31 +472,79 @@ ifx_status_t ifx_t1prime_activate(ifx_protocol_t *self, uint8_t **response,
 }
 
 /**
- * \brief ifx_protocol_transceive_callback_t for Global Platform T=1' protocol.
+ * \brief Decodes session parameters exported by ifx_t1prime_export_session().
  *
- * \see ifx_protocol_transceive_callback_t
+ * \param[out] session Buffer to store session parameters in.
+ * \param[in] data Encoded session parameters.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if parameters are valid for this
+ * library, any other value in case of error.
  */
-ifx_status_t ifx_t1prime_transceive(ifx_protocol_t *self, const uint8_t *data,
-                                    size_t data_len, uint8_t **response,
-                                    size_t *response_len)
+static ifx_status_t ifx_t1prime_session_decode(ifx_t1prime_session_t *session,
+                                               const uint8_t *data,
+                                               size_t data_len)
 {
-    // Validate parameters
-    if (self == NULL)
+    if ((data == NULL) || (data_len != IFX_T1PRIME_SESSION_LEN))
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_ACTIVATE_FROM_SESSION,
+                         IFX_T1PRIME_INVALID_LEN);
+    }
+    if (data[0] != IFX_T1PRIME_SESSION_VERSION)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_ACTIVATE_FROM_SESSION,
                          IFX_ILLEGAL_ARGUMENT);
     }
-    if ((data == NULL) || (data_len == 0U) || (response == NULL) ||
-        (response_len == NULL))
+    uint16_t crc = ifx_crc16_ccitt_x25(data, IFX_T1PRIME_SESSION_LEN - 2U);
+    if ((data[16] != (uint8_t) (crc >> 8)) || (data[17] != (uint8_t) crc))
     {
-        IFX_T1PRIME_LOG(
-            self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
-            "Illegal NULL parameter given to ifx_t1prime_transceive()");
-        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_ACTIVATE_FROM_SESSION,
+                         IFX_T1PRIME_INVALID_CRC);
+    }
+    session->plid = data[1];
+    session->bwt = (uint16_t) ((data[2] << 8) | data[3]);
+    session->ifsc = (uint16_t) ((data[4] << 8) | data[5]);
+    session->mpot = data[6];
+    session->pwt = data[7];
+    session->clock_frequency = ((uint32_t) data[8] << 24) |
+                               ((uint32_t) data[9] << 16) |
+                               ((uint32_t) data[10] << 8) | data[11];
+    session->guard_time = (uint16_t) ((data[12] << 8) | data[13]);
+    session->seal = (uint16_t) ((data[14] << 8) | data[15]);
+
+    // Only accept parameters for interface the library has been built for
+#ifdef IFX_T1PRIME_INTERFACE_I2C
+    if (session->plid != IFX_T1PRIME_PLID_I2C)
+#else
+    if (session->plid != IFX_T1PRIME_PLID_SPI)
+#endif
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_ACTIVATE_FROM_SESSION,
+                         IFX_T1PRIME_INVALID_PLID);
+    }
+    if ((session->ifsc == 0U) || (session->ifsc > IFX_T1PRIME_MAX_IFS) ||
+        (session->bwt == 0U))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_ACTIVATE_FROM_SESSION,
                          IFX_ILLEGAL_ARGUMENT);
     }
+    return IFX_SUCCESS;
+}
 
-    // Get protocol state for communication
+/**
+ * \brief Implementation of ifx_t1prime_activate_from_session()
+ * called with lock held.
+ */
+static ifx_status_t
+ifx_t1prime_activate_from_session_unlocked(ifx_protocol_t *self,
+                                           const uint8_t *session,
+                                           size_t session_len)
+{
+    // Validate parameters
+    if (self == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_ACTIVATE_FROM_SESSION,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
     ifx_t1prime_protocol_state_t *protocol_state;
     ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
     if (status != IFX_SUCCESS)
@@ -361,411 +552,944 @@ ifx_status_t ifx_t1prime_transceive(ifx_protocol_t *self, const uint8_t *data,
         return status;
     }
 
-    // Prepare first block to be send
-    ifx_t1prime_block_t transmission_block;
-    transmission_block.information_size =
-        data_len < protocol_state->ifsc ? data_len : protocol_state->ifsc;
-    size_t last_information_size = transmission_block.information_size;
-    size_t offset = 0U;
-    size_t remaining = data_len;
-    transmission_block.nad = 0x21U;
-    transmission_block.pcb = IFX_T1PRIME_PCB_I(
-        protocol_state->send_counter, (remaining - last_information_size) > 0U);
-    transmission_block.information =
-        (uint8_t *) malloc(transmission_block.information_size);
-    if (transmission_block.information == NULL)
-    {
-        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
-                         IFX_OUT_OF_MEMORY);
-    }
-    // clang-format off
-    memcpy(transmission_block.information, data, transmission_block.information_size); // Flawfinder: ignore
-    // clang-format on
-
-    // Send blocks in loop to handle state
-    ifx_t1prime_block_t response_block;
-    bool aborted = false;
-    while (true)
+    // Cheap sanity checks before trusting stored parameters
+    ifx_t1prime_session_t decoded;
+    status = ifx_t1prime_session_decode(&decoded, session, session_len);
+    if (status == IFX_SUCCESS)
     {
-        status = ifx_t1prime_block_transceive(self, &transmission_block,
-                                              &response_block);
-        ifx_t1prime_block_destroy(&transmission_block);
+        status = ifx_t1prime_activate_prepare(self, protocol_state);
         if (status != IFX_SUCCESS)
         {
             return status;
         }
-
-        // I(N(S), M) -> SE starts sending response
-        if (IFX_T1PRIME_PCB_IS_I(response_block.pcb))
+        status = ifx_t1prime_session_apply(self, protocol_state, &decoded);
+        if (status != IFX_SUCCESS)
         {
-            // Cannot receive I block response while not all data has been sent
-            if ((remaining - last_information_size) > 0U)
-            {
-                IFX_T1PRIME_LOG(
-                    self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
-                    "Secure element started sending response before all "
-                    "data has been transmitted");
-                ifx_t1prime_block_destroy(&response_block);
-                return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
-                                 IFX_T1PRIME_INVALID_BLOCK);
-            }
-            protocol_state->send_counter ^= 0x01U;
-            break;
+            return status;
         }
-        // R(N(R)) -> SE wants (another) block
-        if (IFX_T1PRIME_PCB_IS_R(response_block.pcb))
+
+        // Secure element must still answer with stored parameters
+        status = ifx_t1prime_activate_finish(self, protocol_state);
+        if (status == IFX_SUCCESS)
         {
-            // SE expects next block
-            if ((protocol_state->send_counter ^ 0x01U) ==
-                IFX_T1PRIME_PCB_R_GET_NR(response_block.pcb))
-            {
-                ifx_t1prime_block_destroy(&response_block);
+            IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_DEBUG,
+                            "Successfully activated communication channel to "
+                            "secure element using stored session");
+            return IFX_SUCCESS;
+        }
+    }
+    IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_INFO,
+                    "Stored session not usable (%08X), reading CIP",
+                    (unsigned int) status);
+    return ifx_t1prime_activate(self, NULL, NULL);
+}
 
-                // Check if chain was aborted
-                if (aborted)
-                {
-                    return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
-                                     IFX_TRANSCEIVE_ABORTED);
-                }
+/**
+ * \brief Activates protocol using session parameters exported by
+ * ifx_t1prime_export_session().
+ *
+ * \param[in] self Protocol stack to be activated.
+ * \param[in] session Session parameters (might be \c NULL to force full
+ * activation).
+ * \param[in] session_len Number of bytes in \p session.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_activate_from_session(ifx_protocol_t *self,
+                                               const uint8_t *session,
+                                               size_t session_len)
+{
+    ifx_status_t status;
+    IFX_T1PRIME_LOCKED(self, status,
+                       ifx_t1prime_activate_from_session_unlocked(self, session,
+                                                                  session_len));
+    return status;
+}
 
-                // SE has last last block
-                if ((remaining - last_information_size) == 0U)
-                {
-                    transmission_block.pcb =
-                        IFX_T1PRIME_PCB_R_CRC(protocol_state->receive_counter);
-                    transmission_block.information = NULL;
-                    transmission_block.information_size = 0U;
-                }
-                else
-                {
-                    // Update state to move to next part of data
-                    remaining -= last_information_size;
-                    offset += last_information_size;
-                    protocol_state->send_counter ^= 0x01U;
-
-                    // Prepare next block
-                    transmission_block.information_size =
-                        remaining < protocol_state->ifsc ? remaining
-                                                         : protocol_state->ifsc;
-                    last_information_size = transmission_block.information_size;
-                    transmission_block.pcb = IFX_T1PRIME_PCB_I(
-                        protocol_state->send_counter,
-                        (remaining - last_information_size) > 0U);
-                    transmission_block.information =
-                        (uint8_t *) malloc(transmission_block.information_size);
-                    if (transmission_block.information == NULL)
-                    {
-                        ifx_t1prime_block_destroy(&response_block);
-                        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
-                                         IFX_OUT_OF_MEMORY);
-                    }
-                    // clang-format off
-                    memcpy(transmission_block.information, data + offset, transmission_block.information_size); // Flawfinder: ignore
-                    // clang-format on
-                }
-            }
-            // SE wants a retransmission
-            else
-            {
-                ifx_t1prime_block_destroy(&response_block);
-
-                // Retransmit last I block
-                transmission_block.pcb =
-                    IFX_T1PRIME_PCB_I(protocol_state->send_counter,
-                                      (remaining - last_information_size) > 0U);
-                transmission_block.information_size = last_information_size;
-                transmission_block.information =
-                    (uint8_t *) malloc(transmission_block.information_size);
-                if (transmission_block.information == NULL)
-                {
-                    return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
-                                     IFX_OUT_OF_MEMORY);
-                }
-                // clang-format off
-                memcpy(transmission_block.information, data + offset, transmission_block.information_size); // Flawfinder: ignore
-                // clang-format on
-            }
+/**
+ * \brief Implementation of ifx_t1prime_export_session() called with lock held.
+ */
+static ifx_status_t ifx_t1prime_export_session_unlocked(ifx_protocol_t *self,
+                                                        uint8_t *buffer,
+                                                        size_t *buffer_len)
+{
+    // Validate parameters
+    if ((self == NULL) || (buffer == NULL) || (buffer_len == NULL))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_EXPORT_SESSION,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    if (!protocol_state->session_valid)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_EXPORT_SESSION,
+                         IFX_T1PRIME_NO_SESSION);
+    }
+    if (*buffer_len < IFX_T1PRIME_SESSION_LEN)
+    {
+        *buffer_len = IFX_T1PRIME_SESSION_LEN;
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_EXPORT_SESSION,
+                         IFX_T1PRIME_BUFFER_TOO_SMALL);
+    }
+
+    // Encode big-endian like all T=1' parameters
+    const ifx_t1prime_session_t *session = &protocol_state->session;
+    buffer[0] = IFX_T1PRIME_SESSION_VERSION;
+    buffer[1] = session->plid;
+    buffer[2] = (uint8_t) (session->bwt >> 8);
+    buffer[3] = (uint8_t) session->bwt;
+    buffer[4] = (uint8_t) (session->ifsc >> 8);
+    buffer[5] = (uint8_t) session->ifsc;
+    buffer[6] = session->mpot;
+    buffer[7] = session->pwt;
+    buffer[8] = (uint8_t) (session->clock_frequency >> 24);
+    buffer[9] = (uint8_t) (session->clock_frequency >> 16);
+    buffer[10] = (uint8_t) (session->clock_frequency >> 8);
+    buffer[11] = (uint8_t) session->clock_frequency;
+    buffer[12] = (uint8_t) (session->guard_time >> 8);
+    buffer[13] = (uint8_t) session->guard_time;
+    buffer[14] = (uint8_t) (session->seal >> 8);
+    buffer[15] = (uint8_t) session->seal;
+    uint16_t crc = ifx_crc16_ccitt_x25(buffer, IFX_T1PRIME_SESSION_LEN - 2U);
+    buffer[16] = (uint8_t) (crc >> 8);
+    buffer[17] = (uint8_t) crc;
+    *buffer_len = IFX_T1PRIME_SESSION_LEN;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Exports session parameters of last activation.
+ *
+ * \param[in] self Protocol stack to export session parameters of.
+ * \param[out] buffer Buffer to store session parameters in.
+ * \param[in,out] buffer_len Number of bytes available in \p buffer as input,
+ * number of bytes in session parameters as output.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_export_session(ifx_protocol_t *self, uint8_t *buffer,
+                                        size_t *buffer_len)
+{
+    ifx_status_t status;
+    IFX_T1PRIME_LOCKED(self, status,
+                       ifx_t1prime_export_session_unlocked(self, buffer,
+                                                           buffer_len));
+    return status;
+}
+
+/**
+ * \brief ifx_t1prime_response_sink_t appending data to dynamically growing
+ * buffer.
+ *
+ * \details Grows buffer geometrically so that long chains do not result in
+ * quadratic copying.
+ *
+ * \param[in] context ifx_t1prime_dynamic_sink_t to append data to.
+ * \param[in] data Information field of received I block.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t ifx_t1prime_dynamic_sink(void *context, const uint8_t *data,
+                                             size_t data_len)
+{
+    ifx_t1prime_dynamic_sink_t *sink = (ifx_t1prime_dynamic_sink_t *) context;
+    if ((sink->buffer_len + data_len) > sink->buffer_size)
+    {
+        size_t buffer_size = sink->buffer_size * 2U;
+        if (buffer_size < (sink->buffer_len + data_len))
+        {
+            buffer_size = sink->buffer_len + data_len;
         }
-        // S(WTX REQ) -> SE needs more time
-        else if (response_block.pcb == IFX_T1PRIME_PCB_S_WTX_REQ)
+        uint8_t *buffer = (uint8_t *) realloc(sink->buffer, buffer_size);
+        if (buffer == NULL)
         {
-            // Verify information field
-            if ((response_block.information == NULL) ||
-                (response_block.information_size != 1U))
-            {
-                IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
-                                "Secure element sent invalid S(WTX request)");
-                ifx_t1prime_block_destroy(&response_block);
-                return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
-                                 IFX_T1PRIME_INVALID_BLOCK);
-            }
-            protocol_state->wtx =
-                response_block.information[0] * protocol_state->bwt;
-
-            // Send S(WTX RESP)
-            transmission_block.pcb = IFX_T1PRIME_PCB_S_WTX_RESP;
-            transmission_block.information = response_block.information;
-            transmission_block.information_size =
-                response_block.information_size;
-        }
-        // S(IFS REQ) -> SE wants to indicate that it can send more or less data
-        else if (response_block.pcb == IFX_T1PRIME_PCB_S_IFS_REQ)
-        {
-            // Verify IFS value
-            size_t ifs;
-            status = ifx_t1prime_ifs_decode(&ifs, response_block.information,
-                                            response_block.information_size);
-            if (status != IFX_SUCCESS)
-            {
-                ifx_t1prime_block_destroy(&response_block);
-                return status;
-            }
+            return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                             IFX_OUT_OF_MEMORY);
+        }
+        sink->buffer = buffer;
+        sink->buffer_size = buffer_size;
+    }
+    // clang-format off
+    memcpy(sink->buffer + sink->buffer_len, data, data_len); // Flawfinder: ignore
+    // clang-format on
+    sink->buffer_len += data_len;
+    return IFX_SUCCESS;
+}
 
-            // Update state in case new IFSC is smaller and SE wants a
-            // retransmission
-            last_information_size =
-                ifs < last_information_size ? ifs : last_information_size;
+/**
+ * \brief State of sink used by ifx_t1prime_transceive_into() to collect
+ * response in caller provided buffer.
+ */
+typedef struct
+{
+    /**
+     * \brief Caller provided response buffer.
+     */
+    uint8_t *buffer;
+
+    /**
+     * \brief Number of bytes available in buffer.
+     */
+    size_t buffer_size;
+
+    /**
+     * \brief Total number of bytes received (might exceed buffer_size).
+     */
+    size_t response_len;
+} ifx_t1prime_buffer_sink_t;
 
-            // Send S(IFS RESP)
-            transmission_block.pcb = IFX_T1PRIME_PCB_S_IFS_RESP;
-            transmission_block.information = response_block.information;
-            transmission_block.information_size =
-                response_block.information_size;
-        }
-        // S(ABORT REQ) -> SE wants to stop chain request
-        else if (response_block.pcb == IFX_T1PRIME_PCB_S_ABORT_REQ)
+/**
+ * \brief ifx_t1prime_response_sink_t copying data to caller provided buffer.
+ *
+ * \details Keeps counting received bytes if buffer is too small so that the
+ * required buffer size can be reported.
+ *
+ * \param[in] context ifx_t1prime_buffer_sink_t to copy data to.
+ * \param[in] data Information field of received I block.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS (cannot fail).
+ */
+static ifx_status_t ifx_t1prime_buffer_sink(void *context, const uint8_t *data,
+                                            size_t data_len)
+{
+    ifx_t1prime_buffer_sink_t *sink = (ifx_t1prime_buffer_sink_t *) context;
+    if ((sink->response_len + data_len) <= sink->buffer_size)
+    {
+        // clang-format off
+        memcpy(sink->buffer + sink->response_len, data, data_len); // Flawfinder: ignore
+        // clang-format on
+    }
+    sink->response_len += data_len;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Starts chained exchange of data via Global Platform T=1' protocol.
+ *
+ * \details Shared implementation of ifx_t1prime_transceive(),
+ * ifx_t1prime_transceive_into(), ifx_t1prime_transceive_to_sink() and
+ * ifx_t1prime_transceive_begin(). The exchange is driven by
+ * ifx_t1prime_exchange_run() or ifx_t1prime_transceive_poll().
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ * \param[in] data Data to be send via protocol.
+ * \param[in] data_len Number of bytes in \p data.
+ * \param[in] sink Sink called for every non-empty response I block.
+ * \param[in] context Context passed to \p sink.
+ */
+void ifx_t1prime_chain_begin(ifx_protocol_t *self,
+                             ifx_t1prime_protocol_state_t *protocol_state,
+                             const uint8_t *data, size_t data_len,
+                             ifx_t1prime_response_sink_t sink, void *context)
+{
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    exchange->chain = true;
+    exchange->response_phase = false;
+    exchange->data = data;
+    exchange->in_place = (protocol_state->frame_buffer != NULL) &&
+                         (data == protocol_state->frame_buffer +
+                                      IFX_BLOCK_PROLOGUE_LEN);
+    exchange->offset = 0U;
+    exchange->remaining = data_len;
+    exchange->aborted = false;
+    exchange->abort_response = false;
+    exchange->response_started = false;
+    exchange->sink = sink;
+    exchange->context = context;
+    exchange->sink_status = IFX_SUCCESS;
+
+    // Prepare first block to be send
+    // I blocks reference the caller's data directly (only read during framing)
+    ifx_t1prime_block_t *block = &exchange->block;
+    block->information_size =
+        data_len < protocol_state->ifsc ? data_len : protocol_state->ifsc;
+    exchange->last_information_size = block->information_size;
+    block->nad = IFX_NAD_HD_TO_SE;
+    block->pcb = IFX_T1PRIME_PCB_I(
+        protocol_state->send_counter,
+        (exchange->remaining - exchange->last_information_size) > 0U);
+    block->information = (uint8_t *) data;
+    protocol_state->request_blocks = 1U;
+    protocol_state->response_blocks = 0U;
+
+    // Requests are usually command APDUs so INS selects latency estimate
+    protocol_state->ins_class = data_len > 1U ? (uint8_t) (data[1] >> 4) : 0U;
+
+    ifx_t1prime_exchange_start(self, protocol_state);
+}
+
+/**
+ * \brief Handles response block while secure element receives response
+ * chain.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ * \param[out] complete Buffer to store whether the whole response has been
+ * received in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t
+ifx_t1prime_chain_response(ifx_protocol_t *self,
+                           ifx_t1prime_protocol_state_t *protocol_state,
+                           bool *complete)
+{
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    ifx_t1prime_block_t *response = &exchange->response;
+    ifx_t1prime_block_t *block = &exchange->block;
+
+    // I(N(S), M) -> SE sent response
+    if (IFX_T1PRIME_PCB_IS_I(response->pcb))
+    {
+        // Validate sequence counter
+        if (IFX_T1PRIME_PCB_I_GET_NS(response->pcb) !=
+            protocol_state->receive_counter)
         {
-            // Send S(ABORT RESP)
-            ifx_t1prime_block_destroy(&response_block);
-            transmission_block.pcb = IFX_T1PRIME_PCB_S_ABORT_RESP;
-            transmission_block.information = NULL;
-            transmission_block.information_size = 0U;
-            aborted = true;
+            return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                             IFX_T1PRIME_INVALID_BLOCK);
         }
-        else
+
+        // Check that data available in first response I block
+        if ((!exchange->response_started) &&
+            (response->information_size == 0U))
         {
-            ifx_t1prime_block_destroy(&response_block);
+            IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                            "Secure element sent invalid empty I(?, ?) block");
             return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
                              IFX_T1PRIME_INVALID_BLOCK);
         }
+        exchange->response_started = true;
+        protocol_state->response_blocks++;
+
+        // Pass data to sink (empty blocks are forced acknowledgements)
+        if ((response->information_size > 0U) &&
+            (exchange->sink_status == IFX_SUCCESS))
+        {
+            exchange->sink_status =
+                exchange->sink(exchange->context, response->information,
+                               response->information_size);
+        }
+
+        protocol_state->receive_counter ^= 0x01U;
+
+        // Check if more data will be transmitted
+        if (IFX_T1PRIME_PCB_I_HAS_MORE(response->pcb))
+        {
+            block->pcb = IFX_T1PRIME_PCB_R_ACK(protocol_state->receive_counter);
+            block->information = NULL;
+            block->information_size = 0U;
+        }
+        // All data received
+        else
+        {
+            *complete = true;
+        }
     }
-    // Validate response in loop to handle state
-    *response = NULL;
-    *response_len = 0U;
-    while (true)
+    // R(N(R)) -> SE needs a retransmission
+    else if (IFX_T1PRIME_PCB_IS_R(response->pcb))
     {
-        // I(N(S), M) -> SE sent response
-        if (IFX_T1PRIME_PCB_IS_I(response_block.pcb))
+        // Validate that card sent correct R(N(R)), response received so far
+        // cannot be trusted otherwise
+        if (IFX_T1PRIME_PCB_R_GET_NR(response->pcb) !=
+            protocol_state->send_counter)
         {
-            // Validate sequence counter
-            if (IFX_T1PRIME_PCB_I_GET_NS(response_block.pcb) !=
-                protocol_state->receive_counter)
+            IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
+                            "Received R(N(R)) block with invalid sequence "
+                            "counter");
+            if (IFX_SUCCESS == exchange->sink_status)
             {
-                ifx_t1prime_block_destroy(&response_block);
-                if ((*response) != NULL)
-                {
-                    free(*response);
-                    *response = NULL;
-                }
-                *response_len = 0U;
-                return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
-                                 IFX_T1PRIME_INVALID_BLOCK);
+                exchange->sink_status = IFX_ERROR(
+                    LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                    IFX_T1PRIME_INVALID_BLOCK);
             }
+        }
 
-            // Create new buffer for first response I block
-            if ((*response) == NULL)
-            {
-                // Check that data available
-                if (response_block.information_size == 0U)
-                {
-                    IFX_T1PRIME_LOG(
-                        self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
-                        "Secure element sent invalid empty I(?, ?) block");
-                    ifx_t1prime_block_destroy(&response_block);
-                    return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
-                                     IFX_T1PRIME_INVALID_BLOCK);
-                }
-                *response = response_block.information;
-                *response_len = response_block.information_size;
-                response_block.information = NULL;
-                response_block.information_size = 0U;
-            }
-            // Otherwise append to buffer
-            else
-            {
-                // Check for special case of forced acknowledgement
-                if (response_block.information_size > 0U)
-                {
-                    uint8_t *realloc_cache = *response;
-                    *response = (uint8_t *) realloc(
-                        *response,
-                        *response_len + response_block.information_size);
-                    if ((*response) == NULL)
-                    {
-                        free(realloc_cache);
-                        realloc_cache = NULL;
-                        *response_len = 0U;
-                        ifx_t1prime_block_destroy(&response_block);
-                        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
-                                         IFX_OUT_OF_MEMORY);
-                    }
-                    // clang-format off
-                    memcpy((*response) + *response_len, response_block.information, response_block.information_size); // Flawfinder: ignore
-                    // clang-format on
-                    *response_len += response_block.information_size;
-                }
-            }
+        // Send retransmission request
+        block->pcb = IFX_T1PRIME_PCB_R_ACK(protocol_state->receive_counter);
+        block->information = NULL;
+        block->information_size = 0U;
+    }
+    // S(ABORT request) -> end chain
+    else if (response->pcb == IFX_T1PRIME_PCB_S_ABORT_REQ)
+    {
+        // Answer with S(ABORT response)
+        block->pcb = IFX_T1PRIME_PCB_S_ABORT_RESP;
+        block->information = NULL;
+        block->information_size = 0U;
+        exchange->abort_response = true;
+    }
+    else
+    {
+        IFX_T1PRIME_LOG_BLOCK(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                              "Secure element sent invalid block: ", response);
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                         IFX_T1PRIME_INVALID_BLOCK);
+    }
+    return IFX_SUCCESS;
+}
 
-            ifx_t1prime_block_destroy(&response_block);
-            protocol_state->receive_counter ^= 0x01U;
+/**
+ * \brief Handles response block while host device sends request chain.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ * \param[out] complete Buffer to store whether the whole response has been
+ * received in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t
+ifx_t1prime_chain_request(ifx_protocol_t *self,
+                          ifx_t1prime_protocol_state_t *protocol_state,
+                          bool *complete)
+{
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    ifx_t1prime_block_t *response = &exchange->response;
+    ifx_t1prime_block_t *block = &exchange->block;
 
-            // Check if more data will be transmitted
-            if (IFX_T1PRIME_PCB_I_HAS_MORE(response_block.pcb))
-            {
-                transmission_block.pcb =
-                    IFX_T1PRIME_PCB_R_ACK(protocol_state->receive_counter);
-                transmission_block.information = NULL;
-                transmission_block.information_size = 0U;
-                status = ifx_t1prime_block_transceive(self, &transmission_block,
-                                                      &response_block);
-                ifx_t1prime_block_destroy(&transmission_block);
-                if (status != IFX_SUCCESS)
-                {
-                    if ((*response) != NULL)
-                    {
-                        free(*response);
-                        *response = NULL;
-                    }
-                    *response_len = 0U;
-                    return status;
-                }
-            }
-            // All data received
-            else
-            {
-                break;
-            }
+    // I(N(S), M) -> SE starts sending response
+    if (IFX_T1PRIME_PCB_IS_I(response->pcb))
+    {
+        // Cannot receive I block response while not all data has been sent
+        if ((exchange->remaining - exchange->last_information_size) > 0U)
+        {
+            IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                            "Secure element started sending response before "
+                            "all data has been transmitted");
+            return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                             IFX_T1PRIME_INVALID_BLOCK);
         }
-        // R(N(R)) -> SE needs a retransmission
-        else if (IFX_T1PRIME_PCB_IS_R(response_block.pcb))
+        protocol_state->send_counter ^= 0x01U;
+        exchange->response_phase = true;
+        return ifx_t1prime_chain_response(self, protocol_state, complete);
+    }
+    // R(N(R)) -> SE wants (another) block
+    if (IFX_T1PRIME_PCB_IS_R(response->pcb))
+    {
+        // SE expects next block
+        if ((protocol_state->send_counter ^ 0x01U) ==
+            IFX_T1PRIME_PCB_R_GET_NR(response->pcb))
         {
-            // Validate that card sent correct R(N(R))
-            if (IFX_T1PRIME_PCB_R_GET_NR(response_block.pcb) !=
-                protocol_state->send_counter)
+            // Check if chain was aborted
+            if (exchange->aborted)
             {
-                ifx_t1prime_block_destroy(&response_block);
-                if ((*response) != NULL)
-                {
-                    free(*response);
-                    *response = NULL;
-                }
-                *response_len = 0U;
+                return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                                 IFX_TRANSCEIVE_ABORTED);
             }
 
-            // Send retransmission request
-            ifx_t1prime_block_destroy(&response_block);
-            transmission_block.pcb =
-                IFX_T1PRIME_PCB_R_ACK(protocol_state->receive_counter);
-            transmission_block.information = NULL;
-            transmission_block.information_size = 0U;
-            status = ifx_t1prime_block_transceive(self, &transmission_block,
-                                                  &response_block);
-            ifx_t1prime_block_destroy(&transmission_block);
-            if (status != IFX_SUCCESS)
+            // SE has last last block
+            if ((exchange->remaining - exchange->last_information_size) == 0U)
             {
-                if ((*response) != NULL)
-                {
-                    free(*response);
-                    *response = NULL;
-                }
-                *response_len = 0U;
-                return status;
+                block->pcb =
+                    IFX_T1PRIME_PCB_R_CRC(protocol_state->receive_counter);
+                block->information = NULL;
+                block->information_size = 0U;
             }
-        }
-        // S(ABORT request) -> end chain
-        else if (response_block.pcb == IFX_T1PRIME_PCB_S_ABORT_REQ)
-        {
-            // Delete response cache
-            if ((*response) != NULL)
+            else
             {
-                free(*response);
-                *response = NULL;
+                // Update state to move to next part of data
+                exchange->remaining -= exchange->last_information_size;
+                exchange->offset += exchange->last_information_size;
+                protocol_state->send_counter ^= 0x01U;
+
+                // Prepare next block
+                block->information_size =
+                    exchange->remaining < protocol_state->ifsc
+                        ? exchange->remaining
+                        : protocol_state->ifsc;
+                exchange->last_information_size = block->information_size;
+                block->pcb = IFX_T1PRIME_PCB_I(
+                    protocol_state->send_counter,
+                    (exchange->remaining - exchange->last_information_size) >
+                        0U);
+                block->information =
+                    (uint8_t *) exchange->data + exchange->offset;
+                protocol_state->request_blocks++;
             }
-            *response_len = 0U;
-
-            // Answer with S(ABORT response)
-            transmission_block.pcb = IFX_T1PRIME_PCB_S_ABORT_RESP;
-            transmission_block.information = NULL;
-            transmission_block.information_size = 0U;
-            ifx_t1prime_block_transceive(self, &transmission_block,
-                                         &response_block);
-            ifx_t1prime_block_destroy(&transmission_block);
-            ifx_t1prime_block_destroy(&response_block);
-
-            IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
-                            "Secure element requested to abort transmission");
-            return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
-                             IFX_TRANSCEIVE_ABORTED);
         }
+        // SE wants a retransmission
         else
         {
-            IFX_T1PRIME_LOG_BLOCK(
-                self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
-                "Secure element sent invalid block: ", &response_block);
-            ifx_t1prime_block_destroy(&response_block);
-            if ((*response) != NULL)
-            {
-                free(*response);
-                *response = NULL;
-            }
-            *response_len = 0U;
+            // Retransmit last I block
+            block->pcb = IFX_T1PRIME_PCB_I(
+                protocol_state->send_counter,
+                (exchange->remaining - exchange->last_information_size) > 0U);
+            block->information_size = exchange->last_information_size;
+            block->information = (uint8_t *) exchange->data + exchange->offset;
+        }
+    }
+    // S(WTX REQ) -> SE needs more time
+    else if (response->pcb == IFX_T1PRIME_PCB_S_WTX_REQ)
+    {
+        // Verify information field
+        if ((response->information == NULL) ||
+            (response->information_size != 1U))
+        {
+            IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                            "Secure element sent invalid S(WTX request)");
             return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
                              IFX_T1PRIME_INVALID_BLOCK);
         }
+        protocol_state->wtx = response->information[0] * protocol_state->bwt;
+
+        // Send S(WTX RESP)
+        exchange->s_response_information[0] = response->information[0];
+        block->pcb = IFX_T1PRIME_PCB_S_WTX_RESP;
+        block->information = exchange->s_response_information;
+        block->information_size = 1U;
     }
+    // S(IFS REQ) -> SE wants to indicate that it can send more or less data
+    else if (response->pcb == IFX_T1PRIME_PCB_S_IFS_REQ)
+    {
+        // Verify IFS value
+        size_t ifs;
+        ifx_status_t status = ifx_t1prime_ifs_decode(
+            &ifs, response->information, response->information_size);
+        if (status != IFX_SUCCESS)
+        {
+            return status;
+        }
+
+        // Update state in case new IFSC is smaller and SE wants a
+        // retransmission
+        exchange->last_information_size =
+            ifs < exchange->last_information_size
+                ? ifs
+                : exchange->last_information_size;
 
+        // Send S(IFS RESP)
+        // clang-format off
+        memcpy(exchange->s_response_information, response->information, response->information_size); // Flawfinder: ignore
+        // clang-format on
+        block->pcb = IFX_T1PRIME_PCB_S_IFS_RESP;
+        block->information = exchange->s_response_information;
+        block->information_size = response->information_size;
+    }
+    // S(ABORT REQ) -> SE wants to stop chain request
+    else if (response->pcb == IFX_T1PRIME_PCB_S_ABORT_REQ)
+    {
+        // Send S(ABORT RESP)
+        block->pcb = IFX_T1PRIME_PCB_S_ABORT_RESP;
+        block->information = NULL;
+        block->information_size = 0U;
+        exchange->aborted = true;
+    }
+    else
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                         IFX_T1PRIME_INVALID_BLOCK);
+    }
     return IFX_SUCCESS;
 }
 
 /**
- * \brief ifx_protocol_destroy_callback_t for Global Platform T=1' protocol.
+ * \brief Continues chained exchange once a block exchange has finished.
  *
- * \see ifx_protocol_destroy_callback_t
+ * \details If the sink fails, the remaining response chain is still
+ * acknowledged to keep the protocol state in sync before the sink's error is
+ * reported.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ * \param[in] status Outcome of block exchange.
  */
-void ifx_t1prime_destroy(ifx_protocol_t *self)
+void ifx_t1prime_chain_continue(ifx_protocol_t *self,
+                                ifx_t1prime_protocol_state_t *protocol_state,
+                                ifx_status_t status)
 {
-    if (self != NULL)
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+
+    // S(ABORT response) ends response chain regardless of answer
+    if (exchange->abort_response)
+    {
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
+                        "Secure element requested to abort transmission");
+        ifx_t1prime_exchange_finish(
+            protocol_state,
+            IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                      IFX_TRANSCEIVE_ABORTED));
+        return;
+    }
+
+    bool complete = false;
+    if (IFX_SUCCESS == status)
+    {
+        status = exchange->response_phase
+                     ? ifx_t1prime_chain_response(self, protocol_state,
+                                                  &complete)
+                     : ifx_t1prime_chain_request(self, protocol_state,
+                                                 &complete);
+    }
+    if (status != IFX_SUCCESS)
+    {
+        ifx_t1prime_exchange_finish(protocol_state, status);
+        return;
+    }
+    if (complete)
     {
         IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_DEBUG,
-                        "Destroying T=1' protocol stack");
-        if (self->_properties != NULL)
-        {
-            free(self->_properties);
-            self->_properties = NULL;
-        }
+                        "Exchanged %d request and %d response I block(s)",
+                        (int) protocol_state->request_blocks,
+                        (int) protocol_state->response_blocks);
+        ifx_t1prime_exchange_finish(protocol_state, exchange->sink_status);
+        return;
     }
+    ifx_t1prime_exchange_start(self, protocol_state);
 }
 
 /**
- * \brief Performs Global Platform T=1' RESYNCH operation.
+ * \brief Sends data via Global Platform T=1' protocol and passes the
+ * information field of each response I block to a sink.
  *
- * \details Sends S(RESYNCH request) and expects S(RESYNCH response).
+ * \details Blocking wrapper around ifx_t1prime_chain_begin(). If the sink
+ * fails, the remaining response chain is still acknowledged to keep the
+ * protocol state in sync before the sink's error is returned.
  *
  * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] data Data to be send via protocol.
+ * \param[in] data_len Number of bytes in \p data.
+ * \param[in] sink Sink called for every non-empty response I block.
+ * \param[in] context Context passed to \p sink.
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
  * value in case of error.
  */
-ifx_status_t ifx_t1prime_s_resynch(ifx_protocol_t *self)
+static ifx_status_t ifx_t1prime_transceive_chain(
+    ifx_protocol_t *self, const uint8_t *data, size_t data_len,
+    ifx_t1prime_response_sink_t sink, void *context)
 {
-    // Prepare S(RESYNCH request)
-    ifx_t1prime_block_t request;
-    request.nad = IFX_NAD_HD_TO_SE;
-    request.pcb = IFX_T1PRIME_PCB_S_RESYNCH_REQ;
-    request.information_size = 0U;
-    request.information = NULL;
+    // Get protocol state for communication
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
 
-    // Validate parameters
-    if (self == NULL)
+    // Cannot interrupt non-blocking exchange
+    if (protocol_state->exchange.step != IFX_T1PRIME_STEP_IDLE)
+    {
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                        "Previous T=1' exchange has not been completed");
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                         IFX_INVALID_STATE);
+    }
+
+    ifx_t1prime_chain_begin(self, protocol_state, data, data_len, sink,
+                            context);
+    status = ifx_t1prime_exchange_run(self, protocol_state);
+    protocol_state->exchange.step = IFX_T1PRIME_STEP_IDLE;
+    return status;
+}
+
+/**
+ * \brief ifx_protocol_transceive_callback_t for Global Platform T=1' protocol.
+ *
+ * \see ifx_protocol_transceive_callback_t
+ */
+ifx_status_t ifx_t1prime_transceive(ifx_protocol_t *self, const uint8_t *data,
+                                    size_t data_len, uint8_t **response,
+                                    size_t *response_len)
+{
+    // Validate parameters
+    if (self == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    if ((data == NULL) || (data_len == 0U) || (response == NULL) ||
+        (response_len == NULL))
+    {
+        IFX_T1PRIME_LOG(
+            self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+            "Illegal NULL parameter given to ifx_t1prime_transceive()");
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    // Collect response in dynamically growing buffer
+    ifx_t1prime_dynamic_sink_t sink = {NULL, 0U, 0U};
+    *response = NULL;
+    *response_len = 0U;
+    ifx_status_t status = ifx_t1prime_transceive_chain(
+        self, data, data_len, ifx_t1prime_dynamic_sink, &sink);
+    if (status != IFX_SUCCESS)
+    {
+        if (sink.buffer != NULL)
+        {
+            free(sink.buffer);
+            sink.buffer = NULL;
+        }
+        return status;
+    }
+    *response = sink.buffer;
+    *response_len = sink.buffer_len;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Implementation of ifx_t1prime_transceive_into() called with lock held.
+ */
+static ifx_status_t ifx_t1prime_transceive_into_unlocked(ifx_protocol_t *self,
+                                                         const uint8_t *data,
+                                                         size_t data_len,
+                                                         uint8_t *response,
+                                                         size_t *response_len)
+{
+    // Validate parameters
+    if (self == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_INTO,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    if ((data == NULL) || (data_len == 0U) || (response_len == NULL) ||
+        ((response == NULL) && ((*response_len) > 0U)))
+    {
+        IFX_T1PRIME_LOG(
+            self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+            "Illegal NULL parameter given to ifx_t1prime_transceive_into()");
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_INTO,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    ifx_t1prime_buffer_sink_t sink = {response, *response_len, 0U};
+    ifx_status_t status = ifx_t1prime_transceive_chain(
+        self, data, data_len, ifx_t1prime_buffer_sink, &sink);
+    if (status != IFX_SUCCESS)
+    {
+        *response_len = 0U;
+        return status;
+    }
+    *response_len = sink.response_len;
+    if (sink.response_len > sink.buffer_size)
+    {
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                        "Response buffer too small (required %zu bytes)",
+                        sink.response_len);
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_INTO,
+                         IFX_T1PRIME_BUFFER_TOO_SMALL);
+    }
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Sends data via Global Platform T=1' protocol and reads back response
+ * into caller provided buffer.
+ *
+ * \details The information field of each response I block is copied straight
+ * to its final place in \p response without any intermediate reassembly
+ * buffer. If \p response is too small, the response chain is still read
+ * completely (but discarded) and the required buffer size is reported in
+ * \p response_len.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] data Data to be send via protocol.
+ * \param[in] data_len Number of bytes in \p data.
+ * \param[out] response Caller provided buffer to store response in.
+ * \param[in,out] response_len Number of bytes available in \p response as
+ * input, number of bytes in response as output.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, \c
+ * IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_INTO,
+ * IFX_T1PRIME_BUFFER_TOO_SMALL) if \p response is too small, any other value
+ * in case of error.
+ */
+ifx_status_t ifx_t1prime_transceive_into(ifx_protocol_t *self,
+                                         const uint8_t *data, size_t data_len,
+                                         uint8_t *response,
+                                         size_t *response_len)
+{
+    ifx_status_t status;
+    IFX_T1PRIME_LOCKED(self, status,
+                       ifx_t1prime_transceive_into_unlocked(self, data,
+                                                            data_len, response,
+                                                            response_len));
+    return status;
+}
+
+/**
+ * \brief Implementation of ifx_t1prime_transceive_to_sink()
+ * called with lock held.
+ */
+static ifx_status_t
+ifx_t1prime_transceive_to_sink_unlocked(ifx_protocol_t *self,
+                                        const uint8_t *data, size_t data_len,
+                                        ifx_t1prime_response_sink_t sink,
+                                        void *context)
+{
+    // Validate parameters
+    if (self == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_TO_SINK,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    if ((data == NULL) || (data_len == 0U) || (sink == NULL))
+    {
+        IFX_T1PRIME_LOG(
+            self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+            "Illegal NULL parameter given to ifx_t1prime_transceive_to_sink()");
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_TO_SINK,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    return ifx_t1prime_transceive_chain(self, data, data_len, sink, context);
+}
+
+/**
+ * \brief Sends data via Global Platform T=1' protocol and passes response to
+ * sink block by block.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] data Data to be send via protocol.
+ * \param[in] data_len Number of bytes in \p data.
+ * \param[in] sink Sink called with information field of every response I
+ * block.
+ * \param[in] context Custom context passed to \p sink.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_transceive_to_sink(ifx_protocol_t *self,
+                                            const uint8_t *data,
+                                            size_t data_len,
+                                            ifx_t1prime_response_sink_t sink,
+                                            void *context)
+{
+    ifx_status_t status;
+    IFX_T1PRIME_LOCKED(self, status,
+                       ifx_t1prime_transceive_to_sink_unlocked(self, data,
+                                                               data_len, sink,
+                                                               context));
+    return status;
+}
+
+/**
+ * \brief ifx_protocol_get_request_buffer_callback_t for Global Platform T=1'
+ * protocol.
+ *
+ * \details Returns the information field of the reusable frame buffer, so
+ * requests fitting into a single I block are framed without being copied.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] size Number of bytes the request will (at most) consist of.
+ * \param[out] buffer Buffer to store pointer to request buffer in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, \c
+ * IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_GET_REQUEST_BUFFER,
+ * IFX_T1PRIME_BUFFER_TOO_SMALL) if \p size exceeds IFSC, any other value in
+ * case of error.
+ */
+ifx_status_t ifx_t1prime_get_request_buffer(ifx_protocol_t *self, size_t size,
+                                            uint8_t **buffer)
+{
+    // Validate parameters
+    if ((self == NULL) || (buffer == NULL))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_GET_REQUEST_BUFFER,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+
+    // Frame buffer is in use while non-blocking exchange is pending
+    if (protocol_state->exchange.step != IFX_T1PRIME_STEP_IDLE)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_GET_REQUEST_BUFFER,
+                         IFX_INVALID_STATE);
+    }
+
+    // Only requests fitting into a single I block can be framed in place
+    if (size > protocol_state->ifsc)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_GET_REQUEST_BUFFER,
+                         IFX_T1PRIME_BUFFER_TOO_SMALL);
+    }
+    status =
+        ifx_t1prime_reserve_frame_buffer(protocol_state, protocol_state->ifsc);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    *buffer = protocol_state->frame_buffer + IFX_BLOCK_PROLOGUE_LEN;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief ifx_protocol_destroy_callback_t for Global Platform T=1' protocol.
+ *
+ * \see ifx_protocol_destroy_callback_t
+ */
+void ifx_t1prime_destroy(ifx_protocol_t *self)
+{
+    if (self != NULL)
+    {
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_DEBUG,
+                        "Destroying T=1' protocol stack");
+        if (self->_properties != NULL)
+        {
+            ifx_t1prime_protocol_state_t *protocol_state =
+                (ifx_t1prime_protocol_state_t *) self->_properties;
+            if (protocol_state->frame_buffer != NULL)
+            {
+                free(protocol_state->frame_buffer);
+                protocol_state->frame_buffer = NULL;
+            }
+            if (protocol_state->request_copy != NULL)
+            {
+                free(protocol_state->request_copy);
+                protocol_state->request_copy = NULL;
+            }
+            if (protocol_state->receive_buffer != NULL)
+            {
+                free(protocol_state->receive_buffer);
+                protocol_state->receive_buffer = NULL;
+            }
+            if (protocol_state->read_ahead.buffer != NULL)
+            {
+                free(protocol_state->read_ahead.buffer);
+                protocol_state->read_ahead.buffer = NULL;
+            }
+            if (protocol_state->poll_timer_set)
+            {
+                ifx_timer_destroy(&protocol_state->poll_timer);
+                protocol_state->poll_timer_set = false;
+            }
+            if (protocol_state->exchange.deadline_set)
+            {
+                ifx_timer_destroy(&protocol_state->exchange.deadline);
+                protocol_state->exchange.deadline_set = false;
+            }
+            if (protocol_state->exchange.dynamic_sink.buffer != NULL)
+            {
+                free(protocol_state->exchange.dynamic_sink.buffer);
+                protocol_state->exchange.dynamic_sink.buffer = NULL;
+            }
+            free(self->_properties);
+            self->_properties = NULL;
+        }
+    }
+}
+
+/**
+ * \brief Implementation of ifx_t1prime_s_resynch() called with lock held.
+ */
+static ifx_status_t ifx_t1prime_s_resynch_unlocked(ifx_protocol_t *self)
+{
+    // Prepare S(RESYNCH request)
+    ifx_t1prime_block_t request;
+    request.nad = IFX_NAD_HD_TO_SE;
+    request.pcb = IFX_T1PRIME_PCB_S_RESYNCH_REQ;
+    request.information_size = 0U;
+    request.information = NULL;
+
+    // Validate parameters
+    if (self == NULL)
     {
         return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
                          IFX_ILLEGAL_ARGUMENT);
@@ -792,13 +1516,10 @@ ifx_status_t ifx_t1prime_s_resynch(ifx_protocol_t *self)
             self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
             "Invalid answer to S(RESYNCH request) received (PCB: %02X)",
             response.pcb);
-        ifx_t1prime_block_destroy(&response);
         return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
                          IFX_T1PRIME_INVALID_BLOCK);
     }
 
-    ifx_t1prime_block_destroy(&response);
-
     // Reset protocol state
     ifx_t1prime_protocol_state_t *protocol_state;
     status = ifx_t1prime_get_protocol_state(self, &protocol_state);
@@ -815,16 +1536,26 @@ ifx_status_t ifx_t1prime_s_resynch(ifx_protocol_t *self)
 }
 
 /**
- * \brief Queries Global Platform T=1' Communication Interface Parameters (CIP).
+ * \brief Performs Global Platform T=1' RESYNCH operation.
  *
- * \details Sends S(CIP request) and expects S(CIP response).
+ * \details Sends S(RESYNCH request) and expects S(RESYNCH response).
  *
  * \param[in] self Protocol stack for performing necessary operations.
- * \param[out] cip Buffer to store received CIP in.
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
  * value in case of error.
  */
-ifx_status_t ifx_t1prime_s_cip(ifx_protocol_t *self, ifx_cip_t *cip)
+ifx_status_t ifx_t1prime_s_resynch(ifx_protocol_t *self)
+{
+    ifx_status_t status;
+    IFX_T1PRIME_LOCKED(self, status, ifx_t1prime_s_resynch_unlocked(self));
+    return status;
+}
+
+/**
+ * \brief Implementation of ifx_t1prime_s_cip() called with lock held.
+ */
+static ifx_status_t ifx_t1prime_s_cip_unlocked(ifx_protocol_t *self,
+                                               ifx_cip_t *cip)
 {
     // Prepare S(CIP request)
     ifx_t1prime_block_t request;
@@ -859,7 +1590,6 @@ ifx_status_t ifx_t1prime_s_cip(ifx_protocol_t *self, ifx_cip_t *cip)
         IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
                         "Invalid answer to S(CIP request) received (PCB: %02X)",
                         response.pcb);
-        ifx_t1prime_block_destroy(&response);
         return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
                          IFX_T1PRIME_INVALID_BLOCK);
     }
@@ -867,7 +1597,6 @@ ifx_status_t ifx_t1prime_s_cip(ifx_protocol_t *self, ifx_cip_t *cip)
     // Decode CIP information (implicitly validating data)
     status = ifx_t1prime_cip_decode(cip, response.information,
                                     response.information_size);
-    ifx_t1prime_block_destroy(&response);
     if (status != IFX_SUCCESS)
     {
         return status;
@@ -879,15 +1608,26 @@ ifx_status_t ifx_t1prime_s_cip(ifx_protocol_t *self, ifx_cip_t *cip)
 }
 
 /**
- * \brief Performs Global Platform T=1' software reset (SWR).
+ * \brief Queries Global Platform T=1' Communication Interface Parameters (CIP).
  *
- * \details Sends S(SWR request) and expects S(SWR response).
+ * \details Sends S(CIP request) and expects S(CIP response).
  *
  * \param[in] self Protocol stack for performing necessary operations.
+ * \param[out] cip Buffer to store received CIP in.
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
  * value in case of error.
  */
-ifx_status_t ifx_t1prime_s_swr(ifx_protocol_t *self)
+ifx_status_t ifx_t1prime_s_cip(ifx_protocol_t *self, ifx_cip_t *cip)
+{
+    ifx_status_t status;
+    IFX_T1PRIME_LOCKED(self, status, ifx_t1prime_s_cip_unlocked(self, cip));
+    return status;
+}
+
+/**
+ * \brief Implementation of ifx_t1prime_s_swr() called with lock held.
+ */
+static ifx_status_t ifx_t1prime_s_swr_unlocked(ifx_protocol_t *self)
 {
     // Prepare S(SWR request)
     ifx_t1prime_block_t request;
@@ -906,11 +1646,18 @@ ifx_status_t ifx_t1prime_s_swr(ifx_protocol_t *self)
     IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_DEBUG,
                     "Performing S(SWR)");
 
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    ifx_t1prime_notify_reset(protocol_state);
+
     ifx_t1prime_block_t response;
 
     // Send S(SWR request) to secure element and read back response
-    ifx_status_t status =
-        ifx_t1prime_block_transceive(self, &request, &response);
+    status = ifx_t1prime_block_transceive(self, &request, &response);
     ifx_t1prime_block_destroy(&request);
     if (status != IFX_SUCCESS)
     {
@@ -924,20 +1671,10 @@ ifx_status_t ifx_t1prime_s_swr(ifx_protocol_t *self)
         IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
                         "Invalid answer to S(SWR request) received (PCB: %02X)",
                         response.pcb);
-        ifx_t1prime_block_destroy(&response);
         return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
                          IFX_T1PRIME_INVALID_BLOCK);
     }
 
-    ifx_t1prime_block_destroy(&response);
-
-    ifx_t1prime_protocol_state_t *protocol_state;
-    status = ifx_t1prime_get_protocol_state(self, &protocol_state);
-    if (status != IFX_SUCCESS)
-    {
-        return status;
-    }
-
 #ifdef IFX_T1PRIME_RESET_DELAY_PWT
     ifx_timer_t swr_timer;
     // Wait for a duration of power wake-up time before initiating communication
@@ -968,15 +1705,25 @@ ifx_status_t ifx_t1prime_s_swr(ifx_protocol_t *self)
 }
 
 /**
- * \brief Performs Global Platform T=1' power on reset (POR).
+ * \brief Performs Global Platform T=1' software reset (SWR).
  *
- * \details Sends S(POR request).
+ * \details Sends S(SWR request) and expects S(SWR response).
  *
  * \param[in] self Protocol stack for performing necessary operations.
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
  * value in case of error.
  */
-ifx_status_t ifx_t1prime_s_por(ifx_protocol_t *self)
+ifx_status_t ifx_t1prime_s_swr(ifx_protocol_t *self)
+{
+    ifx_status_t status;
+    IFX_T1PRIME_LOCKED(self, status, ifx_t1prime_s_swr_unlocked(self));
+    return status;
+}
+
+/**
+ * \brief Implementation of ifx_t1prime_s_por() called with lock held.
+ */
+static ifx_status_t ifx_t1prime_s_por_unlocked(ifx_protocol_t *self)
 {
     // Prepare S(POR request)
     ifx_t1prime_block_t request;
@@ -995,16 +1742,17 @@ ifx_status_t ifx_t1prime_s_por(ifx_protocol_t *self)
     IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_DEBUG,
                     "Performing S(POR)");
 
-    // Send S(POR request) to secure element
-    ifx_status_t status = ifx_t1prime_block_transmit(self, &request);
-    ifx_t1prime_block_destroy(&request);
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
     if (status != IFX_SUCCESS)
     {
         return status;
     }
+    ifx_t1prime_notify_reset(protocol_state);
 
-    ifx_t1prime_protocol_state_t *protocol_state;
-    status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    // Send S(POR request) to secure element
+    status = ifx_t1prime_block_transmit(self, &request);
+    ifx_t1prime_block_destroy(&request);
     if (status != IFX_SUCCESS)
     {
         return status;
@@ -1040,39 +1788,217 @@ ifx_status_t ifx_t1prime_s_por(ifx_protocol_t *self)
 }
 
 /**
- * \brief Sends Block to secure element.
+ * \brief Performs Global Platform T=1' power on reset (POR).
+ *
+ * \details Sends S(POR request).
  *
  * \param[in] self Protocol stack for performing necessary operations.
- * \param[in] block Block object to be send to secure element.
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
  * value in case of error.
  */
-ifx_status_t ifx_t1prime_block_transmit(ifx_protocol_t *self,
-                                        const ifx_t1prime_block_t *block)
+ifx_status_t ifx_t1prime_s_por(ifx_protocol_t *self)
 {
-    // Validate parameters
-    if ((self == NULL) || (block == NULL))
-    {
-        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSMIT,
-                         IFX_ILLEGAL_ARGUMENT);
+    ifx_status_t status;
+    IFX_T1PRIME_LOCKED(self, status, ifx_t1prime_s_por_unlocked(self));
+    return status;
+}
+
+/**
+ * \brief Returns time to wait before the next poll according to the polling
+ * strategy.
+ *
+ * \param[in] protocol_state Protocol state holding polling strategy.
+ * \return uint32_t Polling interval in [us] (never less than the minimum
+ * polling time).
+ */
+static uint32_t
+ifx_t1prime_poll_interval(const ifx_t1prime_protocol_state_t *protocol_state)
+{
+    uint32_t interval = (uint32_t) protocol_state->mpot * 100U;
+
+    // Secure element signals response in interrupt mode
+    if (protocol_state->irq_handler != NULL)
+    {
+        return interval;
     }
-    // Validate protocol stack
-    if ((self->_base == NULL) || (self->_base->_transmit == NULL))
+
+    switch (protocol_state->polling_strategy)
     {
-        IFX_T1PRIME_LOG(
-            self->_logger, IFX_LOG_TAG, IFX_LOG_FATAL,
-            "ifx_t1prime_block_transmit() called with invalid protocol stack");
-        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSMIT,
-                         IFX_PROTOCOL_STACK_INVALID);
+    case IFX_T1PRIME_POLLING_BACKOFF:
+        if (protocol_state->poll_count < IFX_T1PRIME_POLLING_MAX_BACKOFF)
+        {
+            return interval << protocol_state->poll_count;
+        }
+        return interval << IFX_T1PRIME_POLLING_MAX_BACKOFF;
+    case IFX_T1PRIME_POLLING_ADAPTIVE:
+        if ((protocol_state->poll_count == 0U) &&
+            protocol_state->latency_pending)
+        {
+            // First poll slightly before response is expected
+            uint32_t estimate =
+                protocol_state->latency_estimate[protocol_state->ins_class];
+            estimate -= estimate >> 2;
+            if (estimate > interval)
+            {
+                return estimate;
+            }
+        }
+        return interval;
+    default:
+        return interval;
     }
+}
 
-    // Validate data
-    ifx_t1prime_protocol_state_t *protocol_state;
-    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+/**
+ * \brief Updates moving estimate of response latency for current INS class.
+ *
+ * \details Uses the time waited for polling since the request has been sent
+ * as sample.
+ *
+ * \param[in] protocol_state Protocol state holding latency estimates.
+ */
+static void
+ifx_t1prime_update_latency(ifx_t1prime_protocol_state_t *protocol_state)
+{
+    uint32_t *estimate =
+        &protocol_state->latency_estimate[protocol_state->ins_class];
+    uint32_t sample = protocol_state->poll_elapsed;
+    if (*estimate == 0U)
+    {
+        *estimate = sample;
+    }
+    else if (sample > *estimate)
+    {
+        *estimate += (sample - *estimate) >> 3;
+    }
+    else
+    {
+        *estimate -= (*estimate - sample) >> 3;
+    }
+    protocol_state->latency_pending = false;
+}
+
+/**
+ * \brief Starts minimum polling time at the end of a bus transaction.
+ *
+ * \details The actual duration is determined by the polling strategy.
+ *
+ * \param[in] protocol_state Protocol state holding polling timer.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t
+ifx_t1prime_poll_timer_start(ifx_t1prime_protocol_state_t *protocol_state)
+{
+    if (protocol_state->poll_timer_set)
+    {
+        ifx_timer_destroy(&protocol_state->poll_timer);
+        protocol_state->poll_timer_set = false;
+    }
+    uint32_t interval = ifx_t1prime_poll_interval(protocol_state);
+    ifx_status_t status =
+        ifx_timer_set(&protocol_state->poll_timer, (uint64_t) interval);
     if (status != IFX_SUCCESS)
     {
         return status;
     }
+    protocol_state->poll_timer_set = true;
+    protocol_state->poll_interval = interval;
+    protocol_state->poll_count++;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Waits for remainder of minimum polling time since the end of the
+ * last bus transaction.
+ *
+ * \details Returns immediately if the polling time has already passed or no
+ * transaction has been timestamped yet.
+ *
+ * \param[in] protocol_state Protocol state holding polling timer.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t
+ifx_t1prime_poll_timer_join(ifx_t1prime_protocol_state_t *protocol_state)
+{
+    if (!protocol_state->poll_timer_set)
+    {
+        return IFX_SUCCESS;
+    }
+    ifx_status_t status = IFX_SUCCESS;
+    if (!ifx_timer_has_elapsed(&protocol_state->poll_timer))
+    {
+        status = ifx_timer_join(&protocol_state->poll_timer);
+    }
+    ifx_timer_destroy(&protocol_state->poll_timer);
+    protocol_state->poll_timer_set = false;
+    protocol_state->poll_elapsed += protocol_state->poll_interval;
+    return status;
+}
+
+/**
+ * \brief Moves request data encoded in place out of the frame buffer.
+ *
+ * \details Required before the frame buffer is overwritten by anything else
+ * than the single I block holding the request, so that the request can still
+ * be (re)transmitted.
+ *
+ * \param[in] protocol_state Protocol state holding exchange.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t
+ifx_t1prime_request_relocate(ifx_t1prime_protocol_state_t *protocol_state)
+{
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    size_t data_len = exchange->offset + exchange->remaining;
+    if (protocol_state->request_copy_size < data_len)
+    {
+        uint8_t *request_copy =
+            (uint8_t *) realloc(protocol_state->request_copy, data_len);
+        if (request_copy == NULL)
+        {
+            return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSMIT,
+                             IFX_OUT_OF_MEMORY);
+        }
+        protocol_state->request_copy = request_copy;
+        protocol_state->request_copy_size = data_len;
+    }
+    // clang-format off
+    memcpy(protocol_state->request_copy, exchange->data, data_len); // Flawfinder: ignore
+    // clang-format on
+
+    // Blocks referencing request data have to follow
+    if (exchange->block.information == exchange->data)
+    {
+        exchange->block.information = protocol_state->request_copy;
+    }
+    if (exchange->to_send.information == exchange->data)
+    {
+        exchange->to_send.information = protocol_state->request_copy;
+    }
+    exchange->data = protocol_state->request_copy;
+    exchange->in_place = false;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Encodes Block into reusable frame buffer for (re)transmission.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding frame buffer.
+ * \param[in] block Block object to be send to secure element.
+ * \param[out] frame_len Buffer to store number of encoded bytes in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t
+ifx_t1prime_block_frame(ifx_protocol_t *self,
+                        ifx_t1prime_protocol_state_t *protocol_state,
+                        const ifx_t1prime_block_t *block, size_t *frame_len)
+{
+    // Validate data
     if (block->information_size > protocol_state->ifsc)
     {
         return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSMIT,
@@ -1082,99 +2008,128 @@ ifx_status_t ifx_t1prime_block_transmit(ifx_protocol_t *self,
     IFX_T1PRIME_LOG_BLOCK(self->_logger, IFX_LOG_TAG, IFX_LOG_INFO, ">> ",
                           block);
 
-    // Encode block
-    uint8_t *encoded;
-    size_t encoded_len;
-    status = ifx_t1prime_block_encode(block, &encoded, &encoded_len);
+    // Surplus data read ahead for previous response is stale now
+    protocol_state->read_ahead.length = 0U;
+
+    // Request encoded in place may only be framed as single I block
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    ifx_status_t status;
+    if (exchange->in_place &&
+        ((block->information != exchange->data) ||
+         (exchange->remaining > block->information_size)))
+    {
+        status = ifx_t1prime_request_relocate(protocol_state);
+        if (status != IFX_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    // Make sure reusable frame buffer can hold a full block of IFSC bytes
+    status =
+        ifx_t1prime_reserve_frame_buffer(protocol_state, protocol_state->ifsc);
     if (status != IFX_SUCCESS)
     {
         return status;
     }
 
-    // Actually transmit block
-#ifdef IFX_T1PRIME_INTERFACE_I2C
-    // TODO: Check what is the correct timeout to be used
-    ifx_timer_t bwt_timer;
-    status = ifx_timer_set(&bwt_timer, (uint64_t) protocol_state->bwt * 1000U);
+    // Encode block
+    status = ifx_t1prime_block_encode_into(block, protocol_state->frame_buffer,
+                                           protocol_state->frame_buffer_size,
+                                           frame_len);
     if (status != IFX_SUCCESS)
     {
-        free(encoded);
-        encoded = NULL;
         return status;
     }
 
+    // Polling for write acknowledge starts over
+    protocol_state->poll_count = 0U;
+    protocol_state->latency_pending = false;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Performs a single attempt to transmit the encoded frame.
+ *
+ * \details On success the first poll for the response is scheduled. If the
+ * secure element did not acknowledge the data (I2C), the polling time for the
+ * next attempt is started instead.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding frame buffer.
+ * \param[in] frame_len Number of bytes in frame buffer.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t
+ifx_t1prime_frame_transmit(ifx_protocol_t *self,
+                           ifx_t1prime_protocol_state_t *protocol_state,
+                           size_t frame_len)
+{
+    uint8_t *encoded = protocol_state->frame_buffer;
+#ifdef IFX_T1PRIME_INTERFACE_I2C
     // Temporarily disable logging until LATE ACK is received
     ifx_logger_t *driver_logger = self->_base->_logger;
     self->_base->_logger = NULL;
-
-    // Try sending in loop until SE acknowledges data
-    do
+    ifx_status_t status =
+        self->_base->_transmit(self->_base, encoded, frame_len);
+    self->_base->_logger = driver_logger;
+    if (status != IFX_SUCCESS)
     {
-        status = self->_base->_transmit(self->_base, encoded, encoded_len);
-        if (IFX_SUCCESS == status)
-        {
-            IFX_T1PRIME_LOG_BYTES(driver_logger, IFX_I2C_LOG_TAG, IFX_LOG_INFO,
-                                  ">> ", encoded, encoded_len, " ");
-            break;
-        }
-        // Wait for polling time and try again
-        ifx_timer_t pot_timer;
+        protocol_state->polls++;
+        protocol_state->wasted_polls++;
+
+        // Polling time starts as soon as the bus transaction has ended
         ifx_status_t timer_status =
-            ifx_timer_set(&pot_timer, (uint64_t) protocol_state->mpot * 1000U);
-        if (timer_status != IFX_SUCCESS)
-        {
-            break;
-        }
-        timer_status = ifx_timer_join(&pot_timer);
-        ifx_timer_destroy(&pot_timer);
-        if (timer_status != IFX_SUCCESS)
-        {
-            break;
-        }
-    } while (!ifx_timer_has_elapsed(&bwt_timer));
+            ifx_t1prime_poll_timer_start(protocol_state);
+        return timer_status != IFX_SUCCESS ? timer_status : status;
+    }
+    IFX_T1PRIME_LOG_BYTES(driver_logger, IFX_I2C_LOG_TAG, IFX_LOG_INFO, ">> ",
+                          encoded, frame_len, " ");
+#else
+    ifx_status_t status =
+        self->_base->_transmit(self->_base, encoded, frame_len);
     if (status != IFX_SUCCESS)
     {
-        IFX_T1PRIME_LOG(driver_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
-                        "could not send T=1' block via I2C");
+        return status;
     }
-    self->_base->_logger = driver_logger;
-    ifx_timer_destroy(&bwt_timer);
-#else
-    status = self->_base->_transmit(self->_base, encoded, encoded_len);
 #endif
-    free(encoded);
-    encoded = NULL;
-    return status;
+
+    // Schedule first poll for response
+    protocol_state->poll_count = 0U;
+    protocol_state->poll_elapsed = 0U;
+    protocol_state->latency_pending = IFX_T1PRIME_PCB_IS_I(encoded[1]) &&
+                                      !IFX_T1PRIME_PCB_I_HAS_MORE(encoded[1]);
+    return ifx_t1prime_poll_timer_start(protocol_state);
 }
 
 /**
- * \brief Reads Block from secure element.
+ * \brief Sends Block to secure element.
  *
  * \param[in] self Protocol stack for performing necessary operations.
- * \param[out] block Block object to store received data in.
+ * \param[in] block Block object to be send to secure element.
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
  * value in case of error.
  */
-ifx_status_t t1prime_block_receive(ifx_protocol_t *self,
-                                   ifx_t1prime_block_t *block)
+ifx_status_t ifx_t1prime_block_transmit(ifx_protocol_t *self,
+                                        const ifx_t1prime_block_t *block)
 {
     // Validate parameters
     if ((self == NULL) || (block == NULL))
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSMIT,
                          IFX_ILLEGAL_ARGUMENT);
     }
     // Validate protocol stack
-    if ((self->_base == NULL) || (self->_base->_receive == NULL))
+    if ((self->_base == NULL) || (self->_base->_transmit == NULL))
     {
         IFX_T1PRIME_LOG(
             self->_logger, IFX_LOG_TAG, IFX_LOG_FATAL,
-            "t1prime_block_receive() called with invalid protocol stack");
-        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+            "ifx_t1prime_block_transmit() called with invalid protocol stack");
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSMIT,
                          IFX_PROTOCOL_STACK_INVALID);
     }
 
-    // Get protocol state for timing information
     ifx_t1prime_protocol_state_t *protocol_state;
     ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
     if (status != IFX_SUCCESS)
@@ -1182,1032 +2137,2441 @@ ifx_status_t t1prime_block_receive(ifx_protocol_t *self,
         return status;
     }
 
-    // Poll for NAD
-    block->nad = 0x00U;
-
-    // Use "shortcut" read to minimize amount of I2C/SPI accesses
-    block->information = NULL;
-    block->information_size = 0U;
-    uint8_t *binary = NULL;
-    size_t binary_len = 0U;
-    uint16_t crc = 0U;
-    size_t information_size = 0U;
-
-    // Use either BWT or WTX as time until response has to be ready
-    uint32_t bwt = protocol_state->bwt;
-    if (protocol_state->wtx > bwt)
+    size_t frame_len;
+    status = ifx_t1prime_block_frame(self, protocol_state, block, &frame_len);
+    if (status != IFX_SUCCESS)
     {
-        bwt = protocol_state->wtx;
+        return status;
     }
-    protocol_state->wtx = 0U;
 
+    // Actually transmit block
+#ifdef IFX_T1PRIME_INTERFACE_I2C
+    // TODO: Check what is the correct timeout to be used
     ifx_timer_t bwt_timer;
-    status = ifx_timer_set(&bwt_timer, (uint32_t) (bwt * 1000U));
+    status = ifx_timer_set(&bwt_timer, (uint64_t) protocol_state->bwt * 1000U);
     if (status != IFX_SUCCESS)
     {
         return status;
     }
 
-    // Temporarily disable logging while polling
-    ifx_logger_t *driver_logger = self->_base->_logger;
-    self->_base->_logger = NULL;
-
+    // Try sending in loop until SE acknowledges data
     do
     {
-        // Use interrupt method if set
-        if (protocol_state->irq_handler != NULL)
-        {
-            status = protocol_state->irq_handler(self, bwt * 1000U);
-            switch (status)
-            {
-            case IFX_T1PRIME_IRQ_TRIGGERED:
-                IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_INFO,
-                                "T=1' data interrupt triggered");
-                break;
-            case IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IRQ,
-                           IFX_T1PRIME_IRQ_NOT_TRIGGERED):
-                IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
-                                "T=1' data interrupt did not trigger in time");
-                self->_base->_logger = driver_logger;
-                ifx_timer_destroy(&bwt_timer);
-                return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
-                                 IFX_TOO_LITTLE_DATA);
-            default:
-                IFX_T1PRIME_LOG(
-                    self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
-                    "Error occurred while waiting for T=1' data interrupt");
-                self->_base->_logger = driver_logger;
-                ifx_timer_destroy(&bwt_timer);
-                return status;
-            }
-        }
-#ifdef IFX_T1PRIME_INTERFACE_I2C
-        // Try to read full block at once
-        status = self->_base->_receive(
-            self->_base, IFX_BLOCK_PROLOGUE_LEN + IFX_BLOCK_EPILOGUE_LEN,
-            &binary, &binary_len);
-
-        // I2C successful read signalizes start of response
+        status = ifx_t1prime_frame_transmit(self, protocol_state, frame_len);
         if (IFX_SUCCESS == status)
         {
-            // Retry on invalid NAD
-            uint8_t nad = binary[0];
-            uint8_t dad = (nad >> 4) & 0x0fU;
-            uint8_t sad = nad & 0x0F;
-            if (dad == 0x00U || dad == 0x0fU || sad == 0x00U || sad == 0x0fU)
-            {
-                IFX_T1PRIME_LOG_BYTES(driver_logger, IFX_I2C_LOG_TAG,
-                                      IFX_LOG_DEBUG, "<< [invalid NAD] ",
-                                      binary, binary_len, " ");
-                continue;
-            }
-
-            IFX_T1PRIME_LOG_BYTES(driver_logger, IFX_I2C_LOG_TAG, IFX_LOG_INFO,
-                                  "<< ", binary, binary_len, " ");
-
-            block->nad = binary[0];
-            block->pcb = binary[1];
-            information_size = (binary[2] << 8) | binary[3];
-            crc = (binary[4] << 8) | binary[5];
-            free(binary);
-            binary = NULL;
             break;
         }
-#else
-        // Try to read full block at once
-        status = self->_base->_receive(
-            self->_base, 1u + IFX_BLOCK_PROLOGUE_LEN + IFX_BLOCK_EPILOGUE_LEN,
-            &binary, &binary_len);
-
-        // SPI successful read of valid NAD signalizes start of response
-        if (IFX_SUCCESS == status)
-        {
-            // Check if valid NAD
-            bool nad_valid = false;
-            for (size_t offset = 0u;
-                 offset < (IFX_BLOCK_PROLOGUE_LEN + IFX_BLOCK_EPILOGUE_LEN);
-                 offset++)
-            {
-                // Iterate over data to see where response starts
-                if ((binary[1 + offset] != 0x00u) &&
-                    (binary[1 + offset] != 0xffu))
-                {
-                    // Fill up block information based on offset
-                    if (offset > 0u)
-                    {
-                        uint8_t *block_filler = NULL;
-                        size_t block_filler_len = 0u;
-                        status = self->_base->_receive(self->_base, offset,
-                                                       &block_filler,
-                                                       &block_filler_len);
-                        if (status != IFX_SUCCESS)
-                        {
-                            break;
-                        }
-                        if (block_filler == NULL)
-                        {
-                            break;
-                        }
-                        if (block_filler_len != offset)
-                        {
-                            free(block_filler);
-                            block_filler = NULL;
-                            break;
-                        }
-                        memmove(
-                            binary + 1, binary + 1 + offset,
-                            (IFX_BLOCK_PROLOGUE_LEN + IFX_BLOCK_EPILOGUE_LEN) -
-                                offset);
-                        // clang-format off
-                        memcpy(binary + 1 + IFX_BLOCK_PROLOGUE_LEN + IFX_BLOCK_EPILOGUE_LEN - offset, block_filler, offset); // Flawfinder: ignore
-                        // clang-format on
-                        free(block_filler);
-                        block_filler = NULL;
-                    }
-
-                    // Parse information to more suitable format
-                    IFX_T1PRIME_LOG_BYTES(driver_logger, IFX_SPI_LOG_TAG,
-                                          IFX_LOG_INFO, "<< ", binary + 1,
-                                          binary_len - 1, " ");
-                    block->nad = binary[1];
-                    block->pcb = binary[2];
-                    information_size = (binary[3] << 8) | binary[4];
-                    crc = (binary[5] << 8) | binary[6];
-                    free(binary);
-                    binary = NULL;
-                    nad_valid = true;
-                    break;
-                }
-            }
-            if (nad_valid)
-            {
-                break;
-            }
 
-            // Clean up and continue polling
-            free(binary);
-            binary = NULL;
-        }
-#endif
-        // Wait for polling time and try again
-        ifx_timer_t pot_timer;
-        status = ifx_timer_set(&pot_timer,
-                               (uint64_t) (protocol_state->mpot * 1000U));
-        if (status != IFX_SUCCESS)
-        {
-            self->_base->_logger = driver_logger;
-            ifx_timer_destroy(&bwt_timer);
-            return status;
-        }
-        status = ifx_timer_join(&pot_timer);
-        ifx_timer_destroy(&pot_timer);
-        if (status != IFX_SUCCESS)
+        // Wait for remainder of polling time and try again
+        ifx_status_t timer_status = ifx_t1prime_poll_timer_join(protocol_state);
+        if (timer_status != IFX_SUCCESS)
         {
-            self->_base->_logger = driver_logger;
-            ifx_timer_destroy(&bwt_timer);
-            return status;
+            break;
         }
     } while (!ifx_timer_has_elapsed(&bwt_timer));
-    ifx_timer_destroy(&bwt_timer);
-    self->_base->_logger = driver_logger;
-    if (block->nad == 0x00U)
+    if (status != IFX_SUCCESS)
     {
-        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
-                        "polling time exceeded but no data received");
-        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
-                         IFX_TOO_LITTLE_DATA);
+        IFX_T1PRIME_LOG(self->_base->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                        "could not send T=1' block via I2C");
     }
+    ifx_timer_destroy(&bwt_timer);
+#else
+    status = ifx_t1prime_frame_transmit(self, protocol_state, frame_len);
+#endif
+    return status;
+}
 
-    // Check if more data needs to be read
-    if (information_size > 0U)
+/**
+ * \brief Makes sure reusable frame buffer can hold a full block.
+ *
+ * \param[in] protocol_state Protocol state holding frame buffer.
+ * \param[in] information_size Maximum number of bytes in information field.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t
+ifx_t1prime_reserve_frame_buffer(ifx_t1prime_protocol_state_t *protocol_state,
+                                 size_t information_size)
+{
+    size_t required_size =
+        IFX_BLOCK_PROLOGUE_LEN + information_size + IFX_BLOCK_EPILOGUE_LEN;
+    if (protocol_state->frame_buffer_size < required_size)
     {
-        status = self->_base->_receive(self->_base, information_size,
-                                       &block->information,
-                                       &block->information_size);
-        if (status != IFX_SUCCESS)
+        uint8_t *frame_buffer =
+            (uint8_t *) realloc(protocol_state->frame_buffer, required_size);
+        if (frame_buffer == NULL)
         {
-            return status;
-        }
-        if (block->information_size != information_size)
-        {
-            IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
-                            "too little data for T=1' block information field "
-                            "received (expected %zu but was %zu)",
-                            block->information_size, information_size);
-            return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
-                             IFX_TOO_LITTLE_DATA);
-        }
-
-        // Merge previous data with new chunk
-        if (information_size == 1)
-        {
-            uint16_t new_crc = ((crc & 0xffU) << 8) | block->information[0];
-            block->information[0] = (crc & 0xff00U) >> 8;
-            crc = new_crc;
-        }
-        else
-        {
-            uint16_t new_crc = (block->information[information_size - 2] << 8) |
-                               block->information[information_size - 1];
-            memmove(block->information + 2, block->information,
-                    information_size - 2);
-            block->information[0] = (crc & 0xff00U) >> 8;
-            block->information[1] = crc & 0xffU;
-            crc = new_crc;
+            return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSMIT,
+                             IFX_OUT_OF_MEMORY);
         }
+        protocol_state->frame_buffer = frame_buffer;
+        protocol_state->frame_buffer_size = required_size;
     }
+    return IFX_SUCCESS;
+}
 
-    // Validate CRC
-    if (!ifx_t1prime_validate_crc(block, crc))
+/**
+ * \brief Makes sure reusable receive buffer can hold information field and
+ * epilogue of a received block.
+ *
+ * \param[in] protocol_state Protocol state holding receive buffer.
+ * \param[in] information_size Number of bytes in information field.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t
+ifx_t1prime_reserve_receive_buffer(ifx_t1prime_protocol_state_t *protocol_state,
+                                   size_t information_size)
+{
+    size_t required_size = information_size + IFX_BLOCK_EPILOGUE_LEN;
+    if (protocol_state->receive_buffer_size < required_size)
     {
-        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
-                        "T=1' block with invalid CRC received");
-        ifx_t1prime_block_destroy(block);
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_BLOCK_DECODE,
-                         IFX_T1PRIME_INVALID_CRC);
+        uint8_t *receive_buffer =
+            (uint8_t *) realloc(protocol_state->receive_buffer, required_size);
+        if (receive_buffer == NULL)
+        {
+            return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                             IFX_OUT_OF_MEMORY);
+        }
+        protocol_state->receive_buffer = receive_buffer;
+        protocol_state->receive_buffer_size = required_size;
     }
-
-    IFX_T1PRIME_LOG_BLOCK(self->_logger, IFX_LOG_TAG, IFX_LOG_INFO, "<< ",
-                          block);
-
     return IFX_SUCCESS;
 }
 
 /**
- * \brief Sends Block to secure element and reads back response Block.
+ * \brief Completes information field and epilogue of received block.
+ *
+ * \details The receive buffer already holds \p received_len bytes following
+ * the prologue. Missing bytes are read in a second transaction. The block's
+ * information field is a view into the receive buffer that stays valid until
+ * the next block is received.
  *
  * \param[in] self Protocol stack for performing necessary operations.
- * \param[in] block Block object to be send to secure element.
- * \param[out] response_buffer Block object to store received data in.
+ * \param[in] protocol_state Protocol state holding receive buffer.
+ * \param[out] block Block object to store information field in.
+ * \param[in] received_len Number of bytes already in receive buffer.
+ * \param[in] information_size Information field size from prologue.
+ * \param[out] crc Buffer to store received CRC in.
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
  * value in case of error.
  */
-ifx_status_t ifx_t1prime_block_transceive(ifx_protocol_t *self,
-                                          const ifx_t1prime_block_t *block,
-                                          ifx_t1prime_block_t *response_buffer)
+static ifx_status_t
+ifx_t1prime_block_complete(ifx_protocol_t *self,
+                           const ifx_t1prime_protocol_state_t *protocol_state,
+                           ifx_t1prime_block_t *block, size_t received_len,
+                           size_t information_size, uint16_t *crc)
 {
-    // Prepare S(SWR request)
-    ifx_t1prime_block_t swr_request;
-    swr_request.nad = IFX_NAD_HD_TO_SE;
-    swr_request.pcb = IFX_T1PRIME_PCB_S_SWR_REQ;
-    swr_request.information_size = 0;
-    swr_request.information = NULL;
-
-    // Get protocol state with information about BWT, WTX, etc
-    ifx_t1prime_protocol_state_t *protocol_state;
-    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
-    if (status != IFX_SUCCESS)
-    {
-        return status;
-    }
-
-    // Send and receive blocks in loop
-    ifx_t1prime_block_t to_send = *block;
-    uint8_t try_count = 0U;
-    do
-    {
-        // Send block to SE
-        status = ifx_t1prime_block_transmit(self, &to_send);
+    uint8_t *frame = protocol_state->receive_buffer;
+    size_t required_len = information_size + IFX_BLOCK_EPILOGUE_LEN;
+    if (received_len < required_len)
+    {
+        uint8_t *remainder = NULL;
+        size_t remainder_len = 0U;
+        ifx_status_t status =
+            self->_base->_receive(self->_base, required_len - received_len,
+                                  &remainder, &remainder_len);
         if (status != IFX_SUCCESS)
         {
             return status;
         }
-
-        // Read response from SE
-        status = t1prime_block_receive(self, response_buffer);
-
-        // Validate correct block has been received
-        if (IFX_SUCCESS == status)
-        {
-            // Special case S(? request)
-            if (IFX_T1PRIME_PCB_IS_S(block->pcb) &&
-                IFX_T1PRIME_PCB_S_IS_REQ(block->pcb))
-            {
-                // S(? response) must match request type
-                if (IFX_T1PRIME_PCB_IS_S(response_buffer->pcb) &&
-                    (!IFX_T1PRIME_PCB_S_IS_REQ(response_buffer->pcb)))
-                {
-                    if (IFX_T1PRIME_PCB_S_GET_TYPE(block->pcb) ==
-                        IFX_T1PRIME_PCB_S_GET_TYPE(response_buffer->pcb))
-                    {
-                        return status;
-                    }
-                }
-                // R(N(R)) must have correct sequence counter
-                else if (IFX_T1PRIME_PCB_IS_R(response_buffer->pcb))
-                {
-                    if (IFX_T1PRIME_PCB_R_GET_NR(response_buffer->pcb) !=
-                        protocol_state->send_counter)
-                    {
-                        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG,
-                                        IFX_LOG_WARN,
-                                        "Received R(N(R)) block with invalid "
-                                        "sequence counter");
-                        ifx_t1prime_block_destroy(response_buffer);
-                        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
-                                         IFX_T1PRIME_INVALID_BLOCK);
-                    }
-                }
-                // I(N(S), M) invalid
-                else if (IFX_T1PRIME_PCB_IS_I(response_buffer->pcb))
-                {
-                    IFX_T1PRIME_LOG_BLOCK(
-                        self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
-                        "Received unexpected I(N(S), M) block as answer to ",
-                        block);
-                    ifx_t1prime_block_destroy(response_buffer);
-                    return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
-                                     IFX_T1PRIME_INVALID_BLOCK);
-                }
-
-                // Invalidate read status
-                status = IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
-                                   IFX_T1PRIME_INVALID_BLOCK);
-            }
-            else
-            {
-                return status;
-            }
-        }
-
-        // All blocks besides S(? request) trigger retransmissions by sending
-        // R(N(R))
-        if (!IFX_T1PRIME_PCB_IS_S(block->pcb) ||
-            !IFX_T1PRIME_PCB_S_IS_REQ(block->pcb))
-        {
-            to_send.nad = 0x21U;
-            to_send.pcb =
-                IFX_T1PRIME_PCB_R_CRC(protocol_state->receive_counter);
-            to_send.information = NULL;
-            to_send.information_size = 0U;
-        }
-    } while ((++try_count) <= IFX_T1PRIME_BLOCK_TRANSCEIVE_RETRIES);
-    IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
-                    "Giving up block exchange after %d tries",
-                    IFX_T1PRIME_BLOCK_TRANSCEIVE_RETRIES);
-
-    // Reset secure element via S(SWR)
-    IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
-                    "Trying to recover via S(SWR) exchange");
-
-    // Send S(SWR request) to secure element and read back response
-    if (ifx_t1prime_block_transmit(self, &swr_request) == IFX_SUCCESS)
-    {
-        ifx_t1prime_block_t swr_response;
-        t1prime_block_receive(self, &swr_response);
-
-        // Wait for power wake-up time to have secure element reset its state
-        ifx_timer_t pwt_timer;
-        if (ifx_timer_set(&pwt_timer, (uint64_t) (IFX_T1PRIME_DEFAULT_PWT_MS *
-                                                  1000U)) == IFX_SUCCESS)
+        if (remainder_len != (required_len - received_len))
         {
-            ifx_timer_join(&pwt_timer);
-            ifx_timer_destroy(&pwt_timer);
+            IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                            "too little data for T=1' block information field "
+                            "received (expected %zu but was %zu)",
+                            required_len - received_len, remainder_len);
+            free(remainder);
+            return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                             IFX_TOO_LITTLE_DATA);
         }
+        // clang-format off
+        memcpy(frame + received_len, remainder, remainder_len); // Flawfinder: ignore
+        // clang-format on
+        free(remainder);
     }
 
-    return status;
+    // Epilogue directly follows information field
+    *crc = (frame[information_size] << 8) | frame[information_size + 1U];
+    block->information = (information_size == 0U) ? NULL : frame;
+    block->information_size = information_size;
+    return IFX_SUCCESS;
 }
 
+#ifndef IFX_T1PRIME_INTERFACE_I2C
 /**
- * \brief Checks if CRC matches for Block object.
+ * \brief Mask selecting bits 1-7 of every byte in a 64 bit word.
+ */
+#define IFX_T1PRIME_FILLER_MASK UINT64_C(0xfefefefefefefefe)
+
+/**
+ * \brief Returns number of leading SPI filler bytes (0x00 or 0xff).
  *
- * \param[in] block Block object to match CRC against.
- * \param[in] expected Expected CRC to be matched.
- * \return bool \c true if CRC matches, \c false otherwise.
+ * \details Checks 8 bytes at once: A byte is filler if all of its bits are
+ * equal, i.e. if XOR-ing it with itself shifted by one bit yields zero in bits
+ * 1-7. Only the first word containing non-filler data is scanned byte by byte.
+ *
+ * \param[in] data Data to be scanned.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return size_t Number of leading filler bytes.
  */
-bool ifx_t1prime_validate_crc(const ifx_t1prime_block_t *block,
-                              uint16_t expected)
+static size_t ifx_t1prime_count_filler(const uint8_t *data, size_t data_len)
 {
-    // Allocate memory for CRC calculation data (prologue + information field)
-    uint8_t *binary =
-        (uint8_t *) malloc(IFX_BLOCK_PROLOGUE_LEN + block->information_size);
-    if (binary == NULL)
-    {
-        return false;
-    }
-
-    // Put fixed length prologue data
-    binary[0] = block->nad;
-    binary[1] = block->pcb;
-    binary[2] = (block->information_size & 0xff00U) >> 8;
-    binary[3] = block->information_size & 0xffU;
-
-    // Put variable length optional information field
-    if (block->information_size > 0U)
+    size_t i = 0U;
+    for (; (data_len - i) >= sizeof(uint64_t); i += sizeof(uint64_t))
     {
+        uint64_t word;
         // clang-format off
-        memcpy(binary + 4U, block->information, block->information_size); // Flawfinder: ignore
+        memcpy(&word, data + i, sizeof(word)); // Flawfinder: ignore
         // clang-format on
+        if (((word ^ (word << 1)) & IFX_T1PRIME_FILLER_MASK) != 0U)
+        {
+            break;
+        }
     }
-
-    // Actually Validate CRC
-    uint16_t actual =
-        ifx_crc16_ccitt_x25(binary, (1U + 1U + 2U + block->information_size));
-    free(binary);
-    binary = NULL;
-    return actual == expected;
+    for (; i < data_len; i++)
+    {
+        if ((data[i] != 0x00U) && (data[i] != 0xffU))
+        {
+            break;
+        }
+    }
+    return i;
 }
 
 /**
- * \brief Encodes Block to its binary representation.
+ * \brief Appends data to read-ahead ring buffer.
  *
- * \param[in] block Block to be encoded.
- * \param[out] buffer Buffer to store encoded data in.
- * \param[out] buffer_len Pointer for storing number of bytes in \p buffer.
+ * \details Lazily allocates storage for IFX_T1PRIME_SPI_READ_AHEAD_LEN bytes.
+ *
+ * \param[in] ring Ring buffer to append data to.
+ * \param[in] data Data to be appended.
+ * \param[in] data_len Number of bytes in \p data.
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
  * value in case of error.
  */
-ifx_status_t ifx_t1prime_block_encode(const ifx_t1prime_block_t *block,
-                                      uint8_t **buffer, size_t *buffer_len)
+static ifx_status_t ifx_t1prime_ring_buffer_push(ifx_t1prime_ring_buffer_t *ring,
+                                                 const uint8_t *data,
+                                                 size_t data_len)
 {
-    // Allocate memory for binary data
-    *buffer_len = IFX_BLOCK_PROLOGUE_LEN + block->information_size +
-                  IFX_BLOCK_EPILOGUE_LEN;
-    *buffer = (uint8_t *) malloc(*buffer_len);
-    if (*buffer == NULL)
+    if (ring->buffer == NULL)
     {
-        *buffer_len = 0U;
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_BLOCK_ENCODE,
-                         IFX_OUT_OF_MEMORY);
+        ring->buffer = (uint8_t *) malloc(IFX_T1PRIME_SPI_READ_AHEAD_LEN);
+        if (ring->buffer == NULL)
+        {
+            return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                             IFX_OUT_OF_MEMORY);
+        }
+        ring->size = IFX_T1PRIME_SPI_READ_AHEAD_LEN;
+        ring->start = 0U;
+        ring->length = 0U;
     }
-
-    // Encode fixed length prologue
-
-    // Suppress CppCheck defect #10133: False positive: objectIndex
-    // cppcheck-suppress objectIndex
-    (*buffer)[0] = block->nad;
-    // cppcheck-suppress objectIndex
-    (*buffer)[1] = block->pcb;
-    // cppcheck-suppress objectIndex
-    (*buffer)[2] = (block->information_size & 0xff00U) >> 8;
-    // cppcheck-suppress objectIndex
-    (*buffer)[3] = block->information_size & 0x00ffU;
-
-    // Encode variable length optional information field
-    if (block->information_size > 0U)
+    if ((ring->size - ring->length) < data_len)
     {
-        // clang-format off
-        memcpy((*buffer) + 4U, block->information, block->information_size); // Flawfinder: ignore
-        // clang-format on
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                         IFX_PROGRAMMING_ERROR);
+    }
+    for (size_t i = 0U; i < data_len; i++)
+    {
+        ring->buffer[(ring->start + ring->length) % ring->size] = data[i];
+        ring->length++;
     }
-
-    // Encode fixed length epilogue
-    uint16_t crc = ifx_crc16_ccitt_x25(*buffer, (*buffer_len) - 2U);
-    (*buffer)[(*buffer_len) - 2] = (crc & 0xff00U) >> 8;
-    (*buffer)[(*buffer_len) - 1] = crc & 0x00ffU;
-
     return IFX_SUCCESS;
 }
 
 /**
- * \brief Decodes binary data to its member representation in Block object.
+ * \brief Removes data from read-ahead ring buffer.
  *
- * \param[out] block Block object to store values in.
- * \param[in] data Binary data to be decoded.
- * \param[in] data_len Number of bytes in \p data.
- * \return ifx_status_t \c IFX_SUCCESS if successful, any other
- * value in case of error.
+ * \param[in] ring Ring buffer to take data from.
+ * \param[out] buffer Buffer to store data in.
+ * \param[in] buffer_size Maximum number of bytes to be taken.
+ * \return size_t Number of bytes stored in \p buffer.
  */
-ifx_status_t ifx_t1prime_block_decode(ifx_t1prime_block_t *block,
-                                      const uint8_t *data, size_t data_len)
+static size_t ifx_t1prime_ring_buffer_pop(ifx_t1prime_ring_buffer_t *ring,
+                                          uint8_t *buffer, size_t buffer_size)
 {
-    // Minimum length prologue + epilogue
-    if (data_len < (IFX_BLOCK_PROLOGUE_LEN + IFX_BLOCK_EPILOGUE_LEN))
+    size_t popped = buffer_size < ring->length ? buffer_size : ring->length;
+    if (popped == 0U)
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_BLOCK_DECODE,
-                         IFX_TOO_LITTLE_DATA);
+        return 0U;
     }
 
-    // Clear buffers just to be sure
-    block->information = NULL;
-
-    // Parse prologue
-    block->nad = data[0];
-    block->pcb = data[1];
-    block->information_size = (data[2] << 8) | data[3];
-
-    // Check that indicated length matches actual length
-    if (data_len != (IFX_BLOCK_PROLOGUE_LEN + (block->information_size) +
-                     IFX_BLOCK_EPILOGUE_LEN))
+    // Copy in (at most) two contiguous chunks
+    size_t first_chunk = ring->size - ring->start;
+    if (first_chunk > popped)
     {
-        ifx_t1prime_block_destroy(block);
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_BLOCK_DECODE,
-                         IFX_INFORMATION_SIZE_MISMATCH);
+        first_chunk = popped;
     }
+    // clang-format off
+    memcpy(buffer, ring->buffer + ring->start, first_chunk); // Flawfinder: ignore
+    memcpy(buffer + first_chunk, ring->buffer, popped - first_chunk); // Flawfinder: ignore
+    // clang-format on
+    ring->start = (ring->start + popped) % ring->size;
+    ring->length -= popped;
+    return popped;
+}
 
-    // Parse variable length optional information field
-    if (block->information_size > 0U)
+/**
+ * \brief Drops leading SPI filler bytes from read-ahead ring buffer.
+ *
+ * \param[in] ring Ring buffer to drop filler bytes from.
+ */
+static void ifx_t1prime_ring_buffer_skip_filler(ifx_t1prime_ring_buffer_t *ring)
+{
+    while (ring->length > 0U)
     {
-        block->information = (uint8_t *) malloc(block->information_size);
-        if (block->information == NULL)
+        size_t chunk = ring->size - ring->start;
+        if (chunk > ring->length)
         {
-            ifx_t1prime_block_destroy(block);
-            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_BLOCK_DECODE,
-                             IFX_OUT_OF_MEMORY);
+            chunk = ring->length;
+        }
+        size_t filler = ifx_t1prime_count_filler(ring->buffer + ring->start,
+                                                 chunk);
+        ring->start = (ring->start + filler) % ring->size;
+        ring->length -= filler;
+        if (filler < chunk)
+        {
+            break;
         }
-        // clang-format off
-        memcpy(block->information, data + IFX_BLOCK_PROLOGUE_LEN, block->information_size); // Flawfinder: ignore
-        // clang-format on
     }
-    else
+}
+
+/**
+ * \brief Reads data into read-ahead ring buffer until it holds at least the
+ * requested number of bytes.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] ring Ring buffer to fill.
+ * \param[in] required_len Minimum number of bytes required in \p ring.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t ifx_t1prime_ring_buffer_fill(ifx_protocol_t *self,
+                                                 ifx_t1prime_ring_buffer_t *ring,
+                                                 size_t required_len)
+{
+    if (ring->length >= required_len)
     {
-        block->information = NULL;
+        return IFX_SUCCESS;
     }
-
-    // Parse epilogue and validate CRC
-    uint16_t crc = (data[data_len - 2] << 8) | data[data_len - 1];
-    if (!ifx_t1prime_validate_crc(block, crc))
+    uint8_t *data = NULL;
+    size_t data_len = 0U;
+    size_t missing_len = required_len - ring->length;
+    ifx_status_t status =
+        self->_base->_receive(self->_base, missing_len, &data, &data_len);
+    if (status != IFX_SUCCESS)
     {
-        ifx_t1prime_block_destroy(block);
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_BLOCK_DECODE,
-                         IFX_T1PRIME_INVALID_CRC);
+        return status;
     }
-    return IFX_SUCCESS;
+    if (data_len != missing_len)
+    {
+        free(data);
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                         IFX_TOO_LITTLE_DATA);
+    }
+    status = ifx_t1prime_ring_buffer_push(ring, data, data_len);
+    free(data);
+    return status;
 }
+#endif
 
 /**
- * \brief Frees memory associated with Block object (but not object itself).
+ * \brief Waits for T=1' data interrupt.
  *
- * \details Block objects may contain dynamically allocated data (e.g. by
- * ifx_t1prime_block_decode() ). Users would need to manually check which
- * members have been dynamically allocated and free them themselves. Calling
- * this function will ensure that all dynamically allocated members have been
- * freed.
- *
- * \param[in] block Block object whose data shall be freed.
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding interrupt handler.
+ * \param[in] timeout_us Timeout until interrupt has to have triggered (in
+ * [us]).
+ * \return ifx_status_t \c IFX_SUCCESS if interrupt triggered, \c
+ * IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE, IFX_TOO_LITTLE_DATA) if it did
+ * not trigger in time, any other value in case of error.
  */
-void ifx_t1prime_block_destroy(ifx_t1prime_block_t *block)
+static ifx_status_t
+ifx_t1prime_wait_irq(ifx_protocol_t *self,
+                     ifx_t1prime_protocol_state_t *protocol_state,
+                     uint32_t timeout_us)
 {
-    if ((block->information_size != 0U) && (block->information != NULL))
+    ifx_status_t status = protocol_state->irq_handler(self, timeout_us);
+    switch (status)
     {
-        free(block->information);
+    case IFX_T1PRIME_IRQ_TRIGGERED:
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_INFO,
+                        "T=1' data interrupt triggered");
+        return IFX_SUCCESS;
+    case IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IRQ, IFX_T1PRIME_IRQ_NOT_TRIGGERED):
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
+                        "T=1' data interrupt did not trigger in time");
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                         IFX_TOO_LITTLE_DATA);
+    default:
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                        "Error occurred while waiting for T=1' data interrupt");
+        return status;
     }
-    block->information = NULL;
-    block->information_size = 0U;
 }
 
 /**
- * \brief Decodes binary data to its member representation in CIP object.
+ * \brief Polls secure element once for response Block.
  *
- * \param[out] cip CIP object to store values in.
- * \param[in] data Binary data to be decoded.
- * \param[in] data_len Number of bytes in \p data.
- * \return ifx_status_t \c IFX_SUCCESS if successful, any other
- * value in case of error.
+ * \details Waits for the remainder of the polling time before the bus
+ * transaction and starts the polling time for the next one. If the secure
+ * element has started sending, the whole block is read and validated.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding polling information.
+ * \param[out] block Block object to store received data in.
+ * \param[out] received Buffer to store whether a block has been received in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful (even if no block has been
+ * received yet), any other value in case of error.
  */
-ifx_status_t ifx_t1prime_cip_decode(ifx_cip_t *cip, const uint8_t *data,
-                                    size_t data_len)
+static ifx_status_t
+ifx_t1prime_block_poll(ifx_protocol_t *self,
+                       ifx_t1prime_protocol_state_t *protocol_state,
+                       ifx_t1prime_block_t *block, bool *received)
 {
-    // Minimum length check
-    if (data_len < (1U + 1U + 1U + 1U + 1U + 1U))
-    {
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
-                         IFX_TOO_LITTLE_DATA);
-    }
+    *received = false;
 
-    // (Re-) Initialize values for safe calls to cip_destory(CIP*)
-    cip->iin = NULL;
-    cip->plp_len = 0U;
-    cip->plp = NULL;
-    cip->dllp_len = 0U;
-    cip->dllp = NULL;
-    cip->hb_len = 0U;
-    cip->hb = NULL;
+    // Poll for NAD
+    block->nad = 0x00U;
 
-    // Version (1 byte)
-    size_t offset = 0U;
-    cip->version = data[offset++];
+    // Use "shortcut" read to minimize amount of I2C/SPI accesses
+    block->information = NULL;
+    block->information_size = 0U;
+    uint8_t *binary = NULL;
+    size_t binary_len = 0U;
+    uint16_t crc = 0U;
+    size_t information_size = 0U;
 
-    // Issuer identification number (variable length)
-    cip->iin_len = data[offset++];
-    if ((offset + cip->iin_len + 1U + 1U + 1U + 1U) > data_len)
+    // Temporarily disable logging while polling
+    ifx_logger_t *driver_logger = self->_base->_logger;
+    self->_base->_logger = NULL;
+
+#ifdef IFX_T1PRIME_INTERFACE_I2C
+    // Speculatively read expected information field together with prologue
+    size_t speculative_len = 0U;
+    if (protocol_state->speculative_receive)
+    {
+        speculative_len = protocol_state->chained_information_size > 0U
+                              ? protocol_state->chained_information_size
+                              : protocol_state->receive_hint;
+        if (speculative_len > IFX_T1PRIME_MAX_IFS)
+        {
+            speculative_len = IFX_T1PRIME_MAX_IFS;
+        }
+    }
+
+    // Poll at earliest legal moment after last bus transaction
+    ifx_status_t status = ifx_t1prime_poll_timer_join(protocol_state);
+    if (status != IFX_SUCCESS)
     {
-        ifx_t1prime_cip_destroy(cip);
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
-                         IFX_TOO_LITTLE_DATA);
+        self->_base->_logger = driver_logger;
+        return status;
     }
-    if (cip->iin_len > 0U)
+
+    // Try to read full block at once
+    status = self->_base->_receive(
+        self->_base,
+        IFX_BLOCK_PROLOGUE_LEN + speculative_len + IFX_BLOCK_EPILOGUE_LEN,
+        &binary, &binary_len);
+    protocol_state->polls++;
+    ifx_status_t timer_status = ifx_t1prime_poll_timer_start(protocol_state);
+    self->_base->_logger = driver_logger;
+    if (timer_status != IFX_SUCCESS)
     {
-        cip->iin = (uint8_t *) malloc(cip->iin_len);
-        if (cip->iin == NULL)
+        if (binary != NULL)
         {
-            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
-                             IFX_OUT_OF_MEMORY);
+            free(binary);
         }
-        // clang-format off
-        memcpy(cip->iin, data + offset, cip->iin_len); // Flawfinder: ignore
-        // clang-format on
-        offset += cip->iin_len;
+        return timer_status;
     }
 
-    // Physical layer identifier (1 byte)
-    cip->plid = data[offset++];
+    // I2C successful read signalizes start of response
+    if (IFX_SUCCESS == status)
+    {
+        // Short read cannot be parsed, continue polling
+        if (binary_len < (IFX_BLOCK_PROLOGUE_LEN + IFX_BLOCK_EPILOGUE_LEN))
+        {
+            free(binary);
+            binary = NULL;
+        }
+        else
+        {
+            // Retry on invalid NAD
+            uint8_t nad = binary[0];
+            uint8_t dad = (nad >> 4) & 0x0fU;
+            uint8_t sad = nad & 0x0F;
+            if (dad == 0x00U || dad == 0x0fU || sad == 0x00U || sad == 0x0fU)
+            {
+                IFX_T1PRIME_LOG_BYTES(driver_logger, IFX_I2C_LOG_TAG,
+                                      IFX_LOG_DEBUG, "<< [invalid NAD] ",
+                                      binary, binary_len, " ");
+                free(binary);
+                binary = NULL;
+            }
+            else
+            {
+                IFX_T1PRIME_LOG_BYTES(driver_logger, IFX_I2C_LOG_TAG,
+                                      IFX_LOG_INFO, "<< ", binary, binary_len,
+                                      " ");
 
-    // Physical layer parameters (variable length)
-    cip->plp_len = data[offset++];
-    if ((offset + cip->plp_len + 1U + 1U) > data_len)
+                block->nad = binary[0];
+                block->pcb = binary[1];
+                information_size = (binary[2] << 8) | binary[3];
+
+                // Keep data following prologue for completing block
+                binary_len -= IFX_BLOCK_PROLOGUE_LEN;
+            }
+        }
+    }
+#else
+    // Clock in new read-ahead window once all surplus data is used up
+    ifx_t1prime_ring_buffer_t *read_ahead = &protocol_state->read_ahead;
+    ifx_status_t status = IFX_SUCCESS;
+    if (read_ahead->length == 0U)
     {
-        ifx_t1prime_cip_destroy(cip);
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
-                         IFX_TOO_LITTLE_DATA);
+        // Poll at earliest legal moment after last bus transaction
+        status = ifx_t1prime_poll_timer_join(protocol_state);
+        if (IFX_SUCCESS == status)
+        {
+            status = self->_base->_receive(self->_base,
+                                           1U + IFX_T1PRIME_SPI_READ_AHEAD_LEN,
+                                           &binary, &binary_len);
+            protocol_state->polls++;
+            ifx_status_t timer_status =
+                ifx_t1prime_poll_timer_start(protocol_state);
+            if (IFX_SUCCESS == status)
+            {
+                status = timer_status;
+            }
+        }
+        if ((IFX_SUCCESS == status) && (binary_len > 1U))
+        {
+            // First byte of polling read does not belong to response
+            status = ifx_t1prime_ring_buffer_push(read_ahead, binary + 1U,
+                                                  binary_len - 1U);
+        }
+        if (binary != NULL)
+        {
+            free(binary);
+            binary = NULL;
+        }
     }
-    if (cip->plp_len > 0U)
+
+    // SPI first byte that is not filler signalizes start of response
+    if (IFX_SUCCESS == status)
     {
-        cip->plp = (uint8_t *) malloc(cip->plp_len);
-        if (cip->plp == NULL)
+        ifx_t1prime_ring_buffer_skip_filler(read_ahead);
+        if (read_ahead->length > 0U)
         {
-            ifx_t1prime_cip_destroy(cip);
-            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
-                             IFX_OUT_OF_MEMORY);
+            // Top up prologue if window ended right after NAD
+            status = ifx_t1prime_ring_buffer_fill(self, read_ahead,
+                                                  IFX_BLOCK_PROLOGUE_LEN);
+            if (IFX_SUCCESS == status)
+            {
+                uint8_t prologue[IFX_BLOCK_PROLOGUE_LEN];
+                ifx_t1prime_ring_buffer_pop(read_ahead, prologue,
+                                            sizeof(prologue));
+                IFX_T1PRIME_LOG_BYTES(driver_logger, IFX_SPI_LOG_TAG,
+                                      IFX_LOG_INFO, "<< ", prologue,
+                                      sizeof(prologue), " ");
+                block->nad = prologue[0];
+                block->pcb = prologue[1];
+                information_size = (prologue[2] << 8) | prologue[3];
+            }
+            else
+            {
+                // Discard incomplete data and continue polling
+                read_ahead->length = 0U;
+            }
         }
-        // clang-format off
-        memcpy(cip->plp, data + offset, cip->plp_len); // Flawfinder: ignore
-        // clang-format on
-        offset += cip->plp_len;
     }
+    self->_base->_logger = driver_logger;
+#endif
 
-    // Data-link layer parameters (variable length)
-    cip->dllp_len = data[offset++];
-    if ((offset + cip->dllp_len + 1) > data_len)
+    // Continue polling until secure element starts sending
+    if (block->nad == 0x00U)
     {
-        ifx_t1prime_cip_destroy(cip);
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
-                         IFX_TOO_LITTLE_DATA);
+        protocol_state->wasted_polls++;
+        return IFX_SUCCESS;
     }
-    if (cip->dllp_len > 0U)
+    if (protocol_state->latency_pending)
     {
-        cip->dllp = (uint8_t *) malloc(cip->dllp_len);
-        if (cip->dllp == NULL)
-        {
-            ifx_t1prime_cip_destroy(cip);
-            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
-                             IFX_OUT_OF_MEMORY);
-        }
-        // clang-format off
-        memcpy(cip->dllp, data + offset, cip->dllp_len); // Flawfinder: ignore
-        // clang-format on
-        offset += cip->dllp_len;
+        ifx_t1prime_update_latency(protocol_state);
     }
 
-    // Historical bytes (variable length)
-    cip->hb_len = data[offset++];
-    if ((offset + cip->hb_len) != data_len)
+    // Only grows if secure element exceeds IFSD or before activation
+    status = ifx_t1prime_reserve_receive_buffer(protocol_state,
+                                                information_size);
+    if (status != IFX_SUCCESS)
     {
-        ifx_t1prime_cip_destroy(cip);
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
-                         IFX_T1PRIME_INVALID_LEN);
+#ifdef IFX_T1PRIME_INTERFACE_I2C
+        free(binary);
+#endif
+        return status;
     }
-    if (cip->hb_len > 0U)
+
+    // Take information field and epilogue from data read along with prologue
+    size_t received_len = information_size + IFX_BLOCK_EPILOGUE_LEN;
+#ifdef IFX_T1PRIME_INTERFACE_I2C
+    if (binary_len < received_len)
     {
-        cip->hb = (uint8_t *) malloc(cip->hb_len);
-        if (cip->hb == NULL)
+        received_len = binary_len;
+    }
+    // clang-format off
+    memcpy(protocol_state->receive_buffer, binary + IFX_BLOCK_PROLOGUE_LEN, received_len); // Flawfinder: ignore
+    // clang-format on
+    free(binary);
+#else
+    received_len = ifx_t1prime_ring_buffer_pop(
+        &protocol_state->read_ahead, protocol_state->receive_buffer,
+        received_len);
+#endif
+
+    // Read remaining information field and epilogue if necessary
+    status = ifx_t1prime_block_complete(self, protocol_state, block,
+                                        received_len, information_size, &crc);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+
+    // Validate CRC
+    if (!ifx_t1prime_validate_crc(block, crc))
+    {
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
+                        "T=1' block with invalid CRC received");
+        block->information = NULL;
+        block->information_size = 0U;
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_BLOCK_DECODE,
+                         IFX_T1PRIME_INVALID_CRC);
+    }
+
+    IFX_T1PRIME_LOG_BLOCK(self->_logger, IFX_LOG_TAG, IFX_LOG_INFO, "<< ",
+                          block);
+
+    // Remember expected size of next block for speculative receive
+    if (IFX_T1PRIME_PCB_IS_I(block->pcb))
+    {
+        if (IFX_T1PRIME_PCB_I_HAS_MORE(block->pcb))
         {
-            ifx_t1prime_cip_destroy(cip);
-            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
-                             IFX_OUT_OF_MEMORY);
+            protocol_state->chained_information_size = block->information_size;
+        }
+        else
+        {
+            protocol_state->chained_information_size = 0U;
+            protocol_state->receive_hint = 0U;
         }
-        // clang-format off
-        memcpy(cip->hb, data + offset, cip->hb_len); // Flawfinder: ignore
-        // clang-format on
     }
 
-    // Validate CIP that it matches specification
-    ifx_status_t status = ifx_t1prime_cip_validate(cip);
+    *received = true;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Reads Block from secure element.
+ *
+ * \details The information field of the received block is a view into the
+ * receive buffer of the protocol state and stays valid until the next block is
+ * received. It must not be destroyed.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[out] block Block object to store received data in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t t1prime_block_receive(ifx_protocol_t *self,
+                                   ifx_t1prime_block_t *block)
+{
+    // Validate parameters
+    if ((self == NULL) || (block == NULL))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    // Validate protocol stack
+    if ((self->_base == NULL) || (self->_base->_receive == NULL))
+    {
+        IFX_T1PRIME_LOG(
+            self->_logger, IFX_LOG_TAG, IFX_LOG_FATAL,
+            "t1prime_block_receive() called with invalid protocol stack");
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                         IFX_PROTOCOL_STACK_INVALID);
+    }
+
+    // Get protocol state for timing information
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+
+    // Use either BWT or WTX as time until response has to be ready
+    uint32_t bwt = protocol_state->bwt;
+    if (protocol_state->wtx > bwt)
+    {
+        bwt = protocol_state->wtx;
+    }
+    protocol_state->wtx = 0U;
+
+    ifx_timer_t bwt_timer;
+    status = ifx_timer_set(&bwt_timer, (uint32_t) (bwt * 1000U));
     if (status != IFX_SUCCESS)
     {
-        ifx_t1prime_cip_destroy(cip);
-        return status;
+        return status;
+    }
+
+    bool received = false;
+    do
+    {
+        // Use interrupt method if set
+        if (protocol_state->irq_handler != NULL)
+        {
+            status = ifx_t1prime_wait_irq(self, protocol_state, bwt * 1000U);
+            if (status != IFX_SUCCESS)
+            {
+                break;
+            }
+        }
+        status = ifx_t1prime_block_poll(self, protocol_state, block, &received);
+    } while ((IFX_SUCCESS == status) && !received &&
+             !ifx_timer_has_elapsed(&bwt_timer));
+    ifx_timer_destroy(&bwt_timer);
+    if ((IFX_SUCCESS == status) && !received)
+    {
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                        "polling time exceeded but no data received");
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                         IFX_TOO_LITTLE_DATA);
+    }
+    return status;
+}
+
+/**
+ * \brief (Re)starts deadline of current exchange step.
+ *
+ * \param[in] exchange Exchange to set deadline for.
+ * \param[in] timeout_us Time until deadline in [us].
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+static ifx_status_t
+ifx_t1prime_exchange_deadline(ifx_t1prime_exchange_t *exchange,
+                              uint32_t timeout_us)
+{
+    if (exchange->deadline_set)
+    {
+        ifx_timer_destroy(&exchange->deadline);
+        exchange->deadline_set = false;
+    }
+    ifx_status_t status =
+        ifx_timer_set(&exchange->deadline, (uint64_t) timeout_us);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    exchange->deadline_set = true;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Finishes exchange so that its result can be collected.
+ *
+ * \param[in] protocol_state Protocol state holding exchange.
+ * \param[in] status Result of exchange.
+ */
+void ifx_t1prime_exchange_finish(ifx_t1prime_protocol_state_t *protocol_state,
+                                 ifx_status_t status)
+{
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    if (exchange->deadline_set)
+    {
+        ifx_timer_destroy(&exchange->deadline);
+        exchange->deadline_set = false;
+    }
+    exchange->result = status;
+    exchange->step = IFX_T1PRIME_STEP_DONE;
+
+    // Frame buffer may be reused once request has been answered
+    exchange->in_place = false;
+}
+
+/**
+ * \brief Passes outcome of block exchange on to chained transceive operation
+ * (if any).
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ * \param[in] status Outcome of block exchange.
+ */
+static void
+ifx_t1prime_exchange_block_done(ifx_protocol_t *self,
+                                ifx_t1prime_protocol_state_t *protocol_state,
+                                ifx_status_t status)
+{
+    if (protocol_state->exchange.chain)
+    {
+        ifx_t1prime_chain_continue(self, protocol_state, status);
+    }
+    else
+    {
+        ifx_t1prime_exchange_finish(protocol_state, status);
+    }
+}
+
+/**
+ * \brief Handles block that could not be sent.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ * \param[in] status Error that occurred.
+ */
+static void
+ifx_t1prime_exchange_failed(ifx_protocol_t *self,
+                            ifx_t1prime_protocol_state_t *protocol_state,
+                            ifx_status_t status)
+{
+    // Recovery failed as well, report original error
+    if (protocol_state->exchange.recovery_status != IFX_SUCCESS)
+    {
+        status = protocol_state->exchange.recovery_status;
+    }
+    ifx_t1prime_exchange_block_done(self, protocol_state, status);
+}
+
+/**
+ * \brief Performs a single attempt to send block of current exchange.
+ *
+ * \details On success the exchange continues with polling for the response.
+ * If the secure element did not acknowledge the data (I2C), the attempt is
+ * repeated in the next step until the block waiting time is exceeded.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ */
+static void
+ifx_t1prime_exchange_send(ifx_protocol_t *self,
+                          ifx_t1prime_protocol_state_t *protocol_state)
+{
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    ifx_status_t status =
+        ifx_t1prime_frame_transmit(self, protocol_state, exchange->frame_len);
+    if (IFX_SUCCESS == status)
+    {
+        // Use either BWT or WTX as time until response has to be ready
+        uint32_t bwt = protocol_state->bwt;
+        if (protocol_state->wtx > bwt)
+        {
+            bwt = protocol_state->wtx;
+        }
+        protocol_state->wtx = 0U;
+        exchange->receive_timeout_us = bwt * 1000U;
+        status = ifx_t1prime_exchange_deadline(exchange,
+                                               exchange->receive_timeout_us);
+        if (IFX_SUCCESS == status)
+        {
+            exchange->step = IFX_T1PRIME_STEP_RECEIVE;
+            return;
+        }
+    }
+#ifdef IFX_T1PRIME_INTERFACE_I2C
+    else if (!ifx_timer_has_elapsed(&exchange->deadline))
+    {
+        // Try again once polling time has passed
+        return;
+    }
+    else
+    {
+        IFX_T1PRIME_LOG(self->_base->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                        "could not send T=1' block via I2C");
+    }
+#endif
+    ifx_t1prime_exchange_failed(self, protocol_state, status);
+}
+
+/**
+ * \brief Encodes block to be sent in current exchange and sends it.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ */
+static void
+ifx_t1prime_exchange_transmit(ifx_protocol_t *self,
+                              ifx_t1prime_protocol_state_t *protocol_state)
+{
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    ifx_status_t status = ifx_t1prime_block_frame(
+        self, protocol_state, &exchange->to_send, &exchange->frame_len);
+    if (IFX_SUCCESS == status)
+    {
+        // Secure element NACKs writes while busy, retry for at most BWT like
+        // ifx_t1prime_block_transmit(). WTX only extends the time until the
+        // response has to be ready and is applied in
+        // ifx_t1prime_exchange_send().
+        status = ifx_t1prime_exchange_deadline(
+            exchange, (uint32_t) protocol_state->bwt * 1000U);
+    }
+    if (status != IFX_SUCCESS)
+    {
+        ifx_t1prime_exchange_failed(self, protocol_state, status);
+        return;
+    }
+    exchange->step = IFX_T1PRIME_STEP_TRANSMIT;
+    ifx_t1prime_exchange_send(self, protocol_state);
+}
+
+/**
+ * \brief Starts exchange of block set in exchange state.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ */
+void ifx_t1prime_exchange_start(ifx_protocol_t *self,
+                                ifx_t1prime_protocol_state_t *protocol_state)
+{
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    exchange->to_send = exchange->block;
+    exchange->try_count = 0U;
+    exchange->recovery_status = IFX_SUCCESS;
+    ifx_t1prime_exchange_transmit(self, protocol_state);
+}
+
+/**
+ * \brief Validates response (or error) of current exchange and retransmits or
+ * recovers if necessary.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ * \param[in] status \c IFX_SUCCESS if response has been received, error that
+ * occurred otherwise.
+ */
+static void
+ifx_t1prime_exchange_received(ifx_protocol_t *self,
+                              ifx_t1prime_protocol_state_t *protocol_state,
+                              ifx_status_t status)
+{
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    const ifx_t1prime_block_t *block = &exchange->block;
+    ifx_t1prime_block_t *response = &exchange->response;
+
+    // Wait for power wake-up time to have secure element reset its state
+    if (exchange->recovery_status != IFX_SUCCESS)
+    {
+        if (ifx_t1prime_exchange_deadline(
+                exchange, (uint32_t) IFX_T1PRIME_DEFAULT_PWT_MS * 1000U) ==
+            IFX_SUCCESS)
+        {
+            exchange->step = IFX_T1PRIME_STEP_RESET;
+            return;
+        }
+        ifx_t1prime_exchange_block_done(self, protocol_state,
+                                        exchange->recovery_status);
+        return;
+    }
+
+    // Validate correct block has been received
+    if (IFX_SUCCESS == status)
+    {
+        // Special case S(? request)
+        if (IFX_T1PRIME_PCB_IS_S(block->pcb) &&
+            IFX_T1PRIME_PCB_S_IS_REQ(block->pcb))
+        {
+            // S(? response) must match request type
+            if (IFX_T1PRIME_PCB_IS_S(response->pcb) &&
+                (!IFX_T1PRIME_PCB_S_IS_REQ(response->pcb)))
+            {
+                if (IFX_T1PRIME_PCB_S_GET_TYPE(block->pcb) ==
+                    IFX_T1PRIME_PCB_S_GET_TYPE(response->pcb))
+                {
+                    ifx_t1prime_exchange_block_done(self, protocol_state,
+                                                    status);
+                    return;
+                }
+            }
+            // R(N(R)) must have correct sequence counter
+            else if (IFX_T1PRIME_PCB_IS_R(response->pcb))
+            {
+                if (IFX_T1PRIME_PCB_R_GET_NR(response->pcb) !=
+                    protocol_state->send_counter)
+                {
+                    IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
+                                    "Received R(N(R)) block with invalid "
+                                    "sequence counter");
+                    ifx_t1prime_exchange_block_done(
+                        self, protocol_state,
+                        IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                                  IFX_T1PRIME_INVALID_BLOCK));
+                    return;
+                }
+            }
+            // I(N(S), M) invalid
+            else if (IFX_T1PRIME_PCB_IS_I(response->pcb))
+            {
+                IFX_T1PRIME_LOG_BLOCK(
+                    self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
+                    "Received unexpected I(N(S), M) block as answer to ",
+                    block);
+                ifx_t1prime_exchange_block_done(
+                    self, protocol_state,
+                    IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                              IFX_T1PRIME_INVALID_BLOCK));
+                return;
+            }
+
+            // Invalidate read status
+            status = IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                               IFX_T1PRIME_INVALID_BLOCK);
+        }
+        else
+        {
+            ifx_t1prime_exchange_block_done(self, protocol_state, status);
+            return;
+        }
+    }
+
+    // All blocks besides S(? request) trigger retransmissions by sending
+    // R(N(R))
+    if (!IFX_T1PRIME_PCB_IS_S(block->pcb) ||
+        !IFX_T1PRIME_PCB_S_IS_REQ(block->pcb))
+    {
+        exchange->to_send.nad = IFX_NAD_HD_TO_SE;
+        exchange->to_send.pcb =
+            IFX_T1PRIME_PCB_R_CRC(protocol_state->receive_counter);
+        exchange->to_send.information = NULL;
+        exchange->to_send.information_size = 0U;
+    }
+    if ((++exchange->try_count) <= IFX_T1PRIME_BLOCK_TRANSCEIVE_RETRIES)
+    {
+        ifx_t1prime_exchange_transmit(self, protocol_state);
+        return;
+    }
+    IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                    "Giving up block exchange after %d tries",
+                    IFX_T1PRIME_BLOCK_TRANSCEIVE_RETRIES);
+
+    // Reset secure element via S(SWR)
+    IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
+                    "Trying to recover via S(SWR) exchange");
+    ifx_t1prime_notify_reset(protocol_state);
+    exchange->recovery_status = status;
+    exchange->to_send.nad = IFX_NAD_HD_TO_SE;
+    exchange->to_send.pcb = IFX_T1PRIME_PCB_S_SWR_REQ;
+    exchange->to_send.information = NULL;
+    exchange->to_send.information_size = 0U;
+    ifx_t1prime_exchange_transmit(self, protocol_state);
+}
+
+/**
+ * \brief Polls secure element for response of current exchange.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ */
+static void
+ifx_t1prime_exchange_receive(ifx_protocol_t *self,
+                             ifx_t1prime_protocol_state_t *protocol_state)
+{
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    bool received;
+    ifx_status_t status = ifx_t1prime_block_poll(
+        self, protocol_state, &exchange->response, &received);
+    if ((IFX_SUCCESS == status) && !received)
+    {
+        // Continue polling until block waiting time is exceeded
+        if (!ifx_timer_has_elapsed(&exchange->deadline))
+        {
+            return;
+        }
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                        "polling time exceeded but no data received");
+        status = IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                           IFX_TOO_LITTLE_DATA);
+    }
+    ifx_t1prime_exchange_received(self, protocol_state, status);
+}
+
+/**
+ * \brief Performs next step of current exchange.
+ *
+ * \details Waits for the remainder of the step's waiting time (if any), so
+ * non-blocking callers only call this function once the waiting time has
+ * passed.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ */
+static void
+ifx_t1prime_exchange_step(ifx_protocol_t *self,
+                          ifx_t1prime_protocol_state_t *protocol_state)
+{
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    ifx_status_t status;
+    switch (exchange->step)
+    {
+    case IFX_T1PRIME_STEP_TRANSMIT:
+        // Wait for remainder of polling time and try again
+        status = ifx_t1prime_poll_timer_join(protocol_state);
+        if (status != IFX_SUCCESS)
+        {
+            ifx_t1prime_exchange_failed(self, protocol_state, status);
+            break;
+        }
+        ifx_t1prime_exchange_send(self, protocol_state);
+        break;
+    case IFX_T1PRIME_STEP_RECEIVE:
+        ifx_t1prime_exchange_receive(self, protocol_state);
+        break;
+    case IFX_T1PRIME_STEP_RESET:
+        if (!ifx_timer_has_elapsed(&exchange->deadline))
+        {
+            ifx_timer_join(&exchange->deadline);
+        }
+        ifx_t1prime_exchange_block_done(self, protocol_state,
+                                        exchange->recovery_status);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * \brief Performs all steps of current exchange in a blocking manner.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ * \return ifx_status_t Result of exchange.
+ */
+ifx_status_t
+ifx_t1prime_exchange_run(ifx_protocol_t *self,
+                         ifx_t1prime_protocol_state_t *protocol_state)
+{
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    while (exchange->step != IFX_T1PRIME_STEP_DONE)
+    {
+        // Use interrupt method if set
+        if ((IFX_T1PRIME_STEP_RECEIVE == exchange->step) &&
+            (protocol_state->irq_handler != NULL))
+        {
+            ifx_status_t status = ifx_t1prime_wait_irq(
+                self, protocol_state, exchange->receive_timeout_us);
+            if (status != IFX_SUCCESS)
+            {
+                ifx_t1prime_exchange_received(self, protocol_state, status);
+                continue;
+            }
+        }
+        ifx_t1prime_exchange_step(self, protocol_state);
+    }
+    return exchange->result;
+}
+
+/**
+ * \brief Sends Block to secure element and reads back response Block.
+ *
+ * \details The information field of the received block is a view into the
+ * receive buffer of the protocol state and stays valid until the next block is
+ * received. It must not be destroyed.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] block Block object to be send to secure element.
+ * \param[out] response_buffer Block object to store received data in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_block_transceive(ifx_protocol_t *self,
+                                          const ifx_t1prime_block_t *block,
+                                          ifx_t1prime_block_t *response_buffer)
+{
+    // Get protocol state with information about BWT, WTX, etc
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+
+    // Cannot interrupt non-blocking exchange
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    if (exchange->step != IFX_T1PRIME_STEP_IDLE)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_TRANSCEIVE,
+                         IFX_INVALID_STATE);
+    }
+
+    // Send and receive blocks until done
+    exchange->chain = false;
+    exchange->in_place = false;
+    exchange->block = *block;
+    ifx_t1prime_exchange_start(self, protocol_state);
+    status = ifx_t1prime_exchange_run(self, protocol_state);
+    exchange->step = IFX_T1PRIME_STEP_IDLE;
+    if (IFX_SUCCESS == status)
+    {
+        *response_buffer = exchange->response;
+    }
+    return status;
+}
+
+/**
+ * \brief Implementation of ifx_t1prime_transceive_begin()
+ * called with lock held.
+ */
+static ifx_status_t ifx_t1prime_transceive_begin_unlocked(ifx_protocol_t *self,
+                                                          const uint8_t *data,
+                                                          size_t data_len)
+{
+    // Validate parameters
+    if (self == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_BEGIN,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    if ((data == NULL) || (data_len == 0U))
+    {
+        IFX_T1PRIME_LOG(
+            self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+            "Illegal NULL parameter given to ifx_t1prime_transceive_begin()");
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_BEGIN,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    if (exchange->step != IFX_T1PRIME_STEP_IDLE)
+    {
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                        "Previous T=1' exchange has not been completed");
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_BEGIN,
+                         IFX_INVALID_STATE);
+    }
+
+    // Collect response in dynamically growing buffer
+    exchange->dynamic_sink.buffer = NULL;
+    exchange->dynamic_sink.buffer_len = 0U;
+    exchange->dynamic_sink.buffer_size = 0U;
+    ifx_t1prime_chain_begin(self, protocol_state, data, data_len,
+                            ifx_t1prime_dynamic_sink, &exchange->dynamic_sink);
+
+    // First block could not be sent at all
+    if ((IFX_T1PRIME_STEP_DONE == exchange->step) &&
+        (exchange->result != IFX_SUCCESS))
+    {
+        if (exchange->dynamic_sink.buffer != NULL)
+        {
+            free(exchange->dynamic_sink.buffer);
+            exchange->dynamic_sink.buffer = NULL;
+        }
+        exchange->step = IFX_T1PRIME_STEP_IDLE;
+        return exchange->result;
+    }
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Starts non-blocking exchange of data via Global Platform T=1'
+ * protocol.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] data Data to be send via protocol (must stay valid until
+ * ifx_t1prime_transceive_complete() has been called).
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if exchange has been started, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_transceive_begin(ifx_protocol_t *self,
+                                          const uint8_t *data, size_t data_len)
+{
+    ifx_status_t status;
+    IFX_T1PRIME_LOCKED(self, status,
+                       ifx_t1prime_transceive_begin_unlocked(self, data,
+                                                             data_len));
+    return status;
+}
+
+/**
+ * \brief Implementation of ifx_t1prime_transceive_poll() called with lock held.
+ */
+static ifx_status_t
+ifx_t1prime_transceive_poll_unlocked(ifx_protocol_t *self,
+                                     ifx_t1prime_wait_t *wait)
+{
+    // Validate parameters
+    if (self == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_POLL,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    if (IFX_T1PRIME_STEP_IDLE == exchange->step)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_POLL,
+                         IFX_INVALID_STATE);
+    }
+
+    // Only perform next step once its waiting time has passed
+    const ifx_timer_t *timer = NULL;
+    if (IFX_T1PRIME_STEP_RESET == exchange->step)
+    {
+        timer = &exchange->deadline;
+    }
+    else if (protocol_state->poll_timer_set)
+    {
+        timer = &protocol_state->poll_timer;
+    }
+    bool stepped = false;
+    if ((exchange->step != IFX_T1PRIME_STEP_DONE) &&
+        ((timer == NULL) || ifx_timer_has_elapsed(timer)))
+    {
+        ifx_t1prime_exchange_step(self, protocol_state);
+        stepped = true;
+    }
+    if (IFX_T1PRIME_STEP_DONE == exchange->step)
+    {
+        if (wait != NULL)
+        {
+            wait->timeout_us = 0U;
+            wait->irq = false;
+        }
+        return IFX_SUCCESS;
+    }
+
+    // Tell event loop when to call again
+    if (wait != NULL)
+    {
+        wait->irq = (IFX_T1PRIME_STEP_RECEIVE == exchange->step) &&
+                    (protocol_state->irq_handler != NULL);
+        if (IFX_T1PRIME_STEP_RESET == exchange->step)
+        {
+            wait->timeout_us =
+                (uint32_t) ifx_timer_remaining(&exchange->deadline);
+        }
+        else if (wait->irq && stepped)
+        {
+            // Data interrupt signals response, no need to poll
+            wait->timeout_us = exchange->receive_timeout_us;
+        }
+        else if (protocol_state->poll_timer_set)
+        {
+            // Sleep exactly until minimum polling time has passed
+            wait->timeout_us =
+                (uint32_t) ifx_timer_remaining(&protocol_state->poll_timer);
+        }
+        else
+        {
+            wait->timeout_us = protocol_state->poll_interval;
+        }
+    }
+    return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_POLL,
+                     IFX_T1PRIME_PENDING);
+}
+
+/**
+ * \brief Drives non-blocking exchange started by
+ * ifx_t1prime_transceive_begin().
+ *
+ * \details Performs at most one bus transaction and only if its waiting time
+ * has passed, so this function never blocks.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[out] wait Buffer to store waiting information for next call in
+ * (might be \c NULL).
+ * \return ifx_status_t \c IFX_SUCCESS if exchange is done, \c
+ * IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_POLL, IFX_T1PRIME_PENDING) if
+ * it is still in progress, any other value in case of error.
+ */
+ifx_status_t ifx_t1prime_transceive_poll(ifx_protocol_t *self,
+                                         ifx_t1prime_wait_t *wait)
+{
+    ifx_status_t status;
+    IFX_T1PRIME_LOCKED(self, status,
+                       ifx_t1prime_transceive_poll_unlocked(self, wait));
+    return status;
+}
+
+/**
+ * \brief Implementation of ifx_t1prime_transceive_complete()
+ * called with lock held.
+ */
+static ifx_status_t
+ifx_t1prime_transceive_complete_unlocked(ifx_protocol_t *self,
+                                         uint8_t **response,
+                                         size_t *response_len)
+{
+    // Validate parameters
+    if (self == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_COMPLETE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    if ((response == NULL) || (response_len == NULL))
+    {
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                        "Illegal NULL parameter given to "
+                        "ifx_t1prime_transceive_complete()");
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_COMPLETE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    ifx_t1prime_exchange_t *exchange = &protocol_state->exchange;
+    if (exchange->step != IFX_T1PRIME_STEP_DONE)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_TRANSCEIVE_COMPLETE,
+                         IFX_INVALID_STATE);
+    }
+
+    // Hand over collected response
+    *response = NULL;
+    *response_len = 0U;
+    status = exchange->result;
+    if (IFX_SUCCESS == status)
+    {
+        *response = exchange->dynamic_sink.buffer;
+        *response_len = exchange->dynamic_sink.buffer_len;
+    }
+    else if (exchange->dynamic_sink.buffer != NULL)
+    {
+        free(exchange->dynamic_sink.buffer);
+    }
+    exchange->dynamic_sink.buffer = NULL;
+    exchange->dynamic_sink.buffer_len = 0U;
+    exchange->dynamic_sink.buffer_size = 0U;
+    exchange->step = IFX_T1PRIME_STEP_IDLE;
+    return status;
+}
+
+/**
+ * \brief Collects result of exchange started by
+ * ifx_t1prime_transceive_begin().
+ *
+ * \details Must only be called once ifx_t1prime_transceive_poll() returned
+ * \c IFX_SUCCESS. Afterwards a new exchange can be started.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[out] response Buffer to store response in (must be freed by caller).
+ * \param[out] response_len Buffer to store number of received bytes in.
+ * \return ifx_status_t Result of exchange (\c IFX_SUCCESS if successful).
+ */
+ifx_status_t ifx_t1prime_transceive_complete(ifx_protocol_t *self,
+                                             uint8_t **response,
+                                             size_t *response_len)
+{
+    ifx_status_t status;
+    IFX_T1PRIME_LOCKED(self, status,
+                       ifx_t1prime_transceive_complete_unlocked(self, response,
+                                                                response_len));
+    return status;
+}
+
+/**
+ * \brief Checks if CRC matches for Block object.
+ *
+ * \param[in] block Block object to match CRC against.
+ * \param[in] expected Expected CRC to be matched.
+ * \return bool \c true if CRC matches, \c false otherwise.
+ */
+bool ifx_t1prime_validate_crc(const ifx_t1prime_block_t *block,
+                              uint16_t expected)
+{
+    // Fixed length prologue data
+    uint8_t prologue[IFX_BLOCK_PROLOGUE_LEN];
+    prologue[0] = block->nad;
+    prologue[1] = block->pcb;
+    prologue[2] = (block->information_size & 0xff00U) >> 8;
+    prologue[3] = block->information_size & 0xffU;
+
+    // Actually validate CRC over prologue and information field in place
+    uint16_t actual = ifx_crc16_ccitt_x25_init();
+    actual = ifx_crc16_ccitt_x25_update(actual, prologue, sizeof(prologue));
+    if (block->information_size > 0U)
+    {
+        actual = ifx_crc16_ccitt_x25_update(actual, block->information,
+                                            block->information_size);
+    }
+    actual = ifx_crc16_ccitt_x25_final(actual);
+    return actual == expected;
+}
+
+/**
+ * \brief Encodes Block to its binary representation.
+ *
+ * \param[in] block Block to be encoded.
+ * \param[out] buffer Buffer to store encoded data in.
+ * \param[out] buffer_len Pointer for storing number of bytes in \p buffer.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_block_encode(const ifx_t1prime_block_t *block,
+                                      uint8_t **buffer, size_t *buffer_len)
+{
+    // Allocate memory for binary data
+    size_t encoded_len = IFX_BLOCK_PROLOGUE_LEN + block->information_size +
+                         IFX_BLOCK_EPILOGUE_LEN;
+    *buffer = (uint8_t *) malloc(encoded_len);
+    if (*buffer == NULL)
+    {
+        *buffer_len = 0U;
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_BLOCK_ENCODE,
+                         IFX_OUT_OF_MEMORY);
+    }
+
+    ifx_status_t status =
+        ifx_t1prime_block_encode_into(block, *buffer, encoded_len, buffer_len);
+    if (status != IFX_SUCCESS)
+    {
+        free(*buffer);
+        *buffer = NULL;
+        *buffer_len = 0U;
+    }
+    return status;
+}
+
+/**
+ * \brief Encodes Block to its binary representation into a caller provided
+ * buffer.
+ *
+ * \details Same as ifx_t1prime_block_encode() but does not allocate any
+ * memory. Used to frame blocks directly into a reusable frame buffer.
+ *
+ * \param[in] block Block to be encoded.
+ * \param[out] buffer Buffer to store encoded data in.
+ * \param[in] buffer_size Number of bytes available in \p buffer.
+ * \param[out] buffer_len Pointer for storing number of bytes written to \p
+ * buffer.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_block_encode_into(const ifx_t1prime_block_t *block,
+                                           uint8_t *buffer, size_t buffer_size,
+                                           size_t *buffer_len)
+{
+    // Check that encoded block fits into buffer
+    size_t encoded_len = IFX_BLOCK_PROLOGUE_LEN + block->information_size +
+                         IFX_BLOCK_EPILOGUE_LEN;
+    if ((buffer == NULL) || (buffer_size < encoded_len))
+    {
+        *buffer_len = 0U;
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_BLOCK_ENCODE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    // Encode fixed length prologue
+    buffer[0] = block->nad;
+    buffer[1] = block->pcb;
+    buffer[2] = (block->information_size & 0xff00U) >> 8;
+    buffer[3] = block->information_size & 0x00ffU;
+
+    // Encode variable length optional information field (unless already
+    // encoded in place)
+    if ((block->information_size > 0U) &&
+        (block->information != buffer + IFX_BLOCK_PROLOGUE_LEN))
+    {
+        // clang-format off
+        memcpy(buffer + 4U, block->information, block->information_size); // Flawfinder: ignore
+        // clang-format on
+    }
+
+    // Encode fixed length epilogue
+    uint16_t crc = ifx_crc16_ccitt_x25(buffer, encoded_len - 2U);
+    buffer[encoded_len - 2U] = (crc & 0xff00U) >> 8;
+    buffer[encoded_len - 1U] = crc & 0x00ffU;
+
+    *buffer_len = encoded_len;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Decodes binary data to its member representation in Block object.
+ *
+ * \details Does not allocate any memory: The information field of \p block
+ * is a view into \p data and only valid as long as \p data is.
+ *
+ * \param[out] block Block object to store values in.
+ * \param[in] data Binary data to be decoded.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_block_decode(ifx_t1prime_block_t *block,
+                                      const uint8_t *data, size_t data_len)
+{
+    // Minimum length prologue + epilogue
+    if (data_len < (IFX_BLOCK_PROLOGUE_LEN + IFX_BLOCK_EPILOGUE_LEN))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_BLOCK_DECODE,
+                         IFX_TOO_LITTLE_DATA);
+    }
+
+    // Clear buffers just to be sure
+    block->information = NULL;
+
+    // Parse prologue
+    block->nad = data[0];
+    block->pcb = data[1];
+    block->information_size = (data[2] << 8) | data[3];
+
+    // Check that indicated length matches actual length
+    if (data_len != (IFX_BLOCK_PROLOGUE_LEN + (block->information_size) +
+                     IFX_BLOCK_EPILOGUE_LEN))
+    {
+        block->information_size = 0U;
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_BLOCK_DECODE,
+                         IFX_INFORMATION_SIZE_MISMATCH);
+    }
+
+    // Parse variable length optional information field in place
+    if (block->information_size > 0U)
+    {
+        block->information = (uint8_t *) (data + IFX_BLOCK_PROLOGUE_LEN);
+    }
+
+    // Parse epilogue and validate CRC
+    uint16_t crc = (data[data_len - 2] << 8) | data[data_len - 1];
+    if (!ifx_t1prime_validate_crc(block, crc))
+    {
+        block->information = NULL;
+        block->information_size = 0U;
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_BLOCK_DECODE,
+                         IFX_T1PRIME_INVALID_CRC);
+    }
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Frees memory associated with Block object (but not object itself).
+ *
+ * \details Only for blocks whose information field has been dynamically
+ * allocated by the caller. Decoded and received blocks borrow their
+ * information field (see ifx_t1prime_block_decode()) and must not be
+ * destroyed.
+ *
+ * \param[in] block Block object whose data shall be freed.
+ */
+void ifx_t1prime_block_destroy(ifx_t1prime_block_t *block)
+{
+    if ((block->information_size != 0U) && (block->information != NULL))
+    {
+        free(block->information);
+    }
+    block->information = NULL;
+    block->information_size = 0U;
+}
+
+/**
+ * \brief Decodes binary data to its member representation in CIP object.
+ *
+ * \param[out] cip CIP object to store values in.
+ * \param[in] data Binary data to be decoded.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_cip_decode(ifx_cip_t *cip, const uint8_t *data,
+                                    size_t data_len)
+{
+    // Minimum length check
+    if (data_len < (1U + 1U + 1U + 1U + 1U + 1U))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
+                         IFX_TOO_LITTLE_DATA);
+    }
+
+    // (Re-) Initialize values for safe calls to cip_destory(CIP*)
+    cip->iin = NULL;
+    cip->plp_len = 0U;
+    cip->plp = NULL;
+    cip->dllp_len = 0U;
+    cip->dllp = NULL;
+    cip->hb_len = 0U;
+    cip->hb = NULL;
+
+    // Version (1 byte)
+    size_t offset = 0U;
+    cip->version = data[offset++];
+
+    // Issuer identification number (variable length)
+    cip->iin_len = data[offset++];
+    if ((offset + cip->iin_len + 1U + 1U + 1U + 1U) > data_len)
+    {
+        ifx_t1prime_cip_destroy(cip);
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
+                         IFX_TOO_LITTLE_DATA);
+    }
+    if (cip->iin_len > 0U)
+    {
+        cip->iin = (uint8_t *) malloc(cip->iin_len);
+        if (cip->iin == NULL)
+        {
+            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
+                             IFX_OUT_OF_MEMORY);
+        }
+        // clang-format off
+        memcpy(cip->iin, data + offset, cip->iin_len); // Flawfinder: ignore
+        // clang-format on
+        offset += cip->iin_len;
+    }
+
+    // Physical layer identifier (1 byte)
+    cip->plid = data[offset++];
+
+    // Physical layer parameters (variable length)
+    cip->plp_len = data[offset++];
+    if ((offset + cip->plp_len + 1U + 1U) > data_len)
+    {
+        ifx_t1prime_cip_destroy(cip);
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
+                         IFX_TOO_LITTLE_DATA);
+    }
+    if (cip->plp_len > 0U)
+    {
+        cip->plp = (uint8_t *) malloc(cip->plp_len);
+        if (cip->plp == NULL)
+        {
+            ifx_t1prime_cip_destroy(cip);
+            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
+                             IFX_OUT_OF_MEMORY);
+        }
+        // clang-format off
+        memcpy(cip->plp, data + offset, cip->plp_len); // Flawfinder: ignore
+        // clang-format on
+        offset += cip->plp_len;
+    }
+
+    // Data-link layer parameters (variable length)
+    cip->dllp_len = data[offset++];
+    if ((offset + cip->dllp_len + 1) > data_len)
+    {
+        ifx_t1prime_cip_destroy(cip);
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
+                         IFX_TOO_LITTLE_DATA);
+    }
+    if (cip->dllp_len > 0U)
+    {
+        cip->dllp = (uint8_t *) malloc(cip->dllp_len);
+        if (cip->dllp == NULL)
+        {
+            ifx_t1prime_cip_destroy(cip);
+            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
+                             IFX_OUT_OF_MEMORY);
+        }
+        // clang-format off
+        memcpy(cip->dllp, data + offset, cip->dllp_len); // Flawfinder: ignore
+        // clang-format on
+        offset += cip->dllp_len;
+    }
+
+    // Historical bytes (variable length)
+    cip->hb_len = data[offset++];
+    if ((offset + cip->hb_len) != data_len)
+    {
+        ifx_t1prime_cip_destroy(cip);
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
+                         IFX_T1PRIME_INVALID_LEN);
+    }
+    if (cip->hb_len > 0U)
+    {
+        cip->hb = (uint8_t *) malloc(cip->hb_len);
+        if (cip->hb == NULL)
+        {
+            ifx_t1prime_cip_destroy(cip);
+            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_DECODE,
+                             IFX_OUT_OF_MEMORY);
+        }
+        // clang-format off
+        memcpy(cip->hb, data + offset, cip->hb_len); // Flawfinder: ignore
+        // clang-format on
+    }
+
+    // Validate CIP that it matches specification
+    ifx_status_t status = ifx_t1prime_cip_validate(cip);
+    if (status != IFX_SUCCESS)
+    {
+        ifx_t1prime_cip_destroy(cip);
+        return status;
+    }
+
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Validates CIP object by checking all member values against GP
+ * specification.
+ *
+ * \param[in] cip CIP object to be validated.
+ * \return ifx_status_t \c IFX_SUCCESS if valid CIP, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_cip_validate(const ifx_cip_t *cip)
+{
+    // Issuer identification number must be 3 or 4 bytes long
+    if ((cip->iin_len < 3U) || (cip->iin_len > 4U))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_VALIDATE,
+                         IFX_T1PRIME_INVALID_LEN);
+    }
+
+    // SPI physical layer parameters must be at least 12 bytes long
+    if (cip->plid == IFX_T1PRIME_PLID_SPI)
+    {
+        if (cip->plp_len < (1U + 1U + 2U + 1U + 1U + 2U + 2U + 2U))
+        {
+            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_VALIDATE,
+                             IFX_TOO_LITTLE_DATA);
+        }
+    }
+    // I2C physical layer parameters must be at least 8 bytes long
+    else if (cip->plid == IFX_T1PRIME_PLID_I2C)
+    {
+        if (cip->plp_len < (1U + 1U + 2U + 1U + 1U + 2U))
+        {
+            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_VALIDATE,
+                             IFX_TOO_LITTLE_DATA);
+        }
+    }
+    // Unkown physical layer identifier
+    else
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_VALIDATE,
+                         IFX_T1PRIME_INVALID_PLID);
+    }
+
+    // Data-link layer parameters must be at least 4 bytes long
+    if (cip->dllp_len < (2U + 2U))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_VALIDATE,
+                         IFX_TOO_LITTLE_DATA);
+    }
+
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Frees memory associated with CIP object (but not object itself)
+ *
+ * \details CIP objects will most likely be populated by
+ * ifx_t1prime_cip_decode() . Users would need to manually check which members
+ * have been dynamically allocated and free them themselves. Calling this
+ * function will ensure that all dynamically allocated members have been freed.
+ *
+ * \code
+ *      uint8_t encoded[] = {...};
+ *      size_t encoded_len = sizeof(encoded);
+ *      ifx_cip_t cip;
+ *      // Might allocate several buffers
+ *      ifx_t1prime_cip_decode(&cip, encoded, encoded_len);
+ *      ifx_t1prime_cip_destroy(&cip);
+ * \endcode
+ *
+ * \param[in] cip CIP object whose data shall be freed.
+ */
+void ifx_t1prime_cip_destroy(ifx_cip_t *cip)
+{
+    // Issuer identification number
+    if ((cip->iin_len > 0U) && (cip->iin != NULL))
+    {
+        free(cip->iin);
+    }
+    cip->iin_len = 0U;
+    cip->iin = NULL;
+
+    // Physical layer parameters
+    if ((cip->plp_len > 0U) && (cip->plp != NULL))
+    {
+        free(cip->plp);
+    }
+    cip->plp_len = 0U;
+    cip->plp = NULL;
+
+    // Data-link layer parameters
+    if ((cip->dllp_len > 0U) && (cip->dllp != NULL))
+    {
+        free(cip->dllp);
+    }
+    cip->dllp_len = 0U;
+    cip->dllp = NULL;
+
+    // Historical bytes
+    if ((cip->hb_len > 0U) && (cip->hb != NULL))
+    {
+        free(cip->hb);
+    }
+    cip->hb_len = 0U;
+    cip->hb = NULL;
+}
+
+/**
+ * \brief Decodes binary data to its member representation in DLLP object.
+ *
+ * \param[out] dllp DLLP object to store values in.
+ * \param[in] data Binary data to be decoded.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_dllp_decode(ifx_dllp_t *dllp, const uint8_t *encoded,
+                                     size_t encoded_len)
+{
+    if (encoded_len < (2U + 2U))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_DLLP_DECODE,
+                         IFX_TOO_LITTLE_DATA);
+    }
+    dllp->bwt = (encoded[0] << 8) | encoded[1];
+    dllp->ifsc = (encoded[2] << 8) | encoded[3];
+
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Frees memory associated with DLLP object (but not object itself).
+ *
+ * \details This function does nothing at the moment but keeps the interface
+ * uniform accross all datastructures.
+ *
+ * \param[in] dllp DLLP object whose data shall be freed.
+ */
+void ifx_t1prime_dllp_destroy(ifx_dllp_t *dllp)
+{
+    // Ignore unused parameter
+    (void) dllp;
+}
+
+#ifdef IFX_T1PRIME_INTERFACE_I2C
+/**
+ * \brief Decodes binary data to its member representation in PLP object.
+ *
+ * \param[out] plp PLP object to store values in.
+ * \param[in] data Binary data to be decoded.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_plp_decode(ifx_plp_t *plp, const uint8_t *encoded,
+                                    size_t encoded_len)
+{
+    if (encoded_len < (1U + 1U + 2U + 1U + 1U + 2U))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_PLP_DECODE,
+                         IFX_TOO_LITTLE_DATA);
+    }
+    plp->configuration = encoded[0];
+    plp->pwt = encoded[1];
+    plp->mcf = (encoded[2] << 8) | encoded[3];
+    plp->pst = encoded[4];
+    plp->mpot = encoded[5];
+    plp->rwgt = (encoded[6] << 8) | encoded[7];
+
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Frees memory associated with PLP object (but not object itself).
+ *
+ * \details This function does nothing at the moment but keeps the interface
+ * uniform accross all datastructures.
+ *
+ * \param[in] plp PLP object whose data shall be freed.
+ */
+void ifx_t1prime_plp_destroy(ifx_plp_t *plp)
+{
+    // Ignore unused parameter
+    (void) plp;
+}
+#else
+/**
+ * \brief Decodes binary data to its member representation in PLP object.
+ *
+ * \param[out] plp PLP object to store values in.
+ * \param[in] data Binary data to be decoded.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_plp_decode(ifx_plp_t *plp, const uint8_t *encoded,
+                                    size_t encoded_len)
+{
+    if (encoded_len < (1u + 1u + 2u + 1u + 1u + 2u + 2u + 2u))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_PLP_DECODE,
+                         IFX_TOO_LITTLE_DATA);
+    }
+    plp->configuration = encoded[0];
+    plp->pwt = encoded[1];
+    plp->mcf = (encoded[2] << 8) | encoded[3];
+    plp->pst = encoded[4];
+    plp->mpot = encoded[5];
+    plp->segt = (encoded[6] << 8) | encoded[7];
+    plp->seal = (encoded[8] << 8) | encoded[9];
+    plp->wut = (encoded[10] << 8) | encoded[11];
+
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Frees memory associated with PLP object (but not object itself).
+ *
+ * \details This function does nothing at the moment but keeps the interface
+ * uniform across all datastructures.
+ *
+ * \param[in] plp PLP object whose data shall be freed.
+ */
+void ifx_t1prime_plp_destroy(ifx_plp_t *plp)
+{
+    // Ignore unused parameter
+    (void) plp;
+}
+#endif
+
+/**
+ * \brief Decodes binary information field size (IFS).
+ *
+ * \param[out] ifs_buffer Buffer to store IFS value in.
+ * \param[in] data Binary IFS data.
+ * \param[in] data_len Number of bytes in \p data.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_ifs_decode(size_t *ifs_buffer, const uint8_t *data,
+                                    size_t data_len)
+{
+    // Check that length of binary data is valid
+    if ((data_len < 1U) || (data_len > 2U))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IFS_DECODE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    // Decode data
+    if (data_len == 1U)
+    {
+        *ifs_buffer = data[0];
+    }
+    else
+    {
+        *ifs_buffer = (data[0] << 8) | data[1];
+    }
+
+    // Validate data
+    if ((*ifs_buffer) > IFX_T1PRIME_MAX_IFS)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IFS_DECODE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Encodes information field size (IFS) to its binary representation.
+ *
+ * \param[in] ifs IFS value to be encoded.
+ * \param[out] buffer Buffer to store encoded data in.
+ * \param[out] buffer_len Number of bytes in \p buffer.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_ifs_encode(size_t ifs, uint8_t **buffer,
+                                    size_t *buffer_len)
+{
+    // Check that desired IFS value is in range
+    if ((ifs == 0U) || (ifs > IFX_T1PRIME_MAX_IFS))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IFS_ENCODE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    // Allocate buffer for binary encoding
+    *buffer_len = (ifs <= 0xfeU) ? 1U : 2U;
+    *buffer = (uint8_t *) malloc(*buffer_len);
+    if (*buffer == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IFS_ENCODE,
+                         IFX_OUT_OF_MEMORY);
+    }
+
+    // Actually encode data
+    if ((*buffer_len) == 1U)
+    {
+        (*buffer)[0] = ifs & 0xffU;
+    }
+    else
+    {
+        (*buffer)[0] = (ifs & 0x0f00U) >> 8;
+        (*buffer)[1] = ifs & 0x00ffU;
     }
 
     return IFX_SUCCESS;
 }
 
 /**
- * \brief Validates CIP object by checking all member values against GP
- * specification.
+ * \brief Returns maximum information field size of the secure element (IFSC).
  *
- * \param[in] cip CIP object to be validated.
- * \return ifx_status_t \c IFX_SUCCESS if valid CIP, any other
+ * \param[in] self T=1' protocol stack to get IFSC for.
+ * \param[out] ifs_buffer Buffer to store IFSC value in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
  * value in case of error.
  */
-ifx_status_t ifx_t1prime_cip_validate(const ifx_cip_t *cip)
+ifx_status_t ifx_t1prime_get_ifsc(ifx_protocol_t *self, size_t *ifsc_buffer)
 {
-    // Issuer identification number must be 3 or 4 bytes long
-    if ((cip->iin_len < 3U) || (cip->iin_len > 4U))
-    {
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_VALIDATE,
-                         IFX_T1PRIME_INVALID_LEN);
-    }
-
-    // SPI physical layer parameters must be at least 12 bytes long
-    if (cip->plid == IFX_T1PRIME_PLID_SPI)
-    {
-        if (cip->plp_len < (1U + 1U + 2U + 1U + 1U + 2U + 2U + 2U))
-        {
-            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_VALIDATE,
-                             IFX_TOO_LITTLE_DATA);
-        }
-    }
-    // I2C physical layer parameters must be at least 8 bytes long
-    else if (cip->plid == IFX_T1PRIME_PLID_I2C)
-    {
-        if (cip->plp_len < (1U + 1U + 2U + 1U + 1U + 2U))
-        {
-            return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_VALIDATE,
-                             IFX_TOO_LITTLE_DATA);
-        }
-    }
-    // Unkown physical layer identifier
-    else
+    // Validate parameters
+    if ((self == NULL) || (ifsc_buffer == NULL))
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_VALIDATE,
-                         IFX_T1PRIME_INVALID_PLID);
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_GET_IFSC,
+                         IFX_ILLEGAL_ARGUMENT);
     }
 
-    // Data-link layer parameters must be at least 4 bytes long
-    if (cip->dllp_len < (2U + 2U))
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_CIP_VALIDATE,
-                         IFX_TOO_LITTLE_DATA);
+        return status;
     }
-
+    *ifsc_buffer = protocol_state->ifsc;
     return IFX_SUCCESS;
 }
 
 /**
- * \brief Frees memory associated with CIP object (but not object itself)
- *
- * \details CIP objects will most likely be populated by
- * ifx_t1prime_cip_decode() . Users would need to manually check which members
- * have been dynamically allocated and free them themselves. Calling this
- * function will ensure that all dynamically allocated members have been freed.
- *
- * \code
- *      uint8_t encoded[] = {...};
- *      size_t encoded_len = sizeof(encoded);
- *      ifx_cip_t cip;
- *      // Might allocate several buffers
- *      ifx_t1prime_cip_decode(&cip, encoded, encoded_len);
- *      ifx_t1prime_cip_destroy(&cip);
- * \endcode
- *
- * \param[in] cip CIP object whose data shall be freed.
+ * \brief Implementation of ifx_t1prime_s_ifs() called with lock held.
  */
-void ifx_t1prime_cip_destroy(ifx_cip_t *cip)
+static ifx_status_t ifx_t1prime_s_ifs_unlocked(ifx_protocol_t *self,
+                                               size_t ifsd,
+                                               size_t *response_ifs)
 {
-    // Issuer identification number
-    if ((cip->iin_len > 0U) && (cip->iin != NULL))
-    {
-        free(cip->iin);
-    }
-    cip->iin_len = 0U;
-    cip->iin = NULL;
+    // Prepare IFS information
+    ifx_t1prime_block_t request;
+    request.nad = 0x21U;
+    request.pcb = IFX_T1PRIME_PCB_S_IFS_REQ;
+    request.information_size = 0U;
+    request.information = NULL;
 
-    // Physical layer parameters
-    if ((cip->plp_len > 0U) && (cip->plp != NULL))
+    ifx_status_t status = ifx_t1prime_ifs_encode(ifsd, &(request.information),
+                                                 &(request.information_size));
+    if (status != IFX_SUCCESS)
     {
-        free(cip->plp);
+        return status;
     }
-    cip->plp_len = 0U;
-    cip->plp = NULL;
 
-    // Data-link layer parameters
-    if ((cip->dllp_len > 0U) && (cip->dllp != NULL))
+    // Send S(IFS request) to secure element and read back response
+    ifx_t1prime_block_t response;
+    status = ifx_t1prime_block_transceive(self, &request, &response);
+    ifx_t1prime_block_destroy(&request);
+    if (status != IFX_SUCCESS)
     {
-        free(cip->dllp);
+        return status;
     }
-    cip->dllp_len = 0U;
-    cip->dllp = NULL;
 
-    // Historical bytes
-    if ((cip->hb_len > 0U) && (cip->hb != NULL))
+    // Validate response is S(IFS response) -> also implicitly checked by
+    // ifx_t1prime_block_transceive
+    if (response.pcb != IFX_T1PRIME_PCB_S_IFS_RESP)
     {
-        free(cip->hb);
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
+                        "Invalid answer to S(IFS request) received (PCB: %02X)",
+                        response.pcb);
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                         IFX_T1PRIME_INVALID_BLOCK);
     }
-    cip->hb_len = 0U;
-    cip->hb = NULL;
-}
 
-/**
- * \brief Decodes binary data to its member representation in DLLP object.
- *
- * \param[out] dllp DLLP object to store values in.
- * \param[in] data Binary data to be decoded.
- * \param[in] data_len Number of bytes in \p data.
- * \return ifx_status_t \c IFX_SUCCESS if successful, any other
- * value in case of error.
- */
-ifx_status_t ifx_t1prime_dllp_decode(ifx_dllp_t *dllp, const uint8_t *encoded,
-                                     size_t encoded_len)
-{
-    if (encoded_len < (2U + 2U))
+    // Decode IFS response
+    status = ifx_t1prime_ifs_decode(response_ifs, response.information,
+                                    response.information_size);
+    if (status != IFX_SUCCESS)
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_DLLP_DECODE,
-                         IFX_TOO_LITTLE_DATA);
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
+                        "Invalid S(IFS response) received");
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                         IFX_T1PRIME_INVALID_BLOCK);
     }
-    dllp->bwt = (encoded[0] << 8) | encoded[1];
-    dllp->ifsc = (encoded[2] << 8) | encoded[3];
-
     return IFX_SUCCESS;
 }
 
 /**
- * \brief Frees memory associated with DLLP object (but not object itself).
+ * \brief Performs Global Platform T=1' IFS exchange.
  *
- * \details This function does nothing at the moment but keeps the interface
- * uniform accross all datastructures.
+ * \details Sends S(IFS request) and expects S(IFS response).
  *
- * \param[in] dllp DLLP object whose data shall be freed.
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] ifsd IFSD value to be requested.
+ * \param[out] response_ifs Buffer to store IFS value of S(IFS response) in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
  */
-void ifx_t1prime_dllp_destroy(ifx_dllp_t *dllp)
+ifx_status_t ifx_t1prime_s_ifs(ifx_protocol_t *self, size_t ifsd,
+                               size_t *response_ifs)
 {
-    // Ignore unused parameter
-    (void) dllp;
+    ifx_status_t status;
+    IFX_T1PRIME_LOCKED(self, status,
+                       ifx_t1prime_s_ifs_unlocked(self, ifsd, response_ifs));
+    return status;
 }
 
-#ifdef IFX_T1PRIME_INTERFACE_I2C
 /**
- * \brief Decodes binary data to its member representation in PLP object.
- *
- * \param[out] plp PLP object to store values in.
- * \param[in] data Binary data to be decoded.
- * \param[in] data_len Number of bytes in \p data.
- * \return ifx_status_t \c IFX_SUCCESS if successful, any other
- * value in case of error.
+ * \brief Implementation of ifx_t1prime_set_ifsd() called with lock held.
  */
-ifx_status_t ifx_t1prime_plp_decode(ifx_plp_t *plp, const uint8_t *encoded,
-                                    size_t encoded_len)
+static ifx_status_t ifx_t1prime_set_ifsd_unlocked(ifx_protocol_t *self,
+                                                  size_t ifsd)
 {
-    if (encoded_len < (1U + 1U + 2U + 1U + 1U + 2U))
+    // Validate parameters
+    if (self == NULL)
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_PLP_DECODE,
-                         IFX_TOO_LITTLE_DATA);
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_SET_IFSD,
+                         IFX_ILLEGAL_ARGUMENT);
     }
-    plp->configuration = encoded[0];
-    plp->pwt = encoded[1];
-    plp->mcf = (encoded[2] << 8) | encoded[3];
-    plp->pst = encoded[4];
-    plp->mpot = encoded[5];
-    plp->rwgt = (encoded[6] << 8) | encoded[7];
+    // Check that desired IFS value is in range
+    if ((ifsd == 0U) || (ifsd > IFX_T1PRIME_MAX_IFS))
+    {
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                        "Requested to set IFSD to invalid value %xd", ifsd);
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_SET_IFSD,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+
+    IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_DEBUG,
+                    "Setting IFSD to %xd", ifsd);
+
+    // Exchange S(IFS request) and S(IFS response)
+    size_t response_ifs;
+    status = ifx_t1prime_s_ifs(self, ifsd, &response_ifs);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+
+    // Check that negotiated value matches
+    if (response_ifs != ifsd)
+    {
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
+                        "Invalid S(IFS response) received");
+        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
+                         IFX_T1PRIME_INVALID_BLOCK);
+    }
+    protocol_state->ifsd = ifsd;
 
+    IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_DEBUG,
+                    "Successfully set IFSD to %xd", ifsd);
     return IFX_SUCCESS;
 }
 
 /**
- * \brief Frees memory associated with PLP object (but not object itself).
- *
- * \details This function does nothing at the moment but keeps the interface
- * uniform accross all datastructures.
+ * \brief Sets maximum information field size of the host device (IFSD).
  *
- * \param[in] plp PLP object whose data shall be freed.
+ * \param[in] self T=1' protocol stack to set IFSD for.
+ * \param[in] ifsd IFS value to be used.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
  */
-void ifx_t1prime_plp_destroy(ifx_plp_t *plp)
+ifx_status_t ifx_t1prime_set_ifsd(ifx_protocol_t *self, size_t ifsd)
 {
-    // Ignore unused parameter
-    (void) plp;
+    ifx_status_t status;
+    IFX_T1PRIME_LOCKED(self, status, ifx_t1prime_set_ifsd_unlocked(self, ifsd));
+    return status;
 }
-#else
+
 /**
- * \brief Decodes binary data to its member representation in PLP object.
- *
- * \param[out] plp PLP object to store values in.
- * \param[in] data Binary data to be decoded.
- * \param[in] data_len Number of bytes in \p data.
- * \return ifx_status_t \c IFX_SUCCESS if successful, any other
- * value in case of error.
+ * \brief Implementation of ifx_t1prime_negotiate_max_ifsd()
+ * called with lock held.
  */
-ifx_status_t ifx_t1prime_plp_decode(ifx_plp_t *plp, const uint8_t *encoded,
-                                    size_t encoded_len)
+static ifx_status_t
+ifx_t1prime_negotiate_max_ifsd_unlocked(ifx_protocol_t *self)
 {
-    if (encoded_len < (1u + 1u + 2u + 1u + 1u + 2u + 2u + 2u))
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_PLP_DECODE,
-                         IFX_TOO_LITTLE_DATA);
+        return status;
+    }
+
+    // Propose maximum and accept at most one counter proposal
+    size_t proposed = IFX_T1PRIME_MAX_IFS;
+    for (uint8_t attempt = 0U; attempt < 2U; attempt++)
+    {
+        size_t response_ifs;
+        status = ifx_t1prime_s_ifs(self, proposed, &response_ifs);
+        if (status != IFX_SUCCESS)
+        {
+            // Exchange might have triggered recovery so resynchronize
+            IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
+                            "IFSD negotiation failed, keeping default IFSD");
+            return ifx_t1prime_s_resynch(self);
+        }
+        if (response_ifs == proposed)
+        {
+            protocol_state->ifsd = proposed;
+            IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_DEBUG,
+                            "Negotiated maximum IFSD of %xd", proposed);
+            return IFX_SUCCESS;
+        }
+        if (response_ifs > proposed)
+        {
+            break;
+        }
+        proposed = response_ifs;
     }
-    plp->configuration = encoded[0];
-    plp->pwt = encoded[1];
-    plp->mcf = (encoded[2] << 8) | encoded[3];
-    plp->pst = encoded[4];
-    plp->mpot = encoded[5];
-    plp->segt = (encoded[6] << 8) | encoded[7];
-    plp->seal = (encoded[8] << 8) | encoded[9];
-    plp->wut = (encoded[10] << 8) | encoded[11];
 
+    IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
+                    "Secure element did not confirm IFSD, keeping default");
     return IFX_SUCCESS;
 }
 
 /**
- * \brief Frees memory associated with PLP object (but not object itself).
+ * \brief Negotiates the largest IFSD accepted by the secure element.
  *
- * \details This function does nothing at the moment but keeps the interface
- * uniform across all datastructures.
+ * \details Requests IFX_T1PRIME_MAX_IFS. If the secure element answers with a
+ * smaller value, that value is requested again to confirm it. If no value can
+ * be agreed on, the secure element's default IFSD is kept.
  *
- * \param[in] plp PLP object whose data shall be freed.
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \return ifx_status_t \c IFX_SUCCESS if successful (even if default IFSD is
+ * kept), any other value in case of error.
  */
-void ifx_t1prime_plp_destroy(ifx_plp_t *plp)
+ifx_status_t ifx_t1prime_negotiate_max_ifsd(ifx_protocol_t *self)
 {
-    // Ignore unused parameter
-    (void) plp;
+    ifx_status_t status;
+    IFX_T1PRIME_LOCKED(self, status,
+                       ifx_t1prime_negotiate_max_ifsd_unlocked(self));
+    return status;
 }
-#endif
 
 /**
- * \brief Decodes binary information field size (IFS).
+ * \brief Returns maximum information field size of the host device (IFSD).
  *
- * \param[out] ifs_buffer Buffer to store IFS value in.
- * \param[in] data Binary IFS data.
- * \param[in] data_len Number of bytes in \p data.
+ * \param[in] self T=1' protocol stack to get IFSD for.
+ * \param[out] ifsd_buffer Buffer to store IFSD value in (\c 0 if IFSD has not
+ * been negotiated and the secure element's default applies).
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
  * value in case of error.
  */
-ifx_status_t ifx_t1prime_ifs_decode(size_t *ifs_buffer, const uint8_t *data,
-                                    size_t data_len)
+ifx_status_t ifx_t1prime_get_ifsd(ifx_protocol_t *self, size_t *ifsd_buffer)
 {
-    // Check that length of binary data is valid
-    if ((data_len < 1U) || (data_len > 2U))
+    // Validate parameters
+    if ((self == NULL) || (ifsd_buffer == NULL))
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IFS_DECODE,
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_GET_IFSD,
                          IFX_ILLEGAL_ARGUMENT);
     }
 
-    // Decode data
-    if (data_len == 1U)
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
     {
-        *ifs_buffer = data[0];
+        return status;
     }
-    else
+    *ifsd_buffer = protocol_state->ifsd;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Enables or disables max-throughput activation.
+ *
+ * \param[in] self T=1' protocol stack to configure.
+ * \param[in] enable \c true to negotiate maximum IFSD during activation.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_set_max_throughput(ifx_protocol_t *self, bool enable)
+{
+    // Validate parameters
+    if (self == NULL)
     {
-        *ifs_buffer = (data[0] << 8) | data[1];
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_SET_MAX_THROUGHPUT,
+                         IFX_ILLEGAL_ARGUMENT);
     }
 
-    // Validate data
-    if ((*ifs_buffer) > IFX_T1PRIME_MAX_IFS)
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IFS_DECODE,
-                         IFX_ILLEGAL_ARGUMENT);
+        return status;
     }
+    protocol_state->max_throughput = enable;
     return IFX_SUCCESS;
 }
 
 /**
- * \brief Encodes information field size (IFS) to its binary representation.
+ * \brief Returns number of I blocks used for the last exchange.
  *
- * \param[in] ifs IFS value to be encoded.
- * \param[out] buffer Buffer to store encoded data in.
- * \param[out] buffer_len Number of bytes in \p buffer.
+ * \param[in] self T=1' protocol stack to get block counts for.
+ * \param[out] request_blocks Buffer to store number of I blocks sent for last
+ * request in (might be \c NULL).
+ * \param[out] response_blocks Buffer to store number of I blocks received for
+ * last response in (might be \c NULL).
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
  * value in case of error.
  */
-ifx_status_t ifx_t1prime_ifs_encode(size_t ifs, uint8_t **buffer,
-                                    size_t *buffer_len)
+ifx_status_t ifx_t1prime_get_block_counts(ifx_protocol_t *self,
+                                          size_t *request_blocks,
+                                          size_t *response_blocks)
 {
-    // Check that desired IFS value is in range
-    if ((ifs == 0U) || (ifs > IFX_T1PRIME_MAX_IFS))
+    // Validate parameters
+    if (self == NULL)
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IFS_ENCODE,
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_GET_BLOCK_COUNTS,
                          IFX_ILLEGAL_ARGUMENT);
     }
 
-    // Allocate buffer for binary encoding
-    *buffer_len = (ifs <= 0xfeU) ? 1U : 2U;
-    *buffer = (uint8_t *) malloc(*buffer_len);
-    if (*buffer == NULL)
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_IFS_ENCODE,
-                         IFX_OUT_OF_MEMORY);
+        return status;
     }
-
-    // Actually encode data
-    if ((*buffer_len) == 1U)
+    if (request_blocks != NULL)
     {
-        (*buffer)[0] = ifs & 0xffU;
+        *request_blocks = protocol_state->request_blocks;
     }
-    else
+    if (response_blocks != NULL)
     {
-        (*buffer)[0] = (ifs & 0x0f00U) >> 8;
-        (*buffer)[1] = ifs & 0x00ffU;
+        *response_blocks = protocol_state->response_blocks;
     }
-
     return IFX_SUCCESS;
 }
 
 /**
- * \brief Returns maximum information field size of the secure element (IFSC).
+ * \brief Enables or disables speculative single-transaction block receive.
  *
- * \param[in] self T=1' protocol stack to get IFSC for.
- * \param[out] ifs_buffer Buffer to store IFSC value in.
+ * \param[in] self T=1' protocol stack to configure.
+ * \param[in] enable \c true to enable speculative receive.
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
  * value in case of error.
  */
-ifx_status_t ifx_t1prime_get_ifsc(ifx_protocol_t *self, size_t *ifsc_buffer)
+ifx_status_t ifx_t1prime_set_speculative_receive(ifx_protocol_t *self,
+                                                 bool enable)
 {
     // Validate parameters
-    if ((self == NULL) || (ifsc_buffer == NULL))
+    if (self == NULL)
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_GET_IFSC,
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_SET_SPECULATIVE,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+#ifndef IFX_T1PRIME_INTERFACE_I2C
+    if (enable)
+    {
+        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
+                        "Speculative receive only supported for I2C");
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_SET_SPECULATIVE,
                          IFX_ILLEGAL_ARGUMENT);
     }
+#endif
 
     ifx_t1prime_protocol_state_t *protocol_state;
     ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
@@ -2215,97 +4579,107 @@ ifx_status_t ifx_t1prime_get_ifsc(ifx_protocol_t *self, size_t *ifsc_buffer)
     {
         return status;
     }
-    *ifsc_buffer = protocol_state->ifsc;
+    protocol_state->speculative_receive = enable;
     return IFX_SUCCESS;
 }
 
 /**
- * \brief Sets maximum information field size of the host device (IFSD).
+ * \brief Sets expected information field size of next response.
  *
- * \param[in] self T=1' protocol stack to set IFSD for.
- * \param[in] ifsd IFS value to be used.
+ * \param[in] self T=1' protocol stack to configure.
+ * \param[in] information_size Expected number of bytes in information field of
+ * first response block.
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
  * value in case of error.
  */
-ifx_status_t ifx_t1prime_set_ifsd(ifx_protocol_t *self, size_t ifsd)
+ifx_status_t ifx_t1prime_set_receive_hint(ifx_protocol_t *self,
+                                          size_t information_size)
 {
-    // Prepare IFS information
-    ifx_t1prime_block_t request;
-    request.nad = 0x21U;
-    request.pcb = IFX_T1PRIME_PCB_S_IFS_REQ;
-    request.information_size = 0U;
-    request.information = NULL;
-
     // Validate parameters
     if (self == NULL)
     {
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_SET_IFSD,
-                         IFX_ILLEGAL_ARGUMENT);
-    }
-    // Check that desired IFS value is in range
-    if ((ifsd == 0U) || (ifsd > IFX_T1PRIME_MAX_IFS))
-    {
-        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_ERROR,
-                        "Requested to set IFSD to invalid value %xd", ifsd);
-        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_SET_IFSD,
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_SET_RECEIVE_HINT,
                          IFX_ILLEGAL_ARGUMENT);
     }
 
-    IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_DEBUG,
-                    "Setting IFSD to %xd", ifsd);
-
-    ifx_status_t status = ifx_t1prime_ifs_encode(ifsd, &(request.information),
-                                                 &(request.information_size));
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
     if (status != IFX_SUCCESS)
     {
         return status;
     }
+    protocol_state->receive_hint = information_size;
+    return IFX_SUCCESS;
+}
 
-    // Send S(IFS request) to secure element and read back response
-    ifx_t1prime_block_t response;
-    status = ifx_t1prime_block_transceive(self, &request, &response);
-    ifx_t1prime_block_destroy(&request);
+/**
+ * \brief Sets strategy used to schedule polls while waiting for the secure
+ * element.
+ *
+ * \param[in] self T=1' protocol stack to configure.
+ * \param[in] strategy Polling strategy to be used.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t
+ifx_t1prime_set_polling_strategy(ifx_protocol_t *self,
+                                 ifx_t1prime_polling_strategy_t strategy)
+{
+    // Validate parameters
+    if ((self == NULL) || (strategy > IFX_T1PRIME_POLLING_ADAPTIVE))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_SET_POLLING,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
     if (status != IFX_SUCCESS)
     {
         return status;
     }
+    protocol_state->polling_strategy = strategy;
+    protocol_state->polls = 0U;
+    protocol_state->wasted_polls = 0U;
+    return IFX_SUCCESS;
+}
 
-    // Validate response is S(IFS response) -> also implicitly checked by
-    // ifx_t1prime_block_transceive
-    if (response.pcb != IFX_T1PRIME_PCB_S_IFS_RESP)
+/**
+ * \brief Returns number of polls since the polling strategy has been set.
+ *
+ * \param[in] self T=1' protocol stack to get polling counters for.
+ * \param[out] polls Buffer to store total number of polls in (might be
+ * \c NULL).
+ * \param[out] wasted_polls Buffer to store number of polls that did not return
+ * any data in (might be \c NULL).
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_get_polling_counters(ifx_protocol_t *self,
+                                              size_t *polls,
+                                              size_t *wasted_polls)
+{
+    // Validate parameters
+    if (self == NULL)
     {
-        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
-                        "Invalid answer to S(IFS request) received (PCB: %02X)",
-                        response.pcb);
-        ifx_t1prime_block_destroy(&response);
-        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
-                         IFX_T1PRIME_INVALID_BLOCK);
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_GET_POLL_COUNTERS,
+                         IFX_ILLEGAL_ARGUMENT);
     }
 
-    // Decode IFS response
-    size_t response_ifs;
-    status = ifx_t1prime_ifs_decode(&response_ifs, response.information,
-                                    response.information_size);
-    ifx_t1prime_block_destroy(&response);
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
     if (status != IFX_SUCCESS)
     {
-        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
-                        "Invalid S(IFS response) received");
-        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
-                         IFX_T1PRIME_INVALID_BLOCK);
+        return status;
     }
-
-    // Check that negotiated value matches
-    if (response_ifs != ifsd)
+    if (polls != NULL)
     {
-        IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_WARN,
-                        "Invalid S(IFS response) received");
-        return IFX_ERROR(LIB_T1PRIME, IFX_PROTOCOL_RECEIVE,
-                         IFX_T1PRIME_INVALID_BLOCK);
+        *polls = protocol_state->polls;
+    }
+    if (wasted_polls != NULL)
+    {
+        *wasted_polls = protocol_state->wasted_polls;
     }
-
-    IFX_T1PRIME_LOG(self->_logger, IFX_LOG_TAG, IFX_LOG_DEBUG,
-                    "Successfully set IFSD to %xd", ifsd);
     return IFX_SUCCESS;
 }
 
@@ -2445,6 +4819,91 @@ ifx_status_t ifx_t1prime_get_irq_handler(ifx_protocol_t *self,
     return IFX_SUCCESS;
 }
 
+/**
+ * \brief Sets context available to T=1' interrupt handler function.
+ *
+ * \param[in] self T=1' protocol stack to set interrupt context for.
+ * \param[in] context Context of interrupt handler (\c NULL for none).
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_set_irq_context(ifx_protocol_t *self, void *context)
+{
+    // Validate parameters
+    if (self == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_SET_IRQ_CONTEXT,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    protocol_state->irq_context = context;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Sets listener notified whenever the secure element is reset.
+ *
+ * \param[in] self T=1' protocol stack to set reset listener for.
+ * \param[in] listener Listener to be notified (\c NULL for none).
+ * \param[in] context Custom context passed to \p listener.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_set_reset_listener(
+    ifx_protocol_t *self, ifx_t1prime_reset_listener_t listener, void *context)
+{
+    // Validate parameters
+    if (self == NULL)
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_SET_RESET_LISTENER,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    protocol_state->reset_listener = listener;
+    protocol_state->reset_listener_context = context;
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief Getter for context of T=1' interrupt handler function.
+ *
+ * \param[in] self T=1' protocol stack to get interrupt context for.
+ * \param[out] context_buffer Buffer to store interrupt context in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_get_irq_context(ifx_protocol_t *self,
+                                         void **context_buffer)
+{
+    // Validate parameters
+    if ((self == NULL) || (context_buffer == NULL))
+    {
+        return IFX_ERROR(LIB_T1PRIME, IFX_T1PRIME_GET_IRQ_CONTEXT,
+                         IFX_ILLEGAL_ARGUMENT);
+    }
+
+    ifx_t1prime_protocol_state_t *protocol_state;
+    ifx_status_t status = ifx_t1prime_get_protocol_state(self, &protocol_state);
+    if (status != IFX_SUCCESS)
+    {
+        return status;
+    }
+    *context_buffer = protocol_state->irq_context;
+    return IFX_SUCCESS;
+}
+
 /**
  * \brief Returns current protocol state for Global Platform T=1' protocol.
  *
@@ -2498,10 +4957,47 @@ ifx_status_t ifx_t1prime_get_protocol_state(
             (ifx_t1prime_protocol_state_t *) self->_properties;
         properties->bwt = IFX_T1PRIME_DEFAULT_BWT_MS;
         properties->ifsc = IFX_T1PRIME_MAX_IFS;
+        properties->ifsd = 0U;
+        properties->max_throughput = false;
+        properties->request_blocks = 0U;
+        properties->response_blocks = 0U;
+        properties->speculative_receive = false;
+        properties->receive_hint = 0U;
+        properties->chained_information_size = 0U;
+        properties->read_ahead.buffer = NULL;
+        properties->read_ahead.size = 0U;
+        properties->read_ahead.start = 0U;
+        properties->read_ahead.length = 0U;
+        memset(&properties->poll_timer, 0, sizeof(properties->poll_timer));
+        properties->poll_timer_set = false;
+        properties->poll_interval = 0U;
+        properties->polling_strategy = IFX_T1PRIME_POLLING_FIXED;
+        properties->poll_count = 0U;
+        properties->poll_elapsed = 0U;
+        properties->latency_pending = false;
+        properties->ins_class = 0U;
+        memset(properties->latency_estimate, 0,
+               sizeof(properties->latency_estimate));
+        properties->polls = 0U;
+        properties->wasted_polls = 0U;
         properties->send_counter = 0x00U;
         properties->receive_counter = 0x00U;
         properties->wtx = 0x00U;
         properties->irq_handler = NULL;
+        properties->irq_context = NULL;
+        properties->reset_listener = NULL;
+        properties->reset_listener_context = NULL;
+        properties->frame_buffer = NULL;
+        properties->frame_buffer_size = 0U;
+        properties->request_copy = NULL;
+        properties->request_copy_size = 0U;
+        properties->receive_buffer = NULL;
+        properties->receive_buffer_size = 0U;
+        memset(&properties->session, 0, sizeof(properties->session));
+        properties->session_valid = false;
+        memset(&properties->exchange, 0, sizeof(properties->exchange));
+        properties->exchange.step = IFX_T1PRIME_STEP_IDLE;
+        properties->exchange.deadline_set = false;
         properties->pwt = IFX_T1PRIME_DEFAULT_PWT_MS;
 #ifdef IFX_T1PRIME_INTERFACE_I2C
         properties->mpot = IFX_T1PRIME_DEFAULT_I2C_MPOT_100US;
@@ -356,6 +356,20 @@ extern "C" {
  * \brief Default SPI minimum polling time in [multiple of 100us].
  */
 #define IFX_T1PRIME_DEFAULT_SPI_MPOT_100US         10u
+
+/**
+ * \brief Number of bytes read per SPI polling transaction when searching for
+ * the start of a block.
+ *
+ * \details Surplus bytes after the start of the block are kept and used for
+ * the rest of the block instead of being discarded.
+ */
+#ifndef IFX_T1PRIME_SPI_READ_AHEAD_LEN
+#define IFX_T1PRIME_SPI_READ_AHEAD_LEN 16u
+#endif
+#if IFX_T1PRIME_SPI_READ_AHEAD_LEN < 6u
+#error "IFX_T1PRIME_SPI_READ_AHEAD_LEN too small for prologue and epilogue"
+#endif
 #endif
 
 /**
@@ -373,6 +387,17 @@ extern "C" {
  */
 #define IFX_T1PRIME_DEFAULT_BWT_MS ((uint16_t) 300u)
 
+/**
+ * \brief Maximum number of times the polling interval is doubled by
+ * \ref IFX_T1PRIME_POLLING_BACKOFF.
+ */
+#define IFX_T1PRIME_POLLING_MAX_BACKOFF 5u
+
+/**
+ * \brief Version of session parameters encoded by ifx_t1prime_export_session().
+ */
+#define IFX_T1PRIME_SESSION_VERSION     0x01u
+
 /**
  * \brief ifx_protocol_activate_callback_t for Global Platform T=1' protocol.
  *
@@ -390,6 +415,18 @@ ifx_status_t ifx_t1prime_transceive(ifx_protocol_t *self, const uint8_t *data,
                                     size_t data_len, uint8_t **response,
                                     size_t *response_len);
 
+/**
+ * \brief ifx_protocol_get_request_buffer_callback_t for Global Platform T=1'
+ * protocol.
+ *
+ * \details Returns the information field of the reusable frame buffer, so
+ * requests fitting into a single I block are framed without being copied.
+ *
+ * \see ifx_protocol_get_request_buffer_callback_t
+ */
+ifx_status_t ifx_t1prime_get_request_buffer(ifx_protocol_t *self, size_t size,
+                                            uint8_t **buffer);
+
 /**
  * \brief ifx_protocol_destroy_callback_t for Global Platform T=1' protocol.
  *
@@ -411,6 +448,10 @@ ifx_status_t ifx_t1prime_block_transmit(ifx_protocol_t *self,
 /**
  * \brief Reads Block from secure element.
  *
+ * \details The information field of the received block is a view into the
+ * receive buffer of the protocol state and stays valid until the next block is
+ * received. It must not be destroyed.
+ *
  * \param[in] self Protocol stack for performing necessary operations.
  * \param[out] block Block object to store received data in.
  * \return ifx_status_t \c IFX_SUCCESS if successful, any other
@@ -422,6 +463,10 @@ ifx_status_t t1prime_block_receive(ifx_protocol_t *self,
 /**
  * \brief Sends Block to secure element and reads back response Block.
  *
+ * \details The information field of the received block is a view into the
+ * receive buffer of the protocol state and stays valid until the next block is
+ * received. It must not be destroyed.
+ *
  * \param[in] self Protocol stack for performing necessary operations.
  * \param[in] block Block object to be send to secure element.
  * \param[out] response_buffer Block object to store received data in.
@@ -432,6 +477,63 @@ ifx_status_t ifx_t1prime_block_transceive(ifx_protocol_t *self,
                                           const ifx_t1prime_block_t *block,
                                           ifx_t1prime_block_t *response_buffer);
 
+/**
+ * \brief Starts exchange of block set in exchange state.
+ *
+ * \details Retransmissions and recovery are handled by the exchange itself.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ */
+void ifx_t1prime_exchange_start(ifx_protocol_t *self,
+                                ifx_t1prime_protocol_state_t *protocol_state);
+
+/**
+ * \brief Finishes exchange so that its result can be collected.
+ *
+ * \param[in] protocol_state Protocol state holding exchange.
+ * \param[in] status Result of exchange.
+ */
+void ifx_t1prime_exchange_finish(ifx_t1prime_protocol_state_t *protocol_state,
+                                 ifx_status_t status);
+
+/**
+ * \brief Performs all steps of current exchange in a blocking manner.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ * \return ifx_status_t Result of exchange.
+ */
+ifx_status_t
+ifx_t1prime_exchange_run(ifx_protocol_t *self,
+                         ifx_t1prime_protocol_state_t *protocol_state);
+
+/**
+ * \brief Starts chained exchange of data via Global Platform T=1' protocol.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ * \param[in] data Data to be send via protocol.
+ * \param[in] data_len Number of bytes in \p data.
+ * \param[in] sink Sink called for every non-empty response I block.
+ * \param[in] context Context passed to \p sink.
+ */
+void ifx_t1prime_chain_begin(ifx_protocol_t *self,
+                             ifx_t1prime_protocol_state_t *protocol_state,
+                             const uint8_t *data, size_t data_len,
+                             ifx_t1prime_response_sink_t sink, void *context);
+
+/**
+ * \brief Continues chained exchange once a block exchange has finished.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] protocol_state Protocol state holding exchange.
+ * \param[in] status Outcome of block exchange.
+ */
+void ifx_t1prime_chain_continue(ifx_protocol_t *self,
+                                ifx_t1prime_protocol_state_t *protocol_state,
+                                ifx_status_t status);
+
 /**
  * \brief Performs Global Platform T=1' RESYNCH operation.
  *
@@ -466,6 +568,58 @@ ifx_status_t ifx_t1prime_s_cip(ifx_protocol_t *self, ifx_cip_t *cip);
  */
 ifx_status_t ifx_t1prime_s_swr(ifx_protocol_t *self);
 
+/**
+ * \brief Performs Global Platform T=1' IFS exchange.
+ *
+ * \details Sends S(IFS request) and expects S(IFS response).
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \param[in] ifsd IFSD value to be requested.
+ * \param[out] response_ifs Buffer to store IFS value of S(IFS response) in.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_s_ifs(ifx_protocol_t *self, size_t ifsd,
+                               size_t *response_ifs);
+
+/**
+ * \brief Negotiates the largest IFSD accepted by the secure element.
+ *
+ * \details Requests IFX_T1PRIME_MAX_IFS. If the secure element answers with a
+ * smaller value, that value is requested again to confirm it. If no value can
+ * be agreed on, the secure element's default IFSD is kept.
+ *
+ * \param[in] self Protocol stack for performing necessary operations.
+ * \return ifx_status_t \c IFX_SUCCESS if successful (even if default IFSD is
+ * kept), any other value in case of error.
+ */
+ifx_status_t ifx_t1prime_negotiate_max_ifsd(ifx_protocol_t *self);
+
+/**
+ * \brief Makes sure reusable frame buffer can hold a full block.
+ *
+ * \param[in] protocol_state Protocol state holding frame buffer.
+ * \param[in] information_size Maximum number of bytes in information field.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t
+ifx_t1prime_reserve_frame_buffer(ifx_t1prime_protocol_state_t *protocol_state,
+                                 size_t information_size);
+
+/**
+ * \brief Makes sure reusable receive buffer can hold information field and
+ * epilogue of a received block.
+ *
+ * \param[in] protocol_state Protocol state holding receive buffer.
+ * \param[in] information_size Number of bytes in information field.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t
+ifx_t1prime_reserve_receive_buffer(ifx_t1prime_protocol_state_t *protocol_state,
+                                   size_t information_size);
+
 /**
  * \brief Returns maximum information field size of the secure element (IFSC).
  *
@@ -12,6 +12,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "infineon/ifx-error.h"
+#include "infineon/ifx-timer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -149,6 +150,77 @@ extern "C" {
  */
 #define IFX_T1PRIME_GET_PROTOCOL_STATE 0x0Fu
 
+/**
+ * \brief IFX error encoding function identifier for ifx_t1prime_get_ifsd().
+ */
+#define IFX_T1PRIME_GET_IFSD           0x11u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_set_max_throughput().
+ */
+#define IFX_T1PRIME_SET_MAX_THROUGHPUT 0x12u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_get_block_counts().
+ */
+#define IFX_T1PRIME_GET_BLOCK_COUNTS   0x13u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_set_speculative_receive().
+ */
+#define IFX_T1PRIME_SET_SPECULATIVE    0x14u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_set_receive_hint().
+ */
+#define IFX_T1PRIME_SET_RECEIVE_HINT   0x15u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_set_polling_strategy().
+ */
+#define IFX_T1PRIME_SET_POLLING        0x16u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_get_polling_counters().
+ */
+#define IFX_T1PRIME_GET_POLL_COUNTERS  0x17u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_set_irq_context().
+ */
+#define IFX_T1PRIME_SET_IRQ_CONTEXT    0x23u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_get_irq_context().
+ */
+#define IFX_T1PRIME_GET_IRQ_CONTEXT    0x24u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_get_request_buffer().
+ */
+#define IFX_T1PRIME_GET_REQUEST_BUFFER 0x28u
+
+/**
+ * \brief IFX error encoding function identifier for
+ * ifx_t1prime_set_reset_listener().
+ */
+#define IFX_T1PRIME_SET_RESET_LISTENER 0x29u
+
+/**
+ * \brief Number of INS classes (upper nibble of INS byte) response latency is
+ * estimated for by \ref IFX_T1PRIME_POLLING_ADAPTIVE.
+ */
+#define IFX_T1PRIME_POLLING_CLASSES    16u
+
 /** \struct ifx_t1prime_block_t
  * \brief Data storage for a Global Platform T=1' block.
  */
@@ -178,6 +250,9 @@ typedef struct
 /**
  * \brief Decodes binary data to its member representation in Block object.
  *
+ * \details Does not allocate any memory: The information field of \p block
+ * is a view into \p data and only valid as long as \p data is.
+ *
  * \param[out] block Block object to store values in.
  * \param[in] data Binary data to be decoded.
  * \param[in] data_len Number of bytes in \p data.
@@ -199,14 +274,32 @@ ifx_status_t ifx_t1prime_block_decode(ifx_t1prime_block_t *block,
 ifx_status_t ifx_t1prime_block_encode(const ifx_t1prime_block_t *block,
                                       uint8_t **buffer, size_t *buffer_len);
 
+/**
+ * \brief Encodes Block to its binary representation into a caller provided
+ * buffer.
+ *
+ * \details Same as ifx_t1prime_block_encode() but does not allocate any
+ * memory. Used to frame blocks directly into a reusable frame buffer.
+ *
+ * \param[in] block Block to be encoded.
+ * \param[out] buffer Buffer to store encoded data in.
+ * \param[in] buffer_size Number of bytes available in \p buffer.
+ * \param[out] buffer_len Pointer for storing number of bytes written to \p
+ * buffer.
+ * \return ifx_status_t \c IFX_SUCCESS if successful, any other
+ * value in case of error.
+ */
+ifx_status_t ifx_t1prime_block_encode_into(const ifx_t1prime_block_t *block,
+                                           uint8_t *buffer, size_t buffer_size,
+                                           size_t *buffer_len);
+
 /**
  * \brief Frees memory associated with Block object (but not object itself).
  *
- * \details Block objects may contain dynamically allocated data (e.g. by
- * ifx_t1prime_block_decode() ). Users would need to manually check which
- * members have been dynamically allocated and free them themselves. Calling
- * this function will ensure that all dynamically allocated members have been
- * freed.
+ * \details Only for blocks whose information field has been dynamically
+ * allocated by the caller. Decoded and received blocks borrow their
+ * information field (see ifx_t1prime_block_decode()) and must not be
+ * destroyed.
  *
  * \param[in] block Block object whose data shall be freed.
  */
@@ -490,6 +583,55 @@ ifx_status_t ifx_t1prime_plp_decode(ifx_plp_t *plp, const uint8_t *encoded,
 void ifx_t1prime_plp_destroy(ifx_plp_t *plp);
 #endif
 
+/** \struct ifx_t1prime_session_t
+ * \brief Session parameters derived from validated CIP.
+ *
+ * \details Applied during activation and exported by
+ * ifx_t1prime_export_session() so that later activations can skip S(CIP).
+ */
+typedef struct
+{
+    /**
+     * \brief Physical layer identifier.
+     */
+    uint8_t plid;
+
+    /**
+     * \brief Block waiting time in [ms].
+     */
+    uint16_t bwt;
+
+    /**
+     * \brief Maximum information field size of secure element.
+     */
+    uint16_t ifsc;
+
+    /**
+     * \brief Minimum polling time in [multiple of 100us].
+     */
+    uint8_t mpot;
+
+    /**
+     * \brief Power wake-up time in [ms].
+     */
+    uint8_t pwt;
+
+    /**
+     * \brief Clock frequency in [Hz].
+     */
+    uint32_t clock_frequency;
+
+    /**
+     * \brief Guard time set in physical layer (RWGT for I2C, SEGT for SPI).
+     */
+    uint16_t guard_time;
+
+    /**
+     * \brief Maximum secure element access length in [byte] (SPI only).
+     */
+    uint16_t seal;
+} ifx_t1prime_session_t;
+
 /**
  * \brief Decodes binary information field size (IFS).
  *
@@ -514,6 +656,228 @@ ifx_status_t ifx_t1prime_ifs_decode(size_t *ifs_buffer, const uint8_t *data,
 ifx_status_t ifx_t1prime_ifs_encode(size_t ifs, uint8_t **buffer,
                                     size_t *buffer_len);
 
+/** \struct ifx_t1prime_ring_buffer_t
+ * \brief Ring buffer keeping surplus bytes read ahead from the secure element.
+ */
+typedef struct
+{
+    /**
+     * \brief Storage (\c NULL until first used).
+     */
+    uint8_t *buffer;
+
+    /**
+     * \brief Number of bytes allocated for buffer.
+     */
+    size_t size;
+
+    /**
+     * \brief Index of first stored byte.
+     */
+    size_t start;
+
+    /**
+     * \brief Number of stored bytes.
+     */
+    size_t length;
+} ifx_t1prime_ring_buffer_t;
+
+/**
+ * \brief State of sink used by ifx_t1prime_transceive() to collect response
+ * in dynamically growing buffer.
+ */
+typedef struct
+{
+    /**
+     * \brief Response buffer (might be \c NULL if nothing received yet).
+     */
+    uint8_t *buffer;
+
+    /**
+     * \brief Number of bytes used in buffer.
+     */
+    size_t buffer_len;
+
+    /**
+     * \brief Number of bytes allocated for buffer.
+     */
+    size_t buffer_size;
+} ifx_t1prime_dynamic_sink_t;
+
+/**
+ * \brief Steps of a T=1' exchange driven by ifx_t1prime_transceive_poll().
+ */
+typedef enum
+{
+    /**
+     * \brief No exchange in progress.
+     */
+    IFX_T1PRIME_STEP_IDLE = 0,
+
+    /**
+     * \brief Encoded block waits to be (re)sent once polling time has passed.
+     */
+    IFX_T1PRIME_STEP_TRANSMIT,
+
+    /**
+     * \brief Secure element is polled for response block.
+     */
+    IFX_T1PRIME_STEP_RECEIVE,
+
+    /**
+     * \brief Power wake-up time is awaited after recovery via S(SWR).
+     */
+    IFX_T1PRIME_STEP_RESET,
+
+    /**
+     * \brief Exchange finished, result can be collected.
+     */
+    IFX_T1PRIME_STEP_DONE
+} ifx_t1prime_step_t;
+
+/** \struct ifx_t1prime_exchange_t
+ * \brief State of a T=1' exchange that is performed step by step.
+ *
+ * \details Holds everything that used to live on the stack of the blocking
+ * transceive functions so that the exchange can be suspended between bus
+ * transactions.
+ */
+typedef struct
+{
+    /**
+     * \brief Current step of exchange.
+     */
+    ifx_t1prime_step_t step;
+
+    /**
+     * \brief Final result once step is \ref IFX_T1PRIME_STEP_DONE.
+     */
+    ifx_status_t result;
+
+    /**
+     * \brief Timeout for current transmission or response (BWT or WTX).
+     */
+    ifx_timer_t deadline;
+
+    /**
+     * \brief Whether deadline has been set.
+     */
+    bool deadline_set;
+
+    /**
+     * \brief Time until response has to be ready in [us].
+     */
+    uint32_t receive_timeout_us;
+
+    /**
+     * \brief Number of encoded bytes in frame buffer.
+     */
+    size_t frame_len;
+
+    /**
+     * \brief Block currently exchanged with secure element.
+     */
+    ifx_t1prime_block_t block;
+
+    /**
+     * \brief Block actually sent (block itself or retransmission request).
+     */
+    ifx_t1prime_block_t to_send;
+
+    /**
+     * \brief Response to block.
+     */
+    ifx_t1prime_block_t response;
+
+    /**
+     * \brief Number of retries performed for block.
+     */
+    uint8_t try_count;
+
+    /**
+     * \brief Error that caused recovery via S(SWR) (\c IFX_SUCCESS if not
+     * recovering).
+     */
+    ifx_status_t recovery_status;
+
+    /**
+     * \brief Whether block is part of ifx_t1prime_transceive_begin() (or any
+     * other chained transceive operation).
+     */
+    bool chain;
+
+    /**
+     * \brief Whether secure element started sending response chain.
+     */
+    bool response_phase;
+
+    /**
+     * \brief Request data (owned by caller).
+     */
+    const uint8_t *data;
+
+    /**
+     * \brief Whether request data has been encoded in place into the
+     * information field of frame_buffer (see ifx_t1prime_get_request_buffer()).
+     */
+    bool in_place;
+
+    /**
+     * \brief Offset of last sent I block in data.
+     */
+    size_t offset;
+
+    /**
+     * \brief Number of bytes in data starting at offset.
+     */
+    size_t remaining;
+
+    /**
+     * \brief Information field size of last sent I block.
+     */
+    size_t last_information_size;
+
+    /**
+     * \brief Whether secure element aborted request chain.
+     */
+    bool aborted;
+
+    /**
+     * \brief Whether S(ABORT response) is sent to end response chain.
+     */
+    bool abort_response;
+
+    /**
+     * \brief Whether first response I block has been received.
+     */
+    bool response_started;
+
+    /**
+     * \brief Information field of S(WTX response) and S(IFS response) blocks.
+     */
+    uint8_t s_response_information[2];
+
+    /**
+     * \brief Sink called for every non-empty response I block.
+     */
+    ifx_t1prime_response_sink_t sink;
+
+    /**
+     * \brief Context passed to sink.
+     */
+    void *context;
+
+    /**
+     * \brief First error returned by sink.
+     */
+    ifx_status_t sink_status;
+
+    /**
+     * \brief Sink collecting response of ifx_t1prime_transceive_begin().
+     */
+    ifx_t1prime_dynamic_sink_t dynamic_sink;
+} ifx_t1prime_exchange_t;
+
 /** \struct ifx_t1prime_protocol_state_t
  * \brief State of T=1' protocol keeping track of sequence counters, information
  * field sizes, etc.
@@ -540,6 +904,115 @@ typedef struct
      */
     size_t ifsc;
 
+    /**
+     * \brief Maximum size of host device information field in [byte].
+     *
+     * \details \c 0 if not negotiated via S(IFS request) (secure element
+     * default applies).
+     */
+    size_t ifsd;
+
+    /**
+     * \brief Whether activation negotiates the largest possible IFSD.
+     */
+    bool max_throughput;
+
+    /**
+     * \brief Number of I blocks sent for last request.
+     */
+    size_t request_blocks;
+
+    /**
+     * \brief Number of I blocks received for last response.
+     */
+    size_t response_blocks;
+
+    /**
+     * \brief Whether block prologue and information field are read in a
+     * single transaction.
+     */
+    bool speculative_receive;
+
+    /**
+     * \brief Expected information field size of next response (per-command
+     * hint, \c 0 if unknown).
+     */
+    size_t receive_hint;
+
+    /**
+     * \brief Information field size of last received chained I block (\c 0 if
+     * not in a chain).
+     */
+    size_t chained_information_size;
+
+    /**
+     * \brief Surplus bytes read ahead while searching for start of block (SPI
+     * only).
+     */
+    ifx_t1prime_ring_buffer_t read_ahead;
+
+    /**
+     * \brief Minimum polling time started at the end of the last bus
+     * transaction.
+     *
+     * \details Joined before the next polling transaction so that only the
+     * remainder of the minimum polling time is awaited.
+     */
+    ifx_timer_t poll_timer;
+
+    /**
+     * \brief Whether poll_timer has been set and not yet joined.
+     */
+    bool poll_timer_set;
+
+    /**
+     * \brief Duration of poll_timer in [us].
+     */
+    uint32_t poll_interval;
+
+    /**
+     * \brief Strategy used to schedule polls.
+     */
+    ifx_t1prime_polling_strategy_t polling_strategy;
+
+    /**
+     * \brief Number of polls since the last successful transmission.
+     */
+    size_t poll_count;
+
+    /**
+     * \brief Time waited for polling since the last successful transmission
+     * in [us].
+     */
+    uint32_t poll_elapsed;
+
+    /**
+     * \brief Whether next received block answers a complete request and its
+     * latency shall be used to update the estimate.
+     */
+    bool latency_pending;
+
+    /**
+     * \brief INS class of current request.
+     */
+    uint8_t ins_class;
+
+    /**
+     * \brief Moving estimate of response latency per INS class in [us] (\c 0
+     * if unknown).
+     */
+    uint32_t latency_estimate[IFX_T1PRIME_POLLING_CLASSES];
+
+    /**
+     * \brief Total number of polls (including NACKed I2C writes).
+     */
+    size_t polls;
+
+    /**
+     * \brief Number of polls that did not return any data.
+     */
+    size_t wasted_polls;
+
     /**
      * \brief Sequence counter of transmitted I(N(S), M) blocks.
      */
@@ -561,6 +1034,76 @@ typedef struct
      * \details Set to \c NULL to use polling mode.
      */
     ifx_t1prime_irq_handler_t irq_handler;
+
+    /**
+     * \brief Context available to interrupt handler.
+     */
+    void *irq_context;
+
+    /**
+     * \brief Optional listener notified whenever the secure element is reset.
+     */
+    ifx_t1prime_reset_listener_t reset_listener;
+
+    /**
+     * \brief Context passed to reset_listener.
+     */
+    void *reset_listener_context;
+
+    /**
+     * \brief Reusable buffer for encoding outgoing blocks.
+     *
+     * \details Lazily allocated to hold a full block with IFSC bytes of
+     * information so that transmitting blocks does not require any per-block
+     * allocations.
+     */
+    uint8_t *frame_buffer;
+
+    /**
+     * \brief Number of bytes allocated for frame_buffer.
+     */
+    size_t frame_buffer_size;
+
+    /**
+     * \brief Reusable buffer request data encoded in place is moved to before
+     * frame_buffer is needed for another block.
+     */
+    uint8_t *request_copy;
+
+    /**
+     * \brief Number of bytes allocated for request_copy.
+     */
+    size_t request_copy_size;
+
+    /**
+     * \brief Reusable buffer for information field and epilogue of received
+     * blocks.
+     *
+     * \details Sized for IFSD bytes of information during activation. The
+     * information field of a received block is a view into this buffer that
+     * stays valid until the next block is received.
+     */
+    uint8_t *receive_buffer;
+
+    /**
+     * \brief Number of bytes allocated for receive_buffer.
+     */
+    size_t receive_buffer_size;
+
+    /**
+     * \brief Session parameters applied during last activation.
+     */
+    ifx_t1prime_session_t session;
+
+    /**
+     * \brief Whether session holds parameters of a successful activation.
+     */
+    bool session_valid;
+
+    /**
+     * \brief Exchange currently performed with secure element.
+     */
+    ifx_t1prime_exchange_t exchange;
 } ifx_t1prime_protocol_state_t;
 
 #ifdef __cplusplus
@@ -61,6 +61,17 @@ typedef struct
      * \details Set by ifx_timer_set(), do **NOT** set manually!
      */
     uint64_t _duration;
+
+    /**
+     * \brief Private member for deadline of timer in implementation specific
+     * units (\c 0 if not set).
+     *
+     * \details Used by implementations that keep the deadline inline instead
+     * of allocating memory for the start of the timer. Implementations that do
+     * not need it may ignore it. Set by ifx_timer_set(), do **NOT** set
+     * manually!
+     */
+    uint64_t _deadline;
 } ifx_timer_t;
 
 /**
@@ -86,6 +97,22 @@ ifx_status_t ifx_timer_set(ifx_timer_t *timer, uint64_t time_us);
  */
 bool ifx_timer_has_elapsed(const ifx_timer_t *timer);
 
+/**
+ * \brief Returns time until Timer elapses.
+ *
+ * \details Can be used to sleep exactly until the timer has elapsed instead
+ * of polling ifx_timer_has_elapsed() in fixed intervals. Per definition timers
+ * that have not previously been set have no time remaining.
+ *
+ * Required by hsw-t1prime, so every implementation of this interface has to
+ * provide it.
+ *
+ * \param[in] timer Timer object to be checked.
+ * \return uint64_t Remaining time in [us] (rounded up, \c 0 if elapsed).
+ * \relates ifx_timer_t
+ */
+uint64_t ifx_timer_remaining(const ifx_timer_t *timer);
+
 /**
  * \brief Waits for Timer to finish.
  *
@@ -36,6 +36,17 @@ bool ifx_timer_has_elapsed(const ifx_timer_t *timer)
     return true;
 }
 
+/**
+ * \brief Mock implementation of interface function.
+ */
+uint64_t ifx_timer_remaining(const ifx_timer_t *timer)
+{
+    // Ignore unused parameter
+    (void) timer;
+
+    return 0U;
+}
+
 /**
  * \brief Mock implementation of interface function.
  */
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2024 Infineon Technologies AG
+//
+// SPDX-License-Identifier: MIT
+
+/**
+ * \file ifx-timer-posix.c
+ * \brief POSIX implementation of Timer interface based on the monotonic clock.
+ *
+ * \details The deadline is stored inline in ifx_timer_t._deadline as absolute
+ * time of \c CLOCK_MONOTONIC in [ns], so timers never allocate memory and
+ * ifx_timer_join() sleeps exactly until the deadline.
+ */
+#define _POSIX_C_SOURCE 200112L
+
+#include <errno.h>
+#include <stddef.h>
+#include <time.h>
+
+#include "infineon/ifx-timer.h"
+
+/**
+ * \brief Number of nanoseconds per second.
+ */
+#define IFX_TIMER_NS_PER_S  1000000000u
+
+/**
+ * \brief Number of nanoseconds per microsecond.
+ */
+#define IFX_TIMER_NS_PER_US 1000u
+
+/**
+ * \brief Reads current time of monotonic clock.
+ *
+ * \param[out] now_ns Buffer to store current time in [ns] in.
+ * \return bool \c true if successful.
+ */
+static bool ifx_timer_now(uint64_t *now_ns)
+{
+    struct timespec now;
+    if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+    {
+        return false;
+    }
+    *now_ns = ((uint64_t) now.tv_sec * IFX_TIMER_NS_PER_S) +
+              (uint64_t) now.tv_nsec;
+    return true;
+}
+
+/**
+ * \brief POSIX implementation of interface function.
+ */
+ifx_status_t ifx_timer_set(ifx_timer_t *timer, uint64_t time_us)
+{
+    if (timer == NULL)
+    {
+        return IFX_ERROR(LIB_TIMER, IFX_TIMER_SET, IFX_ILLEGAL_ARGUMENT);
+    }
+    uint64_t now_ns;
+    if (!ifx_timer_now(&now_ns))
+    {
+        return IFX_ERROR(LIB_TIMER, IFX_TIMER_SET, IFX_UNSPECIFIED_ERROR);
+    }
+    timer->_start = NULL;
+    timer->_duration = time_us;
+    timer->_deadline = now_ns + (time_us * IFX_TIMER_NS_PER_US);
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief POSIX implementation of interface function.
+ */
+bool ifx_timer_has_elapsed(const ifx_timer_t *timer)
+{
+    return ifx_timer_remaining(timer) == 0U;
+}
+
+/**
+ * \brief POSIX implementation of interface function.
+ */
+uint64_t ifx_timer_remaining(const ifx_timer_t *timer)
+{
+    // Timers that have not been set are elapsed per definition
+    if ((timer == NULL) || (timer->_deadline == 0U))
+    {
+        return 0U;
+    }
+    uint64_t now_ns;
+    if (!ifx_timer_now(&now_ns) || (now_ns >= timer->_deadline))
+    {
+        return 0U;
+    }
+    return ((timer->_deadline - now_ns) + (IFX_TIMER_NS_PER_US - 1U)) /
+           IFX_TIMER_NS_PER_US;
+}
+
+/**
+ * \brief POSIX implementation of interface function.
+ */
+ifx_status_t ifx_timer_join(const ifx_timer_t *timer)
+{
+    if (timer == NULL)
+    {
+        return IFX_ERROR(LIB_TIMER, IFX_TIMER_JOIN, IFX_ILLEGAL_ARGUMENT);
+    }
+    if (timer->_deadline == 0U)
+    {
+        return IFX_ERROR(LIB_TIMER, IFX_TIMER_JOIN, IFX_TIMER_NOT_SET);
+    }
+
+    // Sleep until absolute deadline so that interruptions do not add up
+    struct timespec deadline;
+    deadline.tv_sec = (time_t) (timer->_deadline / IFX_TIMER_NS_PER_S);
+    deadline.tv_nsec = (long) (timer->_deadline % IFX_TIMER_NS_PER_S);
+    int result;
+    do
+    {
+        result = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline,
+                                 NULL);
+    } while (result == EINTR);
+    if (result != 0)
+    {
+        return IFX_ERROR(LIB_TIMER, IFX_TIMER_JOIN, IFX_UNSPECIFIED_ERROR);
+    }
+    return IFX_SUCCESS;
+}
+
+/**
+ * \brief POSIX implementation of interface function.
+ */
+void ifx_timer_destroy(ifx_timer_t *timer)
+{
+    // Nothing allocated, only mark as not set
+    if (timer != NULL)
+    {
+        timer->_deadline = 0U;
+    }
+}